@@ -2,6 +2,20 @@
 
 #include "Aeyerji.h"
 #include "Modules/ModuleManager.h"
+#include "Systems/AeyerjiReplicationGraph.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Aeyerji, "Aeyerji" );
- 
\ No newline at end of file
+class FAeyerjiGameModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		UAeyerjiReplicationGraph::RegisterCreateDriverDelegate();
+	}
+
+	virtual void ShutdownModule() override
+	{
+		UAeyerjiReplicationGraph::UnregisterCreateDriverDelegate();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FAeyerjiGameModule, Aeyerji, "Aeyerji" );
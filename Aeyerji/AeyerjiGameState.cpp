@@ -3,6 +3,9 @@
 #include "AeyerjiGameState.h"
 
 #include "AeyerjiPlayerState.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Attributes/AeyerjiAttributeSet.h"
 #include "CharacterStatsLibrary.h"
 #include "Director/AeyerjiLevelDirector.h"
 #include "Director/AeyerjiSpawnerGroup.h"
@@ -11,6 +14,8 @@
 #include "Engine/World.h"
 #include "EngineUtils.h"
 #include "Net/UnrealNetwork.h"
+#include "Systems/AeyerjiDeathPresentationSubsystem.h"
+#include "Algo/Compare.h"
 
 namespace
 {
@@ -56,6 +61,20 @@ void AAeyerjiGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 
 	DOREPLIFETIME_CONDITION_NOTIFY(AAeyerjiGameState, RunState, COND_None, REPNOTIFY_Always);
 	DOREPLIFETIME_CONDITION_NOTIFY(AAeyerjiGameState, RunResults, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME(AAeyerjiGameState, PartyStats);
+}
+
+void AAeyerjiGameState::MulticastDeathBatch_Implementation(const TArray<FAeyerjiDeathEvent>& Events)
+{
+	if (HasAuthority())
+	{
+		return; // the server applied each death when it happened
+	}
+
+	if (UAeyerjiDeathPresentationSubsystem* Presentation = UAeyerjiDeathPresentationSubsystem::Get(this))
+	{
+		Presentation->HandleDeathBatch(Events);
+	}
 }
 
 void AAeyerjiGameState::OnRep_RunState(EAeyerjiRunState OldState)
@@ -68,6 +87,151 @@ void AAeyerjiGameState::OnRep_RunResults()
 	MaybeBroadcastRunResults();
 }
 
+void AAeyerjiGameState::OnRep_PartyStats()
+{
+	OnPartyStatsChanged.Broadcast(PartyStats);
+}
+
+void AAeyerjiGameState::AddPlayerState(APlayerState* PlayerState)
+{
+	Super::AddPlayerState(PlayerState);
+
+	if (!HasAuthority() || !PlayerState)
+	{
+		return;
+	}
+
+	PlayerState->OnPawnSet.AddUniqueDynamic(this, &AAeyerjiGameState::HandlePlayerPawnSet);
+	if (APawn* Pawn = PlayerState->GetPawn())
+	{
+		BindPlayerLevel(PlayerState, Pawn);
+	}
+}
+
+void AAeyerjiGameState::RemovePlayerState(APlayerState* PlayerState)
+{
+	if (HasAuthority() && PlayerState)
+	{
+		PlayerState->OnPawnSet.RemoveDynamic(this, &AAeyerjiGameState::HandlePlayerPawnSet);
+		UnbindPlayerLevel(PlayerState);
+	}
+
+	Super::RemovePlayerState(PlayerState);
+
+	if (HasAuthority())
+	{
+		RefreshPartyStats();
+	}
+}
+
+void AAeyerjiGameState::HandlePlayerPawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn)
+{
+	UnbindPlayerLevel(Player);
+	if (NewPawn)
+	{
+		BindPlayerLevel(Player, NewPawn);
+	}
+	else
+	{
+		RefreshPartyStats();
+	}
+}
+
+void AAeyerjiGameState::BindPlayerLevel(APlayerState* PlayerState, APawn* Pawn)
+{
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Pawn, /*LookForComponent*/ true);
+	if (!ASC)
+	{
+		return;
+	}
+
+	ASC->GetGameplayAttributeValueChangeDelegate(UAeyerjiAttributeSet::GetLevelAttribute())
+		.AddUObject(this, &AAeyerjiGameState::HandlePlayerLevelChanged);
+	TrackedLevelASCs.Add(PlayerState, ASC);
+
+	RefreshPartyStats();
+}
+
+void AAeyerjiGameState::UnbindPlayerLevel(APlayerState* PlayerState)
+{
+	TWeakObjectPtr<UAbilitySystemComponent> TrackedASC;
+	if (!TrackedLevelASCs.RemoveAndCopyValue(PlayerState, TrackedASC))
+	{
+		return;
+	}
+
+	if (UAbilitySystemComponent* ASC = TrackedASC.Get())
+	{
+		ASC->GetGameplayAttributeValueChangeDelegate(UAeyerjiAttributeSet::GetLevelAttribute()).RemoveAll(this);
+	}
+}
+
+void AAeyerjiGameState::HandlePlayerLevelChanged(const FOnAttributeChangeData& Data)
+{
+	if (FMath::RoundToInt(Data.OldValue) != FMath::RoundToInt(Data.NewValue))
+	{
+		RefreshPartyStats();
+	}
+}
+
+int32 AAeyerjiGameState::GetPartyMemberLevel(const APlayerState* PlayerState) const
+{
+	const FAeyerjiPartyMemberLevel* Member = PartyStats.Members.FindByPredicate([PlayerState](const FAeyerjiPartyMemberLevel& Entry)
+	{
+		return Entry.PlayerState == PlayerState;
+	});
+	return Member ? Member->Level : 0;
+}
+
+void AAeyerjiGameState::RefreshPartyStats()
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	FAeyerjiPartyStats NewStats;
+	int32 LevelSum = 0;
+
+	for (APlayerState* PS : PlayerArray)
+	{
+		const UAbilitySystemComponent* ASC = PS ? TrackedLevelASCs.FindRef(PS).Get() : nullptr;
+		if (!ASC || !ASC->HasAttributeSetForAttribute(UAeyerjiAttributeSet::GetLevelAttribute()))
+		{
+			continue;
+		}
+
+		const int32 Level = FMath::Max(1, FMath::RoundToInt(ASC->GetNumericAttribute(UAeyerjiAttributeSet::GetLevelAttribute())));
+		FAeyerjiPartyMemberLevel& Member = NewStats.Members.AddDefaulted_GetRef();
+		Member.PlayerState = PS;
+		Member.Level = Level;
+		NewStats.HighestLevel = FMath::Max(NewStats.HighestLevel, Level);
+		LevelSum += Level;
+	}
+
+	NewStats.PlayerCount = NewStats.Members.Num();
+	NewStats.AverageLevel = NewStats.PlayerCount > 0 ? static_cast<float>(LevelSum) / NewStats.PlayerCount : 1.f;
+
+	BindToLevelDirector();
+	if (const AAeyerjiLevelDirector* LevelDirector = CachedLevelDirector.Get())
+	{
+		NewStats.DifficultyScale = FMath::Clamp(LevelDirector->GetCurvedDifficulty(), 0.f, 1.f);
+	}
+
+	const bool bMembersChanged = NewStats.Members.Num() != PartyStats.Members.Num()
+		|| !Algo::CompareByPredicate(NewStats.Members, PartyStats.Members, [](const FAeyerjiPartyMemberLevel& A, const FAeyerjiPartyMemberLevel& B)
+		{
+			return A.PlayerState == B.PlayerState && A.Level == B.Level;
+		});
+	if (!bMembersChanged && FMath::IsNearlyEqual(NewStats.DifficultyScale, PartyStats.DifficultyScale))
+	{
+		return;
+	}
+
+	PartyStats = MoveTemp(NewStats);
+	OnPartyStatsChanged.Broadcast(PartyStats);
+}
+
 bool AAeyerjiGameState::Server_StartRun()
 {
 	if (!HasAuthority())
@@ -400,6 +564,9 @@ void AAeyerjiGameState::HandleLevelDirectorRunActiveChanged(bool bIsRunning)
 		return;
 	}
 
+	// The run picks up the difficulty slider chosen for it.
+	RefreshPartyStats();
+
 	if (bIsRunning)
 	{
 		SetRunState(EAeyerjiRunState::InRun);
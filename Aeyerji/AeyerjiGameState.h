@@ -3,10 +3,13 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/GameStateBase.h"
+#include "AeyerjiCharacter.h"
 #include "AeyerjiGameState.generated.h"
 
 class AAeyerjiLevelDirector;
 class AAeyerjiSpawnerGroup;
+class UAbilitySystemComponent;
+struct FOnAttributeChangeData;
 
 UENUM(BlueprintType)
 enum class EAeyerjiRunState : uint8
@@ -44,6 +47,43 @@ struct AEYERJI_API FAeyerjiRunResults
 	float DifficultySlider = 0.f;
 };
 
+USTRUCT(BlueprintType)
+struct AEYERJI_API FAeyerjiPartyMemberLevel
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Party")
+	TObjectPtr<APlayerState> PlayerState = nullptr;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Party")
+	int32 Level = 1;
+};
+
+/** Party-wide scaling inputs, kept current from level-change delegates so per-kill readers never walk PlayerArray. */
+USTRUCT(BlueprintType)
+struct AEYERJI_API FAeyerjiPartyStats
+{
+	GENERATED_BODY()
+
+	/** Players whose pawn currently has an ability system with a Level attribute. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Party")
+	int32 PlayerCount = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Party")
+	int32 HighestLevel = 1;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Party")
+	float AverageLevel = 1.f;
+
+	/** Curved run difficulty (0..1) from the LevelDirector; 0 when the level has none. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Party")
+	float DifficultyScale = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Party")
+	TArray<FAeyerjiPartyMemberLevel> Members;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAeyerjiPartyStatsChangedSignature, const FAeyerjiPartyStats&, Stats);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FAeyerjiRunStateChangedSignature, EAeyerjiRunState, NewState, EAeyerjiRunState, OldState);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAeyerjiRunResultsReadySignature, const FAeyerjiRunResults&, Results);
 
@@ -62,9 +102,12 @@ public:
 	/** Initializes the run state machine and binds to the LevelDirector when running on the server. */
 	virtual void BeginPlay() override;
 
-	/** Replication descriptor for RunState and RunResults. */
+	/** Replication descriptor for RunState, RunResults and PartyStats. */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	virtual void AddPlayerState(APlayerState* PlayerState) override;
+	virtual void RemovePlayerState(APlayerState* PlayerState) override;
+
 	/** Current run state (replicated). */
 	UFUNCTION(BlueprintPure, Category="Aeyerji|Run")
 	EAeyerjiRunState GetRunState() const { return RunState; }
@@ -73,6 +116,27 @@ public:
 	UFUNCTION(BlueprintPure, Category="Aeyerji|Run")
 	const FAeyerjiRunResults& GetRunResults() const { return RunResults; }
 
+	/** Cached party levels and run difficulty (replicated). */
+	UFUNCTION(BlueprintPure, Category="Aeyerji|Party")
+	const FAeyerjiPartyStats& GetPartyStats() const { return PartyStats; }
+
+	/** True once at least one player's level has been aggregated. */
+	bool HasPartyStats() const { return PartyStats.PlayerCount > 0; }
+
+	/** Level of one party member from the aggregate; 0 when the player is not tracked. */
+	UFUNCTION(BlueprintPure, Category="Aeyerji|Party")
+	int32 GetPartyMemberLevel(const APlayerState* PlayerState) const;
+
+	/** Server-only: recomputes PartyStats from the tracked ability systems (O(players)); no-op when nothing changed. */
+	void RefreshPartyStats();
+
+	/**
+	 * Every death the server saw last frame, sent by UAeyerjiDeathPresentationSubsystem. Unreliable: a dropped batch is
+	 * covered by AAeyerjiCharacter::bIsDead.
+	 */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastDeathBatch(const TArray<FAeyerjiDeathEvent>& Events);
+
 	/**
 	 * Server-only: starts the run and transitions PreRun -> InRun.
 	 * If a LevelDirector is present, it also calls StartRun() on it.
@@ -117,6 +181,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Aeyerji|Run|Events")
 	FAeyerjiRunResultsReadySignature OnRunResultsReady;
 
+	/** Fired whenever PartyStats changes (server + clients). */
+	UPROPERTY(BlueprintAssignable, Category="Aeyerji|Party|Events")
+	FAeyerjiPartyStatsChangedSignature OnPartyStatsChanged;
+
 	/** Travel URL for the main menu map (e.g. /Game/Maps/MainMenu). If empty, uses GameInstance->ReturnToMainMenu(). */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Aeyerji|Run|Travel")
 	FString MainMenuTravelURL = "/Game/Levels/L_MainMenu";
@@ -146,6 +214,13 @@ protected:
 	UFUNCTION()
 	void OnRep_RunResults();
 
+	/** Server-maintained party aggregate; see RefreshPartyStats. */
+	UPROPERTY(ReplicatedUsing=OnRep_PartyStats, VisibleAnywhere, BlueprintReadOnly, Category="Aeyerji|Party")
+	FAeyerjiPartyStats PartyStats;
+
+	UFUNCTION()
+	void OnRep_PartyStats();
+
 protected:
 	/** Binds to LevelDirector delegates (run start and boss spawner clear) if one exists in the world. */
 	void BindToLevelDirector();
@@ -183,6 +258,16 @@ protected:
 	/** Timer callback to auto-advance RunComplete -> ReturnToMenu. */
 	void HandleAutoReturnDelayElapsed();
 
+	/** Server hook: a player state possessed a new pawn; moves the Level listener over to the new ability system. */
+	UFUNCTION()
+	void HandlePlayerPawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn);
+
+	/** Server hook: a tracked player's Level attribute changed. */
+	void HandlePlayerLevelChanged(const FOnAttributeChangeData& Data);
+
+	void BindPlayerLevel(APlayerState* PlayerState, APawn* Pawn);
+	void UnbindPlayerLevel(APlayerState* PlayerState);
+
 private:
 	TWeakObjectPtr<AAeyerjiLevelDirector> CachedLevelDirector;
 	TWeakObjectPtr<AAeyerjiSpawnerGroup> CachedBossSpawner;
@@ -195,4 +280,7 @@ private:
 
 	/** Local gate to prevent duplicate results broadcasts. */
 	int32 LastBroadcastResultsVersion = 0;
+
+	/** Server-only: ability system whose Level attribute is tracked for each player. */
+	TMap<TWeakObjectPtr<APlayerState>, TWeakObjectPtr<UAbilitySystemComponent>> TrackedLevelASCs;
 };
@@ -42,8 +42,11 @@
 #include "Engine/StaticMesh.h"
 #include "GUI/W_EquipmentSlot.h"
 #include "GUI/W_ItemTile.h"
+#include "GUI/AeyerjiStatusBarOverlayComponent.h"
+#include "Systems/AeyerjiNavProjectionCache.h"
 #include "Systems/LootService.h"
 #include "Systems/LootTable.h"
+#include "Logging/AeyerjiStats.h"
 
 template <class TAsset>
 static void LoadIfNull(TObjectPtr<TAsset>& Dest, const TCHAR* AssetPath)
@@ -58,6 +61,12 @@ static void LoadIfNull(TObjectPtr<TAsset>& Dest, const TCHAR* AssetPath)
 	}
 }
 
+/** Wrap-safe uint16 sequence compare for the latest-wins intent streams: true if Incoming is not newer than LastAccepted. */
+static bool IsStaleIntentSequence(uint16 Incoming, uint16 LastAccepted)
+{
+	return static_cast<int16>(static_cast<uint16>(Incoming - LastAccepted)) <= 0;
+}
+
 AAeyerjiPlayerController::AAeyerjiPlayerController()
 {
 	bShowMouseCursor = true;
@@ -258,15 +267,67 @@ void AAeyerjiPlayerController::ReportMouseNavContextToServer(EMouseNavResult Res
 
 	SetMouseNavContextInternal(Result, NavLocation, CursorLocation, ClickedPawn);
 
-	if (!HasAuthority())
+	if (HasAuthority())
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	// A new pawn/result under the cursor is a discrete change: send it reliably so it stays ordered with
+	// the ability RPCs that usually follow. Everything else is a latest-wins refresh.
+	const bool bTargetChanged = LastSentMouseNavResult != Result || LastSentMouseNavPawn.Get() != ClickedPawn;
+	if (bTargetChanged)
+	{
+		Server_SetMouseNavContext(Result, NavLocation, CursorLocation, ClickedPawn, ++MouseNavSequence);
+	}
+	else
+	{
+		if (FVector::DistSquared(NavLocation, LastSentMouseNavLocation) < 1.f)
+		{
+			return;
+		}
+		if (MouseNavContextSendInterval > 0.f && LastMouseNavSendTime >= 0.0 && (Now - LastMouseNavSendTime) < MouseNavContextSendInterval)
+		{
+			return;
+		}
+		Server_StreamMouseNavContext(Result, NavLocation, CursorLocation, ClickedPawn, ++MouseNavSequence);
+	}
+
+	LastMouseNavSendTime = Now;
+	LastSentMouseNavResult = Result;
+	LastSentMouseNavPawn = ClickedPawn;
+	LastSentMouseNavLocation = NavLocation;
+}
+
+void AAeyerjiPlayerController::Server_SetMouseNavContext_Implementation(EMouseNavResult Result, FVector_NetQuantize NavLocation, FVector_NetQuantize CursorLocation, APawn* ClickedPawn, uint16 Sequence)
+{
+	if (AcceptMouseNavSequence(Sequence))
 	{
-		Server_SetMouseNavContext(Result, NavLocation, CursorLocation, ClickedPawn);
+		SetMouseNavContextInternal(Result, NavLocation, CursorLocation, ClickedPawn);
 	}
 }
 
-void AAeyerjiPlayerController::Server_SetMouseNavContext_Implementation(EMouseNavResult Result, FVector NavLocation, FVector CursorLocation, APawn* ClickedPawn)
+void AAeyerjiPlayerController::Server_StreamMouseNavContext_Implementation(EMouseNavResult Result, FVector_NetQuantize NavLocation, FVector_NetQuantize CursorLocation, APawn* ClickedPawn, uint16 Sequence)
 {
-	SetMouseNavContextInternal(Result, NavLocation, CursorLocation, ClickedPawn);
+	if (AcceptMouseNavSequence(Sequence))
+	{
+		SetMouseNavContextInternal(Result, NavLocation, CursorLocation, ClickedPawn);
+	}
+}
+
+bool AAeyerjiPlayerController::AcceptMouseNavSequence(uint16 Sequence)
+{
+	// Reliable and unreliable context updates share one sequence space; anything older than what we hold is stale.
+	if (bHasAcceptedMouseNav && IsStaleIntentSequence(Sequence, LastAcceptedMouseNavSequence))
+	{
+		return false;
+	}
+
+	bHasAcceptedMouseNav = true;
+	LastAcceptedMouseNavSequence = Sequence;
+	return true;
 }
 
 bool AAeyerjiPlayerController::GetCachedMouseNavContext(EMouseNavResult& OutResult, FVector& OutNavLocation, FVector& OutCursorLocation, APawn*& OutPawn, float MaxAgeSeconds) const
@@ -445,7 +506,7 @@ bool AAeyerjiPlayerController::ComputePickupGoal(const AAeyerjiLootPickup* Loot,
 	const float AcceptRadiusSq = (PickupAcceptRadius > 5000.f) ? PickupAcceptRadius : FMath::Square(PickupAcceptRadius);
 	const float AcceptRadius = FMath::Sqrt(FMath::Max(0.f, AcceptRadiusSq));
 
-	FNavLocation Projected;
+	FVector Projected;
 	const FVector PrimaryExtent(Radius, Radius, 600.f);
 
 	auto FinalizeGoal = [&](const FVector& NavPoint)
@@ -458,10 +519,10 @@ bool AAeyerjiPlayerController::ComputePickupGoal(const AAeyerjiLootPickup* Loot,
 			if (DesiredDepth > KINDA_SMALL_NUMBER)
 			{
 				const FVector Nudged = Goal + ToCenter * DesiredDepth;
-				FNavLocation NudgedProjected;
-				if (Nav->ProjectPointToNavigation(Nudged, NudgedProjected, FVector(40.f, 40.f, 600.f)))
+				FVector NudgedProjected;
+				if (UAeyerjiNavProjectionCache::ProjectPoint(this, Nudged, FVector(40.f, 40.f, 600.f), NudgedProjected))
 				{
-					Goal = NudgedProjected.Location;
+					Goal = NudgedProjected;
 				}
 			}
 		}
@@ -472,11 +533,11 @@ bool AAeyerjiPlayerController::ComputePickupGoal(const AAeyerjiLootPickup* Loot,
 
 	auto TryProjectAndFinalize = [&](const FVector& Probe, const FVector& Extents)
 	{
-		if (!Nav->ProjectPointToNavigation(Probe, Projected, Extents))
+		if (!UAeyerjiNavProjectionCache::ProjectPoint(this, Probe, Extents, Projected))
 		{
 			return false;
 		}
-		return FinalizeGoal(Projected.Location);
+		return FinalizeGoal(Projected);
 	};
 
 	if (TryProjectAndFinalize(Center, PrimaryExtent))
@@ -508,9 +569,10 @@ bool AAeyerjiPlayerController::ComputePickupGoal(const AAeyerjiLootPickup* Loot,
 		}
 	}
 
-	if (Nav->GetRandomPointInNavigableRadius(Center, Radius, Projected))
+	FNavLocation RandomPoint;
+	if (Nav->GetRandomPointInNavigableRadius(Center, Radius, RandomPoint))
 	{
-		return FinalizeGoal(Projected.Location);
+		return FinalizeGoal(RandomPoint.Location);
 	}
 
 	UE_LOG(LogTemp, Warning, TEXT("[PC] Failed to find pickup goal for %s (center %s, radius %.1f)"), *GetNameSafe(Loot), *Center.ToString(), Radius);
@@ -577,34 +639,34 @@ void AAeyerjiPlayerController::OnShowLootReleased()
 	UAeyerjiInventoryBPFL::SetAllLootLabelsVisible(this, false);
 }
 
-void AAeyerjiPlayerController::Server_AddPickupIntent_Implementation(FName LootActorName)
+void AAeyerjiPlayerController::Server_AddPickupIntent_Implementation(FAeyerjiLootHandle LootHandle)
 {
-	if (AAeyerjiLootPickup* Loot = FindLootPickupByName(LootActorName))
+	if (AAeyerjiLootPickup* Loot = FindLootPickup(LootHandle))
 	{
 		Loot->AddPickupIntent(this);
 		AJ_LOG(this, TEXT("[PC-Server] AddIntent for %s"), *GetNameSafe(Loot));
 	}
 }
 
-void AAeyerjiPlayerController::Server_ClearPickupIntent_Implementation(FName LootActorName)
+void AAeyerjiPlayerController::Server_ClearPickupIntent_Implementation(FAeyerjiLootHandle LootHandle)
 {
-	if (AAeyerjiLootPickup* Loot = FindLootPickupByName(LootActorName))
+	if (AAeyerjiLootPickup* Loot = FindLootPickup(LootHandle))
 	{
 		Loot->RemovePickupIntent(this);
 		AJ_LOG(this, TEXT("[PC-Server] ClearIntent for %s"), *GetNameSafe(Loot));
 	}
 }
 
-void AAeyerjiPlayerController::Server_RequestPickup_Implementation(FName LootActorName)
+void AAeyerjiPlayerController::Server_RequestPickup_Implementation(FAeyerjiLootHandle LootHandle)
 {
-	if (AAeyerjiLootPickup* Loot = FindLootPickupByName(LootActorName))
+	if (AAeyerjiLootPickup* Loot = FindLootPickup(LootHandle))
 	{
 		AJ_LOG(this, TEXT("[PC-Server] RequestPickup for %s"), *GetNameSafe(Loot));
 		Loot->ExecutePickup(this);
 	}
 	else
 	{
-		AJ_LOG(this, TEXT("[PC-Server] RequestPickup failed - '%s' not found"), *LootActorName.ToString());
+		AJ_LOG(this, TEXT("[PC-Server] RequestPickup failed - handle %s not found"), *LootHandle.ToString());
 	}
 }
 
@@ -622,33 +684,22 @@ void AAeyerjiPlayerController::Server_RequestPickupActor_Implementation(AActor*
 	TypedLoot->ExecutePickup(this);
 }
 
-AAeyerjiLootPickup* AAeyerjiPlayerController::FindLootPickupByName(FName LootActorName) const
+AAeyerjiLootPickup* AAeyerjiPlayerController::FindLootPickup(const FAeyerjiLootHandle& LootHandle) const
 {
-	if (LootActorName.IsNone())
+	if (!LootHandle.IsValid())
 	{
 		return nullptr;
 	}
 
-	if (UWorld* World = GetWorld())
+	const UAeyerjiLootRegistry* Registry = UAeyerjiLootRegistry::Get(this);
+	AAeyerjiLootPickup* Loot = Registry ? Registry->Resolve(LootHandle) : nullptr;
+	if (!Loot)
 	{
-		for (TActorIterator<AAeyerjiLootPickup> It(World); It; ++It)
-		{
-			if (AAeyerjiLootPickup* Loot = *It)
-			{
-				if (!IsValid(Loot))
-				{
-					continue;
-				}
-
-				if (Loot->GetFName() == LootActorName)
-				{
-					return Loot;
-				}
-			}
-		}
+		// Usually a pickup that was collected/destroyed (and its slot possibly reused) while the RPC was in flight.
+		AJ_LOG(this, TEXT("[PC-Server] Rejected stale loot handle %s"), *LootHandle.ToString());
 	}
 
-	return nullptr;
+	return Loot;
 }
 
 void AAeyerjiPlayerController::BeginAbilityTargeting(const FAeyerjiAbilitySlot& Slot)
@@ -889,27 +940,47 @@ bool AAeyerjiPlayerController::ComputeSmartGoalForTarget(AActor* Target,
 	// 1) Desired point: directly “behind” the target
 	FVector Desired = TargetLoc - Fwd * BehindDistance;
 
-	FNavLocation Projected;
+	FVector Projected;
 	const FVector Ext = NavProjectExtents; // tweakable from BP
+	const float Radius = FMath::Max(BehindDistance, 120.f);
 
-	// 2) Try the direct behind point first
-	if (Nav && Nav->ProjectPointToNavigation(Desired, Projected, Ext))
+	// Cached projections are free; only real navmesh queries count against the budget.
+	int32 QueriesLeft = FMath::Max(1, SmartGoalQueryBudget);
+	auto TryProject = [&](const FVector& Candidate)
 	{
-		OutGoal = Projected.Location;
+		bool bQueriedNavMesh = false;
+		const bool bHit = UAeyerjiNavProjectionCache::ProjectPoint(this, Candidate, Ext, Projected, &bQueriedNavMesh);
+		if (bQueriedNavMesh)
+		{
+			--QueriesLeft;
+		}
+		return bHit;
+	};
+
+	auto AcceptGoal = [&](const FVector& Goal)
+	{
+		SmartGoalFallbackTarget = Target;
+		SmartGoalFallback = Goal;
+		OutGoal = Goal;
 		return true;
+	};
+
+	// 2) Try the direct behind point first
+	if (Nav && TryProject(Desired))
+	{
+		return AcceptGoal(Projected);
 	}
 
 	// 3) Fan left/right around an arc behind the target
-	const float Radius = FMath::Max(BehindDistance, 120.f);
 	const int32  Steps = 6; // granularity of the fan
 
 	// Angle of the “pure behind” direction relative to world X/Y
 	const float BaseTheta = FMath::Atan2((-Fwd).Y, (-Fwd).X);
 
-	for (int32 Step = 1; Step <= Steps; ++Step)
+	for (int32 Step = 1; Step <= Steps && QueriesLeft > 0; ++Step)
 	{
 		const float Delta = FMath::DegreesToRadians((ArcHalfAngleDeg / Steps) * Step);
-		for (int32 Side = -1; Side <= 1; Side += 2) // -1 = left, +1 = right
+		for (int32 Side = -1; Side <= 1 && QueriesLeft > 0; Side += 2) // -1 = left, +1 = right
 		{
 			const float Theta = BaseTheta + (Side * Delta);
 			const FVector Offset(Radius * FMath::Cos(Theta),
@@ -922,14 +993,21 @@ bool AAeyerjiPlayerController::ComputeSmartGoalForTarget(AActor* Target,
 				OutGoal = Candidate;
 				return true;
 			}
-			if (Nav->ProjectPointToNavigation(Candidate, Projected, Ext))
+			if (TryProject(Candidate))
 			{
-				OutGoal = Projected.Location;
-				return true;
+				return AcceptGoal(Projected);
 			}
 		}
 	}
 
+	// Budget spent (or fan exhausted): keep the last goal we found for this target while it is still next to it.
+	if (SmartGoalFallbackTarget.Get() == Target
+		&& FVector::DistSquared2D(SmartGoalFallback, TargetLoc) <= FMath::Square(Radius * 1.5f))
+	{
+		OutGoal = SmartGoalFallback;
+		return true;
+	}
+
 	// 4) Absolute fallback: go for the target’s current location
 	OutGoal = TargetLoc;
 	return true;
@@ -973,6 +1051,9 @@ void AAeyerjiPlayerController::BeginPlay()
             }
         }
         EnsureShowLootBinding();
+
+        // Status bar overlay up-front so enemy bars registered before us are adopted from its queue
+        UAeyerjiStatusBarOverlayComponent::FindOrCreateFor(this);
     }
 
     // Apply profile if assigned (server authoritative, but run for local settings too)
@@ -1134,6 +1215,7 @@ void AAeyerjiPlayerController::OnAttackClickHeld(const FInputActionValue&)
 void AAeyerjiPlayerController::OnAttackClickReleased(const FInputActionValue&)
 {
 	bAttackClickHeld = false;
+	EndCursorFollowStream();
 	bCursorFollowHasSmoothedGoal = false;
 	CursorFollowSmoothedGoal = FVector::ZeroVector;
 	bCursorFollowActive = false;
@@ -1141,10 +1223,6 @@ void AAeyerjiPlayerController::OnAttackClickReleased(const FInputActionValue&)
 	LastCursorFollowRepathGoal = FVector::ZeroVector;
 	ResetCursorFollowHold();
 	ResetCursorFollowTurnRate();
-	if (!HasAuthority())
-	{
-		Server_ResetCursorFollowTurnRate();
-	}
 }
 
 bool AAeyerjiPlayerController::ActivatePrimaryAttackAbility()
@@ -1278,6 +1356,7 @@ void AAeyerjiPlayerController::OnMoveClickHeld(const FInputActionValue& /*Val*/)
 
 void AAeyerjiPlayerController::OnMoveClickReleased(const FInputActionValue& /*Val*/)
 {
+	EndCursorFollowStream();
 	bCursorFollowHasSmoothedGoal = false;
 	CursorFollowSmoothedGoal = FVector::ZeroVector;
 	bCursorFollowActive = false;
@@ -1285,10 +1364,6 @@ void AAeyerjiPlayerController::OnMoveClickReleased(const FInputActionValue& /*Va
 	LastCursorFollowRepathGoal = FVector::ZeroVector;
 	ResetCursorFollowHold();
 	ResetCursorFollowTurnRate();
-	if (!HasAuthority())
-	{
-		Server_ResetCursorFollowTurnRate();
-	}
 }
 
 void AAeyerjiPlayerController::OnDropItemPressed(const FInputActionValue& /*Val*/)
@@ -1539,6 +1614,8 @@ bool AAeyerjiPlayerController::TryDropItemUnderCursor()
 
 bool AAeyerjiPlayerController::TraceCursor(ECollisionChannel Channel, FHitResult& OutHit, bool bTraceComplex) const
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_CursorTrace);
+
 	static double LastGroundTraceWarnTime = -1.0;
 	const bool bIsGroundTrace = (Channel == ECC_GameTraceChannel2);
 	const UWorld* WorldForTime = GetWorld();
@@ -1974,11 +2051,11 @@ bool AAeyerjiPlayerController::HandleLootUnderCursor(AAeyerjiLootPickup* Loot, c
 		// If we already had a different loot intent, clear it
 		if (PendingPickup.IsValid() && PendingPickup.Get() != Loot)
 		{
-			Server_ClearPickupIntent(PendingPickup->GetFName());
+			Server_ClearPickupIntent(PendingPickup->GetLootHandle());
 			PendingPickup = nullptr;
 		}
 
-		Server_AddPickupIntent(Loot->GetFName());
+		Server_AddPickupIntent(Loot->GetLootHandle());
 
 		FVector Goal;
 		const bool bFoundGoal = ComputePickupGoal(Loot, Goal);
@@ -2091,7 +2168,44 @@ void AAeyerjiPlayerController::UpdateContinuousMoveGoal(const FVector& Goal)
 
 	if (!HasAuthority())
 	{
-		Server_UpdateCursorFollowGoal(SmoothedGoal);
+		SendCursorFollowGoal(SmoothedGoal);
+	}
+}
+
+void AAeyerjiPlayerController::SendCursorFollowGoal(const FVector& Goal)
+{
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	// Throttled goals are not queued: the next call carries a fresher goal, and release sends the final one reliably.
+	if (LastMoveIntentSendTime >= 0.0)
+	{
+		if (FVector::DistSquared2D(Goal, LastSentMoveIntentGoal) < FMath::Square(MoveIntentMinDelta))
+		{
+			return;
+		}
+		if (MoveIntentSendInterval > 0.f && (Now - LastMoveIntentSendTime) < MoveIntentSendInterval)
+		{
+			return;
+		}
+	}
+
+	LastMoveIntentSendTime = Now;
+	LastSentMoveIntentGoal = Goal;
+	Server_StreamCursorFollowGoal(Goal, ++MoveIntentSequence);
+}
+
+void AAeyerjiPlayerController::EndCursorFollowStream()
+{
+	const bool bHasFinalGoal = LastMoveIntentSendTime >= 0.0 && bCursorFollowHasSmoothedGoal;
+	const FVector FinalGoal = CursorFollowSmoothedGoal;
+
+	LastMoveIntentSendTime = -1.0;
+	LastSentMoveIntentGoal = FVector::ZeroVector;
+
+	if (!HasAuthority())
+	{
+		Server_EndCursorFollowStream(bHasFinalGoal, FinalGoal, ++MoveIntentSequence);
 	}
 }
 
@@ -2565,7 +2679,77 @@ void AAeyerjiPlayerController::ServerMoveToActor_Implementation(AActor* Target,
 	UAIBlueprintHelperLibrary::SimpleMoveToActor(this, Target);
 }
 
-void AAeyerjiPlayerController::Server_UpdateCursorFollowGoal_Implementation(const FVector& Goal)
+void AAeyerjiPlayerController::Server_StreamCursorFollowGoal_Implementation(FVector_NetQuantize Goal, uint16 Sequence)
+{
+	if (Goal.ContainsNaN() || !AcceptMoveIntentSequence(Sequence))
+	{
+		return;
+	}
+
+	PendingMoveIntentGoal = Goal;
+	bHasPendingMoveIntent = true;
+
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+	const double SinceLastApply = LastMoveIntentApplyTime < 0.0 ? TNumericLimits<double>::Max() : Now - LastMoveIntentApplyTime;
+	if (ServerMoveIntentMinInterval <= 0.f || SinceLastApply >= ServerMoveIntentMinInterval)
+	{
+		ApplyPendingMoveIntent();
+		return;
+	}
+
+	// Rate limited: keep only the newest goal and apply it when the window reopens.
+	if (!GetWorldTimerManager().IsTimerActive(MoveIntentApplyTimer))
+	{
+		GetWorldTimerManager().SetTimer(MoveIntentApplyTimer, this, &AAeyerjiPlayerController::ApplyPendingMoveIntent,
+			static_cast<float>(ServerMoveIntentMinInterval - SinceLastApply), false);
+	}
+}
+
+void AAeyerjiPlayerController::Server_EndCursorFollowStream_Implementation(bool bHasFinalGoal, FVector_NetQuantize FinalGoal, uint16 FinalSequence)
+{
+	GetWorldTimerManager().ClearTimer(MoveIntentApplyTimer);
+	bHasPendingMoveIntent = false;
+
+	if (AcceptMoveIntentSequence(FinalSequence) && bHasFinalGoal && !FinalGoal.ContainsNaN())
+	{
+		ApplyCursorFollowGoal(FinalGoal);
+	}
+
+	ResetCursorFollowTurnRate();
+	bCursorFollowActive = false;
+	LastCursorFollowRepathTime = -1.0;
+	LastCursorFollowRepathGoal = FVector::ZeroVector;
+	LastMoveIntentApplyTime = -1.0;
+}
+
+bool AAeyerjiPlayerController::AcceptMoveIntentSequence(uint16 Sequence)
+{
+	if (bHasAcceptedMoveIntent && IsStaleIntentSequence(Sequence, LastAcceptedMoveIntentSequence))
+	{
+		return false;
+	}
+
+	bHasAcceptedMoveIntent = true;
+	LastAcceptedMoveIntentSequence = Sequence;
+	return true;
+}
+
+void AAeyerjiPlayerController::ApplyPendingMoveIntent()
+{
+	if (!bHasPendingMoveIntent)
+	{
+		return;
+	}
+
+	bHasPendingMoveIntent = false;
+
+	const UWorld* World = GetWorld();
+	LastMoveIntentApplyTime = World ? World->GetTimeSeconds() : 0.0;
+	ApplyCursorFollowGoal(PendingMoveIntentGoal);
+}
+
+void AAeyerjiPlayerController::ApplyCursorFollowGoal(const FVector& Goal)
 {
 	if (!GetPawn() || IsControlledPawnDead())
 	{
@@ -2610,14 +2794,6 @@ void AAeyerjiPlayerController::Server_UpdateCursorFollowGoal_Implementation(cons
 	}
 }
 
-void AAeyerjiPlayerController::Server_ResetCursorFollowTurnRate_Implementation()
-{
-	ResetCursorFollowTurnRate();
-	bCursorFollowActive = false;
-	LastCursorFollowRepathTime = -1.0;
-	LastCursorFollowRepathGoal = FVector::ZeroVector;
-}
-
 void AAeyerjiPlayerController::Server_ApplyCursorFollowTurnRate_Implementation(const FVector& Goal)
 {
 	UpdateCursorFollowTurnRate(Goal);
@@ -2971,11 +3147,14 @@ void AAeyerjiPlayerController::RefreshLootScalingDebug_Internal()
 	}
 
 	int32 PickupUpdated = 0;
-	for (TActorIterator<AAeyerjiLootPickup> It(World); It; ++It)
+	if (const UAeyerjiLootRegistry* LootRegistry = UAeyerjiLootRegistry::Get(World))
 	{
-		if (AAeyerjiLootPickup* Pickup = *It)
+		for (const TWeakObjectPtr<AAeyerjiLootPickup>& PickupPtr : LootRegistry->GetPickups())
 		{
-			PickupUpdated += Pickup->DebugRefreshItemScaling(*LootTable);
+			if (AAeyerjiLootPickup* Pickup = PickupPtr.Get())
+			{
+				PickupUpdated += Pickup->DebugRefreshItemScaling(*LootTable);
+			}
 		}
 	}
 
@@ -3153,13 +3332,10 @@ bool AAeyerjiPlayerController::AdjustGoalForShortAvoidance(FVector& InOutGoal)
     // Project to navmesh to keep it valid (optional, best-effort)
     if (bAvoidanceProjectToNavmesh)
     {
-        if (const UNavigationSystemV1* Nav = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+        FVector Projected;
+        if (UAeyerjiNavProjectionCache::ProjectPoint(this, Chosen, NavProjectExtents, Projected))
         {
-            FNavLocation Projected;
-            if (Nav->ProjectPointToNavigation(Chosen, Projected, NavProjectExtents))
-            {
-                Chosen = Projected.Location;
-            }
+            Chosen = Projected;
         }
     }
 
@@ -12,6 +12,7 @@
 #include "Abilities/AeyerjiAbilitySlot.h"
 #include "Abilities/AeyerjiTargetingManager.h"
 #include "Inventory/AeyerjiLootPickup.h"
+#include "Systems/AeyerjiLootRegistry.h"
 #include "MouseNavBlueprintLibrary.h"
 #include "AeyerjiPlayerController.generated.h"
 class APawn;
@@ -111,9 +112,10 @@ public:
 	UFUNCTION() void OnShowLootReleased();
 
 	// Client→Server RPCs the client is allowed to call
-	UFUNCTION(Server, Reliable) void Server_AddPickupIntent(FName LootActorName);
-	UFUNCTION(Server, Reliable) void Server_ClearPickupIntent(FName LootActorName);
-	UFUNCTION(Server, Reliable) void Server_RequestPickup   (FName LootActorName);
+	// Loot is addressed by its registry handle (UAeyerjiLootRegistry); stale handles are rejected on the server.
+	UFUNCTION(Server, Reliable) void Server_AddPickupIntent(FAeyerjiLootHandle LootHandle);
+	UFUNCTION(Server, Reliable) void Server_ClearPickupIntent(FAeyerjiLootHandle LootHandle);
+	UFUNCTION(Server, Reliable) void Server_RequestPickup   (FAeyerjiLootHandle LootHandle);
 
 	// Accept a generic actor pointer to avoid hot-reload class mismatches; we validate and cast on the server.
 	UFUNCTION(Server, Reliable) void Server_RequestPickupActor(AActor* LootActor);
@@ -135,8 +137,13 @@ public:
 	void ReportMouseNavContextToServer(EMouseNavResult Result, const FVector& NavLocation, const FVector& CursorLocation, APawn* ClickedPawn);
 	bool GetCachedMouseNavContext(EMouseNavResult& OutResult, FVector& OutNavLocation, FVector& OutCursorLocation, APawn*& OutPawn, float MaxAgeSeconds = 1.0f) const;
 
+	/** Reliable: sent when the pawn under the cursor changes so ability RPCs queued behind it see the right target. */
 	UFUNCTION(Server, Reliable)
-	void Server_SetMouseNavContext(EMouseNavResult Result, FVector NavLocation, FVector CursorLocation, APawn* ClickedPawn);
+	void Server_SetMouseNavContext(EMouseNavResult Result, FVector_NetQuantize NavLocation, FVector_NetQuantize CursorLocation, APawn* ClickedPawn, uint16 Sequence);
+
+	/** Unreliable, latest-wins refresh of the cursor context while the pawn under it stays the same. */
+	UFUNCTION(Server, Unreliable)
+	void Server_StreamMouseNavContext(EMouseNavResult Result, FVector_NetQuantize NavLocation, FVector_NetQuantize CursorLocation, APawn* ClickedPawn, uint16 Sequence);
 
 
 	/** NEW: Local BP “intercept” hook. Return true to CONSUME the click (skip native flow). */
@@ -216,7 +223,7 @@ public:
 
 protected:
 	virtual void OnRep_Pawn() override;
-	AAeyerjiLootPickup* FindLootPickupByName(FName LootActorName) const;
+	AAeyerjiLootPickup* FindLootPickup(const FAeyerjiLootHandle& LootHandle) const;
 
 	// AActor
 	virtual void BeginPlay() override;
@@ -281,10 +288,12 @@ protected:
 	void ServerMoveToLocation(const FVector& Goal);
 	UFUNCTION(Server, Reliable, BlueprintCallable)
 	void ServerMoveToActor   (AActor* Target, const float AcceptanceRadius = 15.f);
+	/** Movement-intent stream: quantized cursor-follow goals, unreliable and latest-wins (older sequences are dropped). */
+	UFUNCTION(Server, Unreliable)
+	void Server_StreamCursorFollowGoal(FVector_NetQuantize Goal, uint16 Sequence);
+	/** Closes the stream reliably; carries the final goal so a lost last intent cannot strand the follow target. */
 	UFUNCTION(Server, Reliable)
-	void Server_UpdateCursorFollowGoal(const FVector& Goal);
-	UFUNCTION(Server, Reliable)
-	void Server_ResetCursorFollowTurnRate();
+	void Server_EndCursorFollowStream(bool bHasFinalGoal, FVector_NetQuantize FinalGoal, uint16 FinalSequence);
 	UFUNCTION(Server, Reliable)
 	void Server_ApplyCursorFollowTurnRate(const FVector& Goal);
 
@@ -341,6 +350,22 @@ protected:
 
 	UPROPERTY(EditAnywhere, Category="Aeyerji|Movement|Debug")
 	bool bDrawCursorFollowProxy = false;
+
+	/** Client: minimum seconds between streamed cursor-follow goals. */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|Movement|Network", meta=(ClampMin="0"))
+	float MoveIntentSendInterval = 0.033f;
+
+	/** Client: goals closer than this (cm, 2D) to the last streamed goal are not sent. */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|Movement|Network", meta=(ClampMin="0"))
+	float MoveIntentMinDelta = 8.f;
+
+	/** Server: streamed goals are applied at most this often; the newest one received in between wins. */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|Movement|Network", meta=(ClampMin="0"))
+	float ServerMoveIntentMinInterval = 0.05f;
+
+	/** Client: minimum seconds between unreliable mouse-nav context refreshes. */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|Navigation|Network", meta=(ClampMin="0"))
+	float MouseNavContextSendInterval = 0.1f;
 	
 	UPROPERTY(EditAnywhere, Category="Aeyerji|Targeting")
 	FAeyerjiTargetingTunables TargetingTunables;
@@ -381,6 +406,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category="Aeyerji|Movement")
 	FVector NavProjectExtents = FVector(200.f, 200.f, 500.f);
 
+	/** Max uncached navmesh projections per smart-goal solve; when spent, the last good goal for the target is reused. */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|Movement", meta=(ClampMin="1"))
+	int32 SmartGoalQueryBudget = 5;
+
 	/** Current mode for the loop. */
 	UPROPERTY(VisibleInstanceOnly, Category="Aeyerji|Movement")
 	EAeyerjiMoveLoopMode MoveLoopMode = EAeyerjiMoveLoopMode::StopOnly;
@@ -583,6 +612,38 @@ private:
     void SetMouseNavContextInternal(EMouseNavResult Result, const FVector& NavLocation, const FVector& CursorLocation, APawn* ClickedPawn);
     mutable FMouseNavServerCache MouseNavServerCache;
 
+    // Best-so-far fallback for ComputeSmartGoalForTarget when its query budget runs out.
+    mutable TWeakObjectPtr<AActor> SmartGoalFallbackTarget;
+    mutable FVector SmartGoalFallback = FVector::ZeroVector;
+
+    // Movement-intent stream (client side)
+    void SendCursorFollowGoal(const FVector& Goal);
+    void EndCursorFollowStream();
+    uint16 MoveIntentSequence = 0;
+    double LastMoveIntentSendTime = -1.0;
+    FVector LastSentMoveIntentGoal = FVector::ZeroVector;
+
+    // Movement-intent stream (server side)
+    bool AcceptMoveIntentSequence(uint16 Sequence);
+    void ApplyCursorFollowGoal(const FVector& Goal);
+    void ApplyPendingMoveIntent();
+    uint16 LastAcceptedMoveIntentSequence = 0;
+    bool bHasAcceptedMoveIntent = false;
+    FVector PendingMoveIntentGoal = FVector::ZeroVector;
+    bool bHasPendingMoveIntent = false;
+    double LastMoveIntentApplyTime = -1.0;
+    FTimerHandle MoveIntentApplyTimer;
+
+    // Mouse-nav context stream
+    bool AcceptMouseNavSequence(uint16 Sequence);
+    uint16 MouseNavSequence = 0;
+    double LastMouseNavSendTime = -1.0;
+    TWeakObjectPtr<APawn> LastSentMouseNavPawn;
+    EMouseNavResult LastSentMouseNavResult = EMouseNavResult::None;
+    FVector LastSentMouseNavLocation = FVector::ZeroVector;
+    uint16 LastAcceptedMouseNavSequence = 0;
+    bool bHasAcceptedMouseNav = false;
+
     /** If set, we keep issuing the sidestep goal until time elapses. */
     bool   bAvoidanceActive = false;
     FVector ActiveAvoidanceGoal = FVector::ZeroVector;
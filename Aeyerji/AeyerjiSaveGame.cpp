@@ -2,3 +2,16 @@
 
 
 #include "AeyerjiSaveGame.h"
+
+#include <atomic>
+
+uint64 UAeyerjiSaveGame::MakeSectionRevision()
+{
+	static std::atomic<uint64> NextRevision{1};
+	return NextRevision.fetch_add(1, std::memory_order_relaxed);
+}
+
+void UAeyerjiSaveGame::CopySectionRevisionsFrom(const UAeyerjiSaveGame& Other)
+{
+	FMemory::Memcpy(SectionRevisions, Other.SectionRevisions, sizeof(SectionRevisions));
+}
@@ -22,6 +22,22 @@ struct FAttrSnapshot
 	// add other scalar attributes as needed
 };
 
+/**
+ * Independently captured and serialized slices of UAeyerjiSaveGame.
+ * Each section is stored on disk with its own version header (see UAeyerjiSaveService).
+ */
+UENUM()
+enum class EAeyerjiSaveSection : uint8
+{
+	Inventory,
+	Attributes,
+	ActionBar,	// Action bar + selected passive.
+	LootStats,
+	RunRecords,	// Difficulty selection + best run times.
+	Count UMETA(Hidden)
+};
+ENUM_RANGE_BY_COUNT(EAeyerjiSaveSection, EAeyerjiSaveSection::Count);
+
 /**
  * 
  */
@@ -64,4 +80,24 @@ public:
 	/** Best (lowest) completed run time per difficulty slider key (0..1000, rounded). */
 	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category="Aeyerji|Run")
 	TMap<int32, float> BestRunTimeSecondsByDifficulty;
+
+	/* ---------- section bookkeeping (runtime only, never serialized) ---------- */
+
+	/** Process-unique revision; sources (inventory, loot stats) stamp their state with these. Never returns 0. */
+	static uint64 MakeSectionRevision();
+
+	/** Revision the section's content was captured at; 0 = unknown, must be captured and serialized. */
+	uint64 GetSectionRevision(EAeyerjiSaveSection Section) const { return SectionRevisions[static_cast<int32>(Section)]; }
+
+	/** Records that Section now holds content captured from a source at Revision. */
+	void SetSectionRevision(EAeyerjiSaveSection Section, uint64 Revision) { SectionRevisions[static_cast<int32>(Section)] = Revision; }
+
+	/** Stamps Section with a fresh revision after editing its fields directly. */
+	void MarkSectionChanged(EAeyerjiSaveSection Section) { SetSectionRevision(Section, MakeSectionRevision()); }
+
+	/** DuplicateObject only copies reflected properties; call this to carry the bookkeeping across. */
+	void CopySectionRevisionsFrom(const UAeyerjiSaveGame& Other);
+
+private:
+	uint64 SectionRevisions[static_cast<int32>(EAeyerjiSaveSection::Count)] = {};
 };
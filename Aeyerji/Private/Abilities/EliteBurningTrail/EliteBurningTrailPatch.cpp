@@ -14,6 +14,8 @@
 #include "GameFramework/Pawn.h"
 #include "Engine/World.h"
 #include "Logging/LogMacros.h"
+#include "Systems/AeyerjiDamagePipeline.h"
+#include "TimerManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogEliteBurningTrail, Log, All);
 
@@ -91,6 +93,17 @@ bool AEliteBurningTrailPatch::ApplyPatchDamage_Implementation(AActor* Target, fl
 		return false;
 	}
 
+	// Default magnitude and source ability match the cached spec: reuse it instead of building a new one
+	if (SourceASC && InDamagePerSecond == DamagePerSecond && InSourceAbility == SourceAbility.Get())
+	{
+		const FGameplayEffectSpecHandle& SharedSpec = GetOrBuildDamageSpec();
+		if (SharedSpec.IsValid() && SharedSpec.Data.IsValid())
+		{
+			SourceASC->ApplyGameplayEffectSpecToTarget(*SharedSpec.Data.Get(), TargetASC);
+			return true;
+		}
+	}
+
 	FGameplayEffectContextHandle ContextHandle = SpecASC->MakeEffectContext();
 	ContextHandle.AddSourceObject(this);
 	if (InSourceAbility)
@@ -118,6 +131,81 @@ bool AEliteBurningTrailPatch::ApplyPatchDamage_Implementation(AActor* Target, fl
 	return true;
 }
 
+const FGameplayEffectSpecHandle& AEliteBurningTrailPatch::GetOrBuildDamageSpec()
+{
+	if (CachedDamageSpec.IsValid())
+	{
+		return CachedDamageSpec;
+	}
+
+	UAbilitySystemComponent* SourceASC = InstigatorASC.Get();
+	if (!SourceASC || !DotEffectClass || DamagePerSecond <= 0.f)
+	{
+		return CachedDamageSpec;
+	}
+
+	FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
+	ContextHandle.AddSourceObject(this);
+	if (UGameplayAbility* Ability = SourceAbility.Get())
+	{
+		ContextHandle.AddSourceObject(Ability);
+	}
+
+	CachedDamageSpec = SourceASC->MakeOutgoingSpec(DotEffectClass, 1.f, ContextHandle);
+	if (CachedDamageSpec.IsValid() && CachedDamageSpec.Data.IsValid())
+	{
+		if (DamageSetByCallerTag.IsValid())
+		{
+			CachedDamageSpec.Data->SetSetByCallerMagnitude(DamageSetByCallerTag, DamagePerSecond);
+		}
+		if (DamageTypeTag.IsValid())
+		{
+			CachedDamageSpec.Data->AddDynamicAssetTag(DamageTypeTag);
+		}
+	}
+
+	return CachedDamageSpec;
+}
+
+void AEliteBurningTrailPatch::FlushPendingDamage()
+{
+	bDamageFlushScheduled = false;
+
+	TArray<AActor*, TInlineAllocator<8>> Targets;
+	for (const TWeakObjectPtr<AActor>& Weak : PendingDamageTargets)
+	{
+		if (AActor* Target = Weak.Get())
+		{
+			Targets.AddUnique(Target);
+		}
+	}
+	PendingDamageTargets.Reset();
+
+	if (Targets.Num() == 0 || IsActorBeingDestroyed())
+	{
+		return;
+	}
+
+	// Blueprint overrides keep their per-target hook
+	static const FName ApplyPatchDamageName = GET_FUNCTION_NAME_CHECKED(AEliteBurningTrailPatch, ApplyPatchDamage);
+	const bool bBlueprintOverride = GetClass()->IsFunctionImplementedInScript(ApplyPatchDamageName);
+
+	UAbilitySystemComponent* SourceASC = InstigatorASC.Get();
+	UAeyerjiDamagePipeline* Pipeline = UAeyerjiDamagePipeline::Get(this);
+	const FGameplayEffectSpecHandle& SharedSpec = GetOrBuildDamageSpec();
+
+	if (bBlueprintOverride || !Pipeline || !SourceASC || !SharedSpec.IsValid())
+	{
+		for (AActor* Target : Targets)
+		{
+			ApplyPatchDamage(Target, DamagePerSecond, SourceAbility.Get());
+		}
+		return;
+	}
+
+	Pipeline->ApplySpecToTargets(SourceASC, SharedSpec, Targets);
+}
+
 void AEliteBurningTrailPatch::InitializePatch(const FAGEliteBurningTrailTuning& InTuning,
                                               UAbilitySystemComponent* InInstigatorASC,
                                               const FGameplayTag& InDamageSetByCallerTag,
@@ -133,6 +221,7 @@ void AEliteBurningTrailPatch::InitializePatch(const FAGEliteBurningTrailTuning&
 	DotEffectClass = InDotEffectClass;
 	InstigatorASC = InInstigatorASC;
 	SourceAbility = InSourceAbility;
+	CachedDamageSpec = FGameplayEffectSpecHandle();
 
 	RefreshCollisionRadius();
 
@@ -305,5 +394,11 @@ void AEliteBurningTrailPatch::HandleDamageAreaBeginOverlap(UPrimitiveComponent*
 		}
 	}
 
-	ApplyPatchDamage(OtherActor, DamagePerSecond, SourceAbility.Get());
+	// Pawns walking in together (packs, AoE knockbacks) are applied as one batch next tick
+	PendingDamageTargets.Add(OtherActor);
+	if (!bDamageFlushScheduled)
+	{
+		bDamageFlushScheduled = true;
+		GetWorldTimerManager().SetTimerForNextTick(this, &AEliteBurningTrailPatch::FlushPendingDamage);
+	}
 }
@@ -8,7 +8,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "AeyerjiCharacter.h"
 #include "AeyerjiGameplayTags.h"
-#include "Abilities/AeyerjiRagdollHelpers.h"
+#include "Systems/AeyerjiDeathPresentationSubsystem.h"
 #include "GameFramework/GameModeBase.h"
 #include "Logging/AeyerjiLog.h"
 
@@ -76,7 +76,7 @@ void UGA_Death::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 			if (PlayLen <= 0.f)
 			{
 				// Fallback: no anim actually played -> ragdoll now
-				FAeyerjiRagdollHelpers::StartRagdoll(Char);
+				UAeyerjiDeathPresentationSubsystem::RequestRagdollFor(Char);
 				// give viewers time to see the fall
 				PlayLen = 1.25f;
 			}
@@ -86,7 +86,7 @@ void UGA_Death::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 				FOnMontageEnded OnEnd;
 				OnEnd.BindLambda([this, Char](UAnimMontage*, bool /*bInterrupted*/)
 				{
-					FAeyerjiRagdollHelpers::StartRagdoll(Char);
+					UAeyerjiDeathPresentationSubsystem::RequestRagdollFor(Char);
 				});
 				AnimInst->Montage_SetEndDelegate(OnEnd, DeathMontage);
 			}
@@ -100,7 +100,7 @@ void UGA_Death::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
 		else
 		{
 			// No montage → ragdoll immediately, then delay cleanup a bit
-			FAeyerjiRagdollHelpers::StartRagdoll(Char);
+			UAeyerjiDeathPresentationSubsystem::RequestRagdollFor(Char);
 			const float RagdollViewSeconds = FMath::Max(RespawnDelay, 0.f);
 			GetWorld()->GetTimerManager().SetTimer(
 				RespawnHandle, this, &UGA_Death::Server_FinishDeath,
@@ -226,6 +226,7 @@ void UGA_Death::Server_FinishDeath()
 	else
 	{
 		// Destroy after cancelling abilities to avoid ASC teardown during active callbacks.
+		// A body still on screen is handed to a pooled corpse from AAeyerjiCharacter::EndPlay.
 		DeadChar->Destroy();
 	}
 }
@@ -12,6 +12,7 @@
 #include "Attributes/AeyerjiAttributeSet.h"
 #include "Combat/PrimaryMeleeComboProviderInterface.h"
 #include "GAS/GE_DamagePhysical.h"
+#include "Systems/AeyerjiDamagePipeline.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectTypes.h"
 #include "MouseNavBlueprintLibrary.h"
@@ -21,6 +22,7 @@
 #include "GameFramework/Controller.h"
 #include "GameFramework/Pawn.h"
 #include "Enemy/AeyerjiEnemyArchetypeComponent.h"
+#include "Logging/AeyerjiLog.h"
 #include "Logging/LogMacros.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
@@ -33,10 +35,11 @@
 #include "WorldCollision.h"
 #include "Engine/OverlapResult.h"
 #include "Engine/HitResult.h"
+#include "Logging/AeyerjiStats.h"
 
 class AAeyerjiPlayerController;
 
-DEFINE_LOG_CATEGORY_STATIC(LogPrimaryMeleeGA, Display, All);
+DEFINE_LOG_CATEGORY_STATIC(LogPrimaryMeleeGA, Display, AJ_LOG_COMPILETIME_VERBOSITY);
 
 namespace
 {
@@ -573,6 +576,8 @@ void UGA_PrimaryMeleeBasic::TickConeStrike()
 
 void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_MeleeSweep);
+
 	if (!IsActive())
 	{
 		return;
@@ -580,7 +585,7 @@ void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 
 	if (CurrentPhase == EPrimaryMeleePhase::Cancelled || CurrentPhase == EPrimaryMeleePhase::Recovery)
 	{
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: Phase=%d, ignoring sweep."), static_cast<int32>(CurrentPhase));
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: Phase=%d, ignoring sweep.", static_cast<int32>(CurrentPhase));
 		return;
 	}
 
@@ -605,7 +610,7 @@ void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 
 		if (!bAllowFriendlyDamage && AbilityTeamUtils::AreOnSameTeam(InstigatorActor, TargetActor))
 		{
-			UE_LOG(LogPrimaryMeleeGA, VeryVerbose, TEXT("ExecuteConeTraceSweep: Ignoring same-team actor %s (Source=%s)."),
+			AJ_LOG_THROTTLED(LogPrimaryMeleeGA, VeryVerbose, this, "ExecuteConeTraceSweep: Ignoring same-team actor %s (Source=%s).",
 				*GetNameSafe(TargetActor),
 				SourceLabel);
 			return false;
@@ -614,7 +619,7 @@ void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 		TWeakObjectPtr<AActor> WeakTarget(TargetActor);
 		if (DamagedActors.Contains(WeakTarget))
 		{
-			UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: Skipping already damaged actor %s (Source=%s)."),
+			AJ_LOG_THROTTLED(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: Skipping already damaged actor %s (Source=%s).",
 				*GetNameSafe(TargetActor),
 				SourceLabel);
 			return false;
@@ -623,7 +628,7 @@ void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 		DamagedActors.Add(WeakTarget);
 		UniqueHits.Add(Hit);
 
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: Added hit on %s (Source=%s)."),
+		AJ_LOG_THROTTLED(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: Added hit on %s (Source=%s).",
 			*GetNameSafe(TargetActor),
 			SourceLabel);
 		return true;
@@ -648,7 +653,7 @@ void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 		}
 		else
 		{
-			UE_LOG(LogPrimaryMeleeGA, VeryVerbose, TEXT("ExecuteConeTraceSweep: Preferred target %s outside range %.1f (Source=%s)."),
+			AJ_LOG_THROTTLED(LogPrimaryMeleeGA, VeryVerbose, this, "ExecuteConeTraceSweep: Preferred target %s outside range %.1f (Source=%s).",
 				*GetNameSafe(PreferredTarget),
 				PreferredRange,
 				Source);
@@ -705,7 +710,7 @@ void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 			ConeHits,
 			bCachedHitShapeValid ? &CachedHitOrigin : nullptr,
 			bCachedHitShapeValid ? &CachedHitForward : nullptr);
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: Cone trace produced %d candidates (Range=%.1f Angle=%.1f)."),
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: Cone trace produced %d candidates (Range=%.1f Angle=%.1f).",
 			ConeHits.Num(),
 			ConeRange,
 			ConeAngle);
@@ -717,33 +722,33 @@ void UGA_PrimaryMeleeBasic::ExecuteConeTraceSweep()
 	}
 	else
 	{
-		UE_LOG(LogPrimaryMeleeGA, VeryVerbose,
-			TEXT("ExecuteConeTraceSweep: Cone trace skipped (Range=%.1f Angle=%.1f)."),
+		AJ_LOG_CAT(LogPrimaryMeleeGA, VeryVerbose, this,
+			"ExecuteConeTraceSweep: Cone trace skipped (Range=%.1f Angle=%.1f).",
 			ConeRange,
 			ConeAngle);
 	}
 
 	if (UniqueHits.Num() == 0)
 	{
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: No unique hits after filtering."));
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: No unique hits after filtering.");
 		return;
 	}
 
 	const FGameplayAbilityTargetDataHandle TargetData = MakeUniqueTargetData(UniqueHits);
-	UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: Generated target data with %d entries (ServerLogic=%s LocalPredict=%s)."),
+	AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: Generated target data with %d entries (ServerLogic=%s LocalPredict=%s).",
 		TargetData.Num(),
 		ShouldProcessServerLogic() ? TEXT("true") : TEXT("false"),
 		IsLocallyPredicting() ? TEXT("true") : TEXT("false"));
 
 	if (ShouldProcessServerLogic())
 	{
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: Invoking HandleServerDamage."));
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: Invoking HandleServerDamage.");
 		HandleServerDamage(TargetData);
 	}
 
 	if (IsLocallyPredicting())
 	{
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("ExecuteConeTraceSweep: Invoking HandlePredictedFeedback."));
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "ExecuteConeTraceSweep: Invoking HandlePredictedFeedback.");
 		HandlePredictedFeedback(TargetData);
 	}
 }
@@ -799,27 +804,20 @@ void UGA_PrimaryMeleeBasic::HandleServerDamage(const FGameplayAbilityTargetDataH
 {
 	if (TargetData.Num() == 0)
 	{
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: Empty target data."));
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "HandleServerDamage: Empty target data.");
 		return;
 	}
 
-	FString DamageClassStr;
-	if (DamageEffectClass.IsValid())
-	{
-		DamageClassStr = GetNameSafe(DamageEffectClass.Get());
-	}
-	else
-	{
-		DamageClassStr = DamageEffectClass.ToSoftObjectPath().ToString();
-	}
-
-	UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: Avatar=%s TargetCount=%d DamageEffect=%s"),
-		*GetNameSafe(GetAvatarActorFromActorInfo()),
-		TargetData.Num(),
-		*DamageClassStr);
+	UAbilitySystemComponent* SourceASC = GetCurrentActorInfo() ? GetCurrentActorInfo()->AbilitySystemComponent.Get() : nullptr;
+	UAeyerjiDamagePipeline* Pipeline = UAeyerjiDamagePipeline::Get(GetAvatarActorFromActorInfo());
 
+	// Pipeline caches the loaded class, so a soft reference only hits LoadSynchronous once per session.
 	TSubclassOf<UGameplayEffect> DamageGEClass;
-	if (DamageEffectClass.IsValid())
+	if (Pipeline)
+	{
+		DamageGEClass = Pipeline->ResolveEffectClass(DamageEffectClass);
+	}
+	else if (DamageEffectClass.IsValid())
 	{
 		DamageGEClass = DamageEffectClass.Get();
 	}
@@ -831,126 +829,97 @@ void UGA_PrimaryMeleeBasic::HandleServerDamage(const FGameplayAbilityTargetDataH
 	if (!DamageGEClass)
 	{
 		DamageGEClass = UGE_DamagePhysical::StaticClass();
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: DamageEffectClass not set; using UGE_DamagePhysical."));
 	}
 
-	if (DamageGEClass)
+	FGameplayEffectSpecHandle DamageSpec = MakeOutgoingGameplayEffectSpec(DamageGEClass, GetAbilityLevel());
+	if (!DamageSpec.IsValid() || !DamageSpec.Data.IsValid())
 	{
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: Using GE class %s at ability level %d."),
-			*GetNameSafe(DamageGEClass.GetDefaultObject()),
-			GetAbilityLevel());
-		FGameplayEffectSpecHandle DamageSpec = MakeOutgoingGameplayEffectSpec(DamageGEClass, GetAbilityLevel());
-		if (DamageSpec.IsValid() && DamageSpec.Data.IsValid())
-		{
-			ApplyDamageTypeTagToSpec(DamageSpec, DefaultDamageTypeTag);
+		UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: Failed to create damage spec from %s."), *GetNameSafe(DamageGEClass.Get()));
+		BP_HandleMeleeDamage(TargetData);
+		return;
+	}
+
+	ApplyDamageTypeTagToSpec(DamageSpec, DefaultDamageTypeTag);
 
-			// Push a SetByCaller magnitude so the gameplay effect can stay data-driven while still reflecting attributes.
-			if (DamageSetByCallerTag.IsValid())
+	// Push a SetByCaller magnitude so the gameplay effect can stay data-driven while still reflecting attributes.
+	float FinalDamage = 0.f;
+	if (DamageSetByCallerTag.IsValid())
+	{
+		float AttackDamageValue = 0.f;
+		if (SourceASC)
+		{
+			if (const UAeyerjiAttributeSet* Attr = SourceASC->GetSet<UAeyerjiAttributeSet>())
 			{
-				float AttackDamageValue = 0.f;
-				if (const UAbilitySystemComponent* ASC = GetCurrentActorInfo() ? GetCurrentActorInfo()->AbilitySystemComponent.Get() : nullptr)
-				{
-					if (const UAeyerjiAttributeSet* Attr = ASC->GetSet<UAeyerjiAttributeSet>())
-					{
-						AttackDamageValue = Attr->GetAttackDamage();
-					}
-				}
-				UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: AttackDamage attribute %.2f scalar %.2f final raw %.2f."),
-					AttackDamageValue,
-					DamageScalar,
-					AttackDamageValue * DamageScalar);
+				AttackDamageValue = Attr->GetAttackDamage();
+			}
+		}
 
-				if (AttackDamageValue <= 0.f)
-				{
-					UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: AttackDamage is %.2f; outgoing damage will be zero."), AttackDamageValue);
-				}
+		if (AttackDamageValue <= 0.f)
+		{
+			UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: AttackDamage is %.2f; outgoing damage will be zero."), AttackDamageValue);
+		}
 
-				const float FinalDamage = AttackDamageValue * DamageScalar;
+		FinalDamage = AttackDamageValue * DamageScalar;
+		DamageSpec.Data->SetSetByCallerMagnitude(DamageSetByCallerTag, FinalDamage);
+	}
+	else
+	{
+		UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: DamageSetByCallerTag is invalid; damage GE will rely on baked-in modifiers."));
+	}
 
-				DamageSpec.Data->SetSetByCallerMagnitude(DamageSetByCallerTag, FinalDamage);
-				UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: SetByCaller %s = %.2f."),
-					*DamageSetByCallerTag.ToString(),
-					FinalDamage);
-			}
-			else
-			{
-				UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: DamageSetByCallerTag is invalid; damage GE will rely on baked-in modifiers."));
-			}
+	if (Pipeline && SourceASC)
+	{
+		// Each target keeps its own hit result in the context; the activation's key ties the damage to this swing.
+		const FAeyerjiDamageBatchResult Result = Pipeline->ApplySpecToTargetData(
+			SourceASC, DamageSpec, TargetData, GetCurrentActivationInfo().GetActivationPredictionKey());
 
-			int32 TargetsWithASC = 0;
-			int32 TargetsWithoutASC = 0;
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "HandleServerDamage: GE=%s Raw=%.2f Hit=%d Skipped=%d Dealt=%.2f.",
+			*GetNameSafe(DamageGEClass.Get()),
+			FinalDamage,
+			Result.HitActors.Num(),
+			Result.TargetsSkipped,
+			Result.TotalDamage);
 
-			for (int32 DataIdx = 0; DataIdx < TargetData.Data.Num(); ++DataIdx)
+		// Dead and duplicate targets are expected skips; a hit actor without an ASC is a setup problem.
+		if (Result.TargetsSkipped > 0)
+		{
+			for (const TSharedPtr<FGameplayAbilityTargetData>& Data : TargetData.Data)
 			{
-				const TSharedPtr<FGameplayAbilityTargetData>& Data = TargetData.Data[DataIdx];
 				if (!Data.IsValid())
 				{
-					UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: TargetData[%d] invalid."), DataIdx);
 					continue;
 				}
 
-				const TArray<TWeakObjectPtr<AActor>> TargetActors = Data->GetActors();
-
-				if (TargetActors.Num() == 0)
-				{
-					UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: TargetData[%d] has no actors."), DataIdx);
-				}
-
-				for (const TWeakObjectPtr<AActor>& ActorPtr : TargetActors)
+				for (const TWeakObjectPtr<AActor>& ActorPtr : Data->GetActors())
 				{
 					AActor* TargetActor = ActorPtr.Get();
-					if (!TargetActor)
-					{
-						UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: Null actor in TargetData[%d]."), DataIdx);
-						continue;
-					}
-
-					UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor);
-					if (TargetASC)
-					{
-						++TargetsWithASC;
-						UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: Target %s will receive damage via ASC %s."),
-							*GetNameSafe(TargetActor),
-							*GetNameSafe(TargetASC));
-					}
-					else
+					if (TargetActor && !UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor))
 					{
-						++TargetsWithoutASC;
-						UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: Target %s has no ASC; damage will not apply."), *GetNameSafe(TargetActor));
+						AJ_LOG_THROTTLED(LogPrimaryMeleeGA, Warning, this, "HandleServerDamage: Target %s has no ASC; damage will not apply.",
+							*GetNameSafe(TargetActor));
 					}
 				}
 			}
-
-			UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: TargetsWithASC=%d TargetsWithoutASC=%d."),
-				TargetsWithASC,
-				TargetsWithoutASC);
-
-			// Apply once so GE stacking/mitigation happens inside the AbilitySystemComponent.
-			ApplyGameplayEffectSpecToTarget(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, DamageSpec, TargetData);
-		}
-		else
-		{
-			UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: Failed to create damage spec."));
 		}
 	}
 	else
 	{
-		UE_LOG(LogPrimaryMeleeGA, Warning, TEXT("HandleServerDamage: Damage effect class invalid; skipping damage application."));
+		// Apply once so GE stacking/mitigation happens inside the AbilitySystemComponent.
+		ApplyGameplayEffectSpecToTarget(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, DamageSpec, TargetData);
 	}
 
 	BP_HandleMeleeDamage(TargetData);
-	UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandleServerDamage: BP_HandleMeleeDamage dispatched."));
 }
 
 void UGA_PrimaryMeleeBasic::HandlePredictedFeedback(const FGameplayAbilityTargetDataHandle& TargetData)
 {
 	if (TargetData.Num() == 0)
 	{
-		UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandlePredictedFeedback: Empty target data."));
+		AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "HandlePredictedFeedback: Empty target data.");
 		return;
 	}
 
-	UE_LOG(LogPrimaryMeleeGA, Verbose, TEXT("HandlePredictedFeedback: Passing %d targets to blueprint."), TargetData.Num());
+	AJ_LOG_CAT(LogPrimaryMeleeGA, Verbose, this, "HandlePredictedFeedback: Passing %d targets to blueprint.", TargetData.Num());
 	BP_HandlePredictedMeleeHit(TargetData);
 }
 
@@ -1335,7 +1304,7 @@ FGameplayAbilityTargetDataHandle UGA_PrimaryMeleeBasic::MakeUniqueTargetData(con
 		// Bundle each filtered hit into a single-target data entry so downstream code can resolve ASC owners.
 		Handle.Add(new FGameplayAbilityTargetData_SingleTargetHit(Hit));
 	}
-	UE_LOG(LogPrimaryMeleeGA, VeryVerbose, TEXT("MakeUniqueTargetData: Created handle for %d hits."), Hits.Num());
+	AJ_LOG_CAT(LogPrimaryMeleeGA, VeryVerbose, this, "MakeUniqueTargetData: Created handle for %d hits.", Hits.Num());
 	return Handle;
 }
 
@@ -6,6 +6,7 @@
 #include "AbilitySystemGlobals.h"
 #include "AeyerjiGameplayTags.h"
 #include "GAS/GE_DamagePhysical.h"
+#include "Systems/AeyerjiDamagePipeline.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/Controller.h"
@@ -359,39 +360,25 @@ void UGA_AGGravitonPull::ApplyEffectsToTarget_Implementation(AActor* Target,
 	const bool  bApplyAilment = GravitonConfig ? GravitonConfig->Tunables.bApplyAilment : false;
 	const int32 AilmentStacks = GravitonConfig ? GravitonConfig->Tunables.AilmentStacks : 0;
 
-	// Damage
+	// Damage (single-target batch so it shares the pipeline's GE cache and aggregated damage event)
 	if (HitDamage > 0.f)
 	{
-		TSubclassOf<UGameplayEffect> ResolvedDamageClass = DamageEffectClass;
-		if (!ResolvedDamageClass)
-		{
-			ResolvedDamageClass = UGE_DamagePhysical::StaticClass();
-		}
-		if (!ResolvedDamageClass)
+		UAeyerjiDamagePipeline* Pipeline = UAeyerjiDamagePipeline::Get(World);
+		if (!Pipeline)
 		{
 			return;
 		}
 
-		FGameplayEffectContextHandle ContextHandle = SourceASC->MakeEffectContext();
-		ContextHandle.AddSourceObject(this);
+		FAeyerjiDamageSpecTemplate Template;
+		Template.EffectClass = DamageEffectClass.Get();
+		Template.Level = GetAbilityLevel();
+		Template.SetByCallerTag = DamageSetByCallerTag;
+		Template.Magnitude = HitDamage;
+		Template.DamageTypeTag = DefaultDamageTypeTag;
+		Template.SourceObject = const_cast<UGA_AGGravitonPull*>(this);
 
-		FGameplayEffectSpecHandle SpecHandle =
-			SourceASC->MakeOutgoingSpec(ResolvedDamageClass, GetAbilityLevel(), ContextHandle);
-
-		if (SpecHandle.IsValid() && SpecHandle.Data.IsValid())
-		{
-			ApplyDamageTypeTagToSpec(SpecHandle, DefaultDamageTypeTag);
-
-			const FGameplayTag DamageTag = DamageSetByCallerTag.IsValid()
-				? DamageSetByCallerTag
-				: FGameplayTag::RequestGameplayTag(TEXT("SetByCaller.Damage.Instant"), /*ErrorIfNotFound=*/false);
-			if (DamageTag.IsValid())
-			{
-				SpecHandle.Data->SetSetByCallerMagnitude(DamageTag, HitDamage);
-			}
-
-			TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-		}
+		AActor* const Targets[] = { Target };
+		Pipeline->ApplySpecToTargets(SourceASC, Pipeline->MakeSpecTemplate(SourceASC, Template), Targets);
 	}
 
 	// Slow
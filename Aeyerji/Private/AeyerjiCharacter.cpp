@@ -8,10 +8,12 @@
 #include "Attributes/AeyerjiStatEngineComponent.h"
 #include "CharacterStatsLibrary.h"
 #include "Components/ActorComponent.h"
+#include "Components/AeyerjiAbilityIndexComponent.h"
 #include "Components/AeyerjiPickupFXComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/CollisionProfile.h"
+#include "GAS/AeyerjiAbilitySystemComponent.h"
 #include "Engine/EngineTypes.h"
 #include "GUI/AeyerjiFloatingStatusBarComponent.h"
 #include "GameFramework/PlayerState.h"
@@ -19,9 +21,17 @@
 #include "Kismet/GameplayStatics.h"
 #include "Logging/AeyerjiLog.h"
 #include "AeyerjiGameplayTags.h"
+#include "Net/UnrealNetwork.h"
 #include "Perception/AIPerceptionStimuliSourceComponent.h"
+#include "Systems/AeyerjiDeathPresentationSubsystem.h"
 #include "TimerManager.h"
 
+namespace {
+// Grace period for the batched death event before a replicated bIsDead applies
+// the default death state on its own.
+constexpr float DeathEventFallbackDelay = 0.25f;
+} // namespace
+
 TArray<TWeakObjectPtr<AAeyerjiCharacter>>
     AAeyerjiCharacter::CorpsesPendingCleanup;
 AAeyerjiCharacter::AAeyerjiCharacter(
@@ -32,7 +42,7 @@ AAeyerjiCharacter::AAeyerjiCharacter(
   // ------------------------------------------------------------------
   // Ability System Component
   // ------------------------------------------------------------------
-  AbilitySystemAeyerji = CreateDefaultSubobject<UAbilitySystemComponent>(
+  AbilitySystemAeyerji = CreateDefaultSubobject<UAeyerjiAbilitySystemComponent>(
       TEXT("AbilitySystemAeyerji"));
   AbilitySystemAeyerji->SetIsReplicated(true);
   AbilitySystemAeyerji->SetReplicationMode(
@@ -44,6 +54,8 @@ AAeyerjiCharacter::AAeyerjiCharacter(
       CreateDefaultSubobject<UAeyerjiStatEngineComponent>(TEXT("StatEngine"));
   PickupFXComponent =
       CreateDefaultSubobject<UAeyerjiPickupFXComponent>(TEXT("PickupFXComponent"));
+  AbilityIndex =
+      CreateDefaultSubobject<UAeyerjiAbilityIndexComponent>(TEXT("AbilityIndex"));
 
   // Default death ability (can be overridden in BP)
   if (!DeathAbilityClass)
@@ -52,6 +64,12 @@ AAeyerjiCharacter::AAeyerjiCharacter(
   }
 }
 void AAeyerjiCharacter::BeginPlay() { Super::BeginPlay(); }
+void AAeyerjiCharacter::GetLifetimeReplicatedProps(
+    TArray<FLifetimeProperty> &OutLifetimeProps) const {
+  Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+  DOREPLIFETIME(AAeyerjiCharacter, bIsDead);
+  DOREPLIFETIME(AAeyerjiCharacter, DeathInfo);
+}
 /*void AAeyerjiCharacter::InitialiseAbilitySystem()
 {
         if (bASCInitialised || !AbilitySystemAeyerji) return;
@@ -162,7 +180,24 @@ void AAeyerjiCharacter::ApplyDeathState(FAeyerjiDeathStateOptions Options) {
   const bool bWasAlreadyDead = bHasAppliedDeathState;
   ApplyDeathStateInternal(Options);
   if (HasAuthority() && !bWasAlreadyDead) {
-    MulticastApplyDeathState(Options);
+    PublishDeath(Options, nullptr, 0.f, /*bNotifyDeath=*/false);
+  }
+}
+void AAeyerjiCharacter::PublishDeath(const FAeyerjiDeathStateOptions &Options,
+                                     AActor *Killer, float DamageTaken,
+                                     bool bNotifyDeath) {
+  // A net-dormant victim (sleeping cluster) would never send its death.
+  if (NetDormancy > DORM_Awake) {
+    SetNetDormancy(DORM_Awake);
+  }
+  DeathInfo.Killer = Killer;
+  DeathInfo.DamageTaken = DamageTaken;
+  DeathInfo.bNotifyDeath = bNotifyDeath;
+  bIsDead = true;
+  if (UAeyerjiDeathPresentationSubsystem *Presentation =
+          UAeyerjiDeathPresentationSubsystem::Get(this)) {
+    Presentation->QueueDeathEvent(FAeyerjiDeathEvent::Make(
+        this, Killer, DamageTaken, Options, bNotifyDeath));
   }
 }
 void AAeyerjiCharacter::ApplyDeathStateInternal(
@@ -268,11 +303,13 @@ void AAeyerjiCharacter::ApplyDeathStateInternal(
     Capsule->SetGenerateOverlapEvents(false);
   }
 
-  FAeyerjiRagdollHelpers::StartRagdoll(this, Options.Impulse,
-                                       Options.ImpulseWorldLocation,
-                                       Options.ImpulseBoneName);
+  // Capped and pooled locally; dedicated servers skip the physics entirely.
+  const bool bRagdolled = UAeyerjiDeathPresentationSubsystem::RequestRagdollFor(
+      this, Options.Impulse, Options.ImpulseWorldLocation,
+      Options.ImpulseBoneName);
 
-  if (USkeletalMeshComponent *MeshComponent = GetMesh())
+  USkeletalMeshComponent *MeshComponent = bRagdolled ? GetMesh() : nullptr;
+  if (MeshComponent)
 
   {
 
@@ -295,8 +332,7 @@ void AAeyerjiCharacter::ApplyDeathStateInternal(
   }
 }
 
-void AAeyerjiCharacter::MulticastApplyDeathState_Implementation(
-    FAeyerjiDeathStateOptions Options)
+void AAeyerjiCharacter::ApplyDeathEvent(const FAeyerjiDeathEvent &Event)
 
 {
 
@@ -307,20 +343,68 @@ void AAeyerjiCharacter::MulticastApplyDeathState_Implementation(
     return;
   }
 
-  ApplyDeathStateInternal(Options);
+  GetWorldTimerManager().ClearTimer(DeathStateFallbackHandle);
+
+  ApplyDeathStateInternal(Event.ToOptions());
+
+  if (Event.ShouldNotifyDeath())
+
+  {
+
+    NotifyDeathOnce(Event.Killer, Event.DamageTaken);
+  }
 }
 
-void AAeyerjiCharacter::MulticastOnDeath_Implementation(AActor *Killer, float DamageTaken)
+void AAeyerjiCharacter::OnRep_IsDead()
 
 {
 
-  if (HasAuthority())
+  if (!bIsDead || (bHasAppliedDeathState && (bHasNotifiedDeath || !DeathInfo.bNotifyDeath)))
 
   {
 
     return;
   }
 
+  // Usually the batch entry lands in the same frame; only step in if it was dropped.
+  GetWorldTimerManager().SetTimer(
+      DeathStateFallbackHandle, this,
+      &AAeyerjiCharacter::ApplyDeathStateFallback, DeathEventFallbackDelay,
+      false);
+}
+
+void AAeyerjiCharacter::ApplyDeathStateFallback()
+
+{
+
+  if (!bHasAppliedDeathState)
+
+  {
+
+    ApplyDeathStateInternal(FAeyerjiDeathStateOptions());
+  }
+
+  if (DeathInfo.bNotifyDeath)
+
+  {
+
+    NotifyDeathOnce(DeathInfo.Killer, DeathInfo.DamageTaken);
+  }
+}
+
+void AAeyerjiCharacter::NotifyDeathOnce(AActor *Killer, float DamageTaken)
+
+{
+
+  if (bHasNotifiedDeath)
+
+  {
+
+    return;
+  }
+
+  bHasNotifiedDeath = true;
+
   BP_OnDeath(Killer, DamageTaken);
 }
 
@@ -533,9 +617,9 @@ void AAeyerjiCharacter::HandleOutOfHealth(AActor *Victim, AActor *Killer, float
   ensureMsgf(Victim == this || !Victim,
              TEXT("HandleOutOfHealth expected self victim but got %s"),
              *GetNameSafe(Victim));
-  BP_OnDeath(Killer, DamageTaken);
+  NotifyDeathOnce(Killer, DamageTaken);
   FAeyerjiDeathStateOptions DeathOptions;
-  ApplyDeathState(DeathOptions);
+  ApplyDeathStateInternal(DeathOptions);
   if (HasAuthority() && AbilitySystemAeyerji)
   {
     TSubclassOf<UGameplayAbility> DeathClass = DeathAbilityClass ? DeathAbilityClass : TSubclassOf<UGameplayAbility>(UGA_Death::StaticClass());
@@ -560,7 +644,7 @@ void AAeyerjiCharacter::HandleOutOfHealth(AActor *Victim, AActor *Killer, float
     }
   }
   if (HasAuthority()) {
-    MulticastOnDeath(Killer, DamageTaken);
+    PublishDeath(DeathOptions, Killer, DamageTaken, /*bNotifyDeath=*/true);
   }
 }
 void AAeyerjiCharacter::OnRep_Controller() {
@@ -572,6 +656,14 @@ void AAeyerjiCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason) {
     UnregisterCorpseFromCleanup();
   }
   GetWorldTimerManager().ClearTimer(RagdollCollisionDisableHandle);
+  GetWorldTimerManager().ClearTimer(DeathStateFallbackHandle);
+  if (EndPlayReason == EEndPlayReason::Destroyed) {
+    // Hand a still-simulating ragdoll over to a pooled corpse before the actor goes away.
+    if (UAeyerjiDeathPresentationSubsystem *Presentation =
+            UAeyerjiDeathPresentationSubsystem::Get(this)) {
+      Presentation->HandleCharacterRemoved(this);
+    }
+  }
   Super::EndPlay(EndPlayReason);
 }
 void AAeyerjiCharacter::DetachDestroyAttachedActors() {
@@ -589,4 +681,37 @@ void AAeyerjiCharacter::DetachDestroyAttachedActors() {
     }
   }
 }
-
+FAeyerjiDeathEvent FAeyerjiDeathEvent::Make(AAeyerjiCharacter *InVictim,
+                                            AActor *InKiller,
+                                            float InDamageTaken,
+                                            const FAeyerjiDeathStateOptions &Options,
+                                            bool bNotifyDeath) {
+  FAeyerjiDeathEvent Event;
+  Event.Victim = InVictim;
+  Event.Killer = InKiller;
+  Event.DamageTaken = InDamageTaken;
+  Event.RagdollCollisionDisableDelay = Options.RagdollCollisionDisableDelay;
+  Event.Impulse = Options.Impulse;
+  Event.ImpulseWorldLocation = Options.ImpulseWorldLocation;
+  Event.ImpulseBoneName = Options.ImpulseBoneName;
+  Event.Flags = static_cast<uint8>(
+      (Options.bDetachAttachments ? Flag_DetachAttachments : 0) |
+      (Options.bRemoveFloatingWidgets ? Flag_RemoveFloatingWidgets : 0) |
+      (Options.bDisableRagdollCollision ? Flag_DisableRagdollCollision : 0) |
+      (bNotifyDeath ? Flag_NotifyDeath : 0));
+  return Event;
+}
+FAeyerjiDeathStateOptions FAeyerjiDeathEvent::ToOptions() const {
+  FAeyerjiDeathStateOptions Options;
+  Options.bDetachAttachments = (Flags & Flag_DetachAttachments) != 0;
+  Options.bRemoveFloatingWidgets = (Flags & Flag_RemoveFloatingWidgets) != 0;
+  Options.bDisableRagdollCollision = (Flags & Flag_DisableRagdollCollision) != 0;
+  Options.RagdollCollisionDisableDelay = RagdollCollisionDisableDelay;
+  Options.Impulse = Impulse;
+  Options.ImpulseWorldLocation = ImpulseWorldLocation;
+  Options.ImpulseBoneName = ImpulseBoneName;
+  // Regeneration and corpse cleanup are server-side only.
+  Options.bStopRegeneration = false;
+  Options.bRegisterCorpseForCleanup = false;
+  return Options;
+}
@@ -5,6 +5,7 @@
 #include "AbilitySystemInterface.h"
 #include "GameplayEffect.h"
 #include "TimerManager.h"
+#include "Algo/AllOf.h"
 
 #include "Attributes/AeyerjiAttributeSet.h"
 #include "Attributes/GE_SecondaryStatsFromPrimaries.h"
@@ -132,9 +133,53 @@ void UAeyerjiStatEngineComponent::SubscribeToPrimaries()
 
 void UAeyerjiStatEngineComponent::OnPrimaryChanged(const FOnAttributeChangeData& /*Data*/)
 {
+    // Equipping an item can move several primaries in one frame; refresh once after all of them have landed.
+    if (bDerivedRefreshQueued)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        bDerivedRefreshQueued = true;
+        World->GetTimerManager().SetTimerForNextTick(this, &UAeyerjiStatEngineComponent::FlushDerivedRefresh);
+    }
+    else
+    {
+        ReapplyDerivedEffect();
+    }
+}
+
+void UAeyerjiStatEngineComponent::FlushDerivedRefresh()
+{
+    bDerivedRefreshQueued = false;
     ReapplyDerivedEffect();
 }
 
+void UAeyerjiStatEngineComponent::ComputeDerivedMagnitudes(const UAeyerjiAttributeSet& Attr, TMap<FGameplayTag, float>& OutMagnitudes) const
+{
+    const UAeyerjiAttributeTuning* Tuning = UAeyerjiStatSettings::Get();
+    FAeyerjiPrimaryToDerivedTuning Rules; // defaults
+    if (Tuning) { Rules = Tuning->Rules; }
+
+    const float Strength  = FMath::Max(0.f, Attr.GetStrength());
+    const float Agility   = FMath::Max(0.f, Attr.GetAgility());
+    const float Intellect = FMath::Max(0.f, Attr.GetIntellect());
+    const float Ailment   = FMath::Max(0.f, Attr.GetAilment());
+
+    OutMagnitudes.Reset();
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_HPMax,           Strength * Rules.StrengthToHP);
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_Armor,           Strength * Rules.StrengthToArmor);
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_DodgeChance,     FMath::Clamp(Agility * Rules.AgilityToDodgeChance, 0.f, 1.f));
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_AttackSpeed,     FMath::Max(0.f, Agility * Rules.AgilityToAttackSpeed));
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_SpellPower,      FMath::Max(0.f, Intellect * Rules.IntellectToSpellPower));
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_ManaMax,         FMath::Max(0.f, Intellect * Rules.IntellectToManaMax));
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_ManaRegen,       FMath::Max(0.f, Intellect * Rules.IntellectToManaRegen));
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_HPRegen,         FMath::Max(0.f, Strength  * Rules.StrengthToHPRegen));
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_AilmentDPS,      FMath::Max(0.f, Ailment   * Rules.AilmentToDPS));
+    OutMagnitudes.Add(AeyerjiTags::SBC_PrimaryDerived_AilmentDuration, FMath::Max(0.f, Ailment   * Rules.AilmentToDuration));
+}
+
 void UAeyerjiStatEngineComponent::ReapplyDerivedEffect()
 {
     UAbilitySystemComponent* ASC = GetASC();
@@ -144,49 +189,44 @@ void UAeyerjiStatEngineComponent::ReapplyDerivedEffect()
         return;
     }
 
-    if (ActiveDerivedHandle.IsValid())
+    TMap<FGameplayTag, float> Magnitudes;
+    ComputeDerivedMagnitudes(*Attr, Magnitudes);
+
+    // The effect can be stripped externally (e.g. death cleanup); only trust the handle while it is still active.
+    const bool bDerivedActive = ActiveDerivedHandle.IsValid() && ASC->GetActiveGameplayEffect(ActiveDerivedHandle) != nullptr;
+    if (bDerivedActive)
     {
-        ASC->RemoveActiveGameplayEffect(ActiveDerivedHandle);
-        ActiveDerivedHandle.Invalidate();
+        const bool bUnchanged = Magnitudes.Num() == AppliedDerivedMagnitudes.Num()
+            && Algo::AllOf(Magnitudes, [this](const TPair<FGameplayTag, float>& Pair)
+            {
+                const float* Applied = AppliedDerivedMagnitudes.Find(Pair.Key);
+                return Applied && FMath::IsNearlyEqual(*Applied, Pair.Value);
+            });
+        if (bUnchanged)
+        {
+            return;
+        }
+
+        // Rewrites the spec magnitudes and re-aggregates the modifiers without a remove/apply cycle.
+        ASC->UpdateActiveGameplayEffectSetByCallerMagnitudes(ActiveDerivedHandle, Magnitudes);
+        AppliedDerivedMagnitudes = MoveTemp(Magnitudes);
+        return;
     }
 
+    ActiveDerivedHandle.Invalidate();
+
     FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
     Ctx.AddSourceObject(GetOwner());
     FGameplayEffectSpecHandle SH = ASC->MakeOutgoingSpec(DerivedEffectClass, /*Level*/1.f, Ctx);
     if (!SH.IsValid()) return;
 
-    const UAeyerjiAttributeTuning* Tuning = UAeyerjiStatSettings::Get();
-    FAeyerjiPrimaryToDerivedTuning Rules; // defaults
-    if (Tuning) { Rules = Tuning->Rules; }
-
-    const float Strength  = FMath::Max(0.f, Attr->GetStrength());
-    const float Agility   = FMath::Max(0.f, Attr->GetAgility());
-    const float Intellect = FMath::Max(0.f, Attr->GetIntellect());
-    const float Ailment   = FMath::Max(0.f, Attr->GetAilment());
-
-    const float HpFromStr      = Strength  * Rules.StrengthToHP;
-    const float ArmorFromStr   = Strength  * Rules.StrengthToArmor;
-    const float DodgeFromAgi   = FMath::Clamp(Agility * Rules.AgilityToDodgeChance, 0.f, 1.f);
-    const float ASFromAgi      = FMath::Max(0.f, Agility * Rules.AgilityToAttackSpeed);
-    const float SpellFromInt   = FMath::Max(0.f, Intellect * Rules.IntellectToSpellPower);
-    const float ManaFromInt    = FMath::Max(0.f, Intellect * Rules.IntellectToManaMax);
-    const float ManaRegenFromInt = FMath::Max(0.f, Intellect * Rules.IntellectToManaRegen);
-    const float HPRegenFromStr   = FMath::Max(0.f, Strength  * Rules.StrengthToHPRegen);
-    const float AilmentDPS     = FMath::Max(0.f, Ailment   * Rules.AilmentToDPS);
-    const float AilmentDur     = FMath::Max(0.f, Ailment   * Rules.AilmentToDuration);
-
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_HPMax,           HpFromStr);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_Armor,           ArmorFromStr);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_DodgeChance,     DodgeFromAgi);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_AttackSpeed,     ASFromAgi);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_SpellPower,      SpellFromInt);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_ManaMax,         ManaFromInt);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_ManaRegen,       ManaRegenFromInt);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_HPRegen,         HPRegenFromStr);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_AilmentDPS,      AilmentDPS);
-    SH.Data->SetSetByCallerMagnitude(AeyerjiTags::SBC_PrimaryDerived_AilmentDuration, AilmentDur);
+    for (const TPair<FGameplayTag, float>& Pair : Magnitudes)
+    {
+        SH.Data->SetSetByCallerMagnitude(Pair.Key, Pair.Value);
+    }
 
     ActiveDerivedHandle = ASC->ApplyGameplayEffectSpecToSelf(*SH.Data.Get());
+    AppliedDerivedMagnitudes = MoveTemp(Magnitudes);
 }
 
 void UAeyerjiStatEngineComponent::StopRegeneration()
@@ -1,6 +1,8 @@
 // File: Source/Aeyerji/Private/Attributes/AeyerjiStatTuning.cpp
 #include "Attributes/AeyerjiStatTuning.h"
 
+#include <atomic>
+
 UAeyerjiStatSettings::UAeyerjiStatSettings() {}
 
 const UAeyerjiAttributeTuning* UAeyerjiStatSettings::Get()
@@ -16,3 +18,32 @@ const UAeyerjiAttributeTuning* UAeyerjiStatSettings::Get()
     }
     return Settings->DefaultTuning.LoadSynchronous();
 }
+
+namespace
+{
+    std::atomic<uint32> GAeyerjiTuningRevision{1};
+}
+
+uint32 UAeyerjiStatSettings::GetTuningRevision()
+{
+    return GAeyerjiTuningRevision.load(std::memory_order_relaxed);
+}
+
+void UAeyerjiStatSettings::NotifyTuningChanged()
+{
+    GAeyerjiTuningRevision.fetch_add(1, std::memory_order_relaxed);
+}
+
+#if WITH_EDITOR
+void UAeyerjiStatSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    NotifyTuningChanged();
+}
+
+void UAeyerjiAttributeTuning::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    UAeyerjiStatSettings::NotifyTuningChanged();
+}
+#endif
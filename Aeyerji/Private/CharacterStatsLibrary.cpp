@@ -25,10 +25,12 @@
 #include "Microsoft/AllowMicrosoftPlatformTypes.h"
 #include "GameplayTagContainer.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Components/AeyerjiAbilityIndexComponent.h"
 #include "Items/InventoryComponent.h"
 #include "Items/ItemDefinition.h"
 #include "Player/PlayerStatsTrackingComponent.h"
 #include "Systems/LootService.h"
+#include "Systems/AeyerjiSaveService.h"
 #include "Engine/AssetManager.h"
 #include "Engine/World.h"
 
@@ -226,6 +228,27 @@ namespace
 		return CachedToken;
 	}
 
+	bool AbilitySlotsMatch(const TArray<FAeyerjiAbilitySlot> &A, const TArray<FAeyerjiAbilitySlot> &B)
+	{
+		if (A.Num() != B.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < A.Num(); ++Index)
+		{
+			const FAeyerjiAbilitySlot &SlotA = A[Index];
+			const FAeyerjiAbilitySlot &SlotB = B[Index];
+			if (SlotA.Class != SlotB.Class || SlotA.Level != SlotB.Level || SlotA.TargetMode != SlotB.TargetMode ||
+				SlotA.Description != SlotB.Description || SlotA.Icon != SlotB.Icon || SlotA.Tag != SlotB.Tag)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
 }
 
 bool UCharacterStatsLibrary::GetAeyerjiStatFromActor(const AActor *Actor, EAeyerjiStat Stat, float &OutValue)
@@ -409,7 +432,18 @@ UAeyerjiSaveGame *UCharacterStatsLibrary::LoadOrCreateAeyerjiSave(const FString
 
 	UAeyerjiSaveGame *Data = nullptr;
 
-	if (!Slot.IsEmpty() && UGameplayStatics::DoesSaveGameExist(Slot, 0))
+	UAeyerjiSaveService *SaveService = UAeyerjiSaveService::Get();
+
+	if (SaveService && !Slot.IsEmpty())
+
+	{
+
+		// Serves pending writes from memory and decodes the sectioned slot format (plus legacy files).
+		Data = SaveService->LoadSave(Slot);
+		bOutLoadedFromDisk = Data != nullptr;
+	}
+
+	else if (!Slot.IsEmpty() && UGameplayStatics::DoesSaveGameExist(Slot, 0))
 
 	{
 
@@ -446,37 +480,46 @@ UAeyerjiSaveGame *UCharacterStatsLibrary::LoadOrCreateAeyerjiSave(const FString
 
 	{
 
-		Data = Cast<UAeyerjiSaveGame>(UGameplayStatics::CreateSaveGameObject(UAeyerjiSaveGame::StaticClass()));
+		return CreateAeyerjiSave(Slot);
+	}
 
-		if (!Data)
+	else
 
-		{
+	{
 
-			UE_LOG(LogTemp, Error, TEXT("LoadOrCreateAeyerjiSave: Failed to create save object for slot %s."), *Slot);
+		const FString AbsoluteFilename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), Slot + TEXT(".sav"));
 
-			return nullptr;
-		}
+		UE_LOG(LogTemp, Verbose, TEXT("LoadOrCreateAeyerjiSave: Loaded existing save from slot %s (%s)."), *Slot, *AbsoluteFilename);
+		UE_LOG(LogTemp, Display, TEXT("LoadOrCreateAeyerjiSave: Existing slot %s currently has XP=%f Level=%d"), *Slot, Data->Attributes.XP, Data->Attributes.Level);
+	}
 
-		Data->ActionBar.Reset();
-		Data->Attributes = FAttrSnapshot();
-		Data->Inventory = FAeyerjiInventorySaveData();
+	return Data;
+}
 
-		const FString AbsoluteFilename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), Slot + TEXT(".sav"));
+UAeyerjiSaveGame *UCharacterStatsLibrary::CreateAeyerjiSave(const FString &Slot)
 
-		UE_LOG(LogTemp, Log, TEXT("LoadOrCreateAeyerjiSave: Created new save object for slot %s (%s)."), *Slot, *AbsoluteFilename);
-		UE_LOG(LogTemp, Display, TEXT("LoadOrCreateAeyerjiSave: Initialized new slot %s with XP=%f Level=%d"), *Slot, Data->Attributes.XP, Data->Attributes.Level);
-	}
+{
 
-	else
+	UAeyerjiSaveGame *Data = Cast<UAeyerjiSaveGame>(UGameplayStatics::CreateSaveGameObject(UAeyerjiSaveGame::StaticClass()));
+
+	if (!Data)
 
 	{
 
-		const FString AbsoluteFilename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), Slot + TEXT(".sav"));
+		UE_LOG(LogTemp, Error, TEXT("CreateAeyerjiSave: Failed to create save object for slot %s."), *Slot);
 
-		UE_LOG(LogTemp, Verbose, TEXT("LoadOrCreateAeyerjiSave: Loaded existing save from slot %s (%s)."), *Slot, *AbsoluteFilename);
-		UE_LOG(LogTemp, Display, TEXT("LoadOrCreateAeyerjiSave: Existing slot %s currently has XP=%f Level=%d"), *Slot, Data->Attributes.XP, Data->Attributes.Level);
+		return nullptr;
 	}
 
+	Data->ActionBar.Reset();
+	Data->Attributes = FAttrSnapshot();
+	Data->Inventory = FAeyerjiInventorySaveData();
+
+	const FString AbsoluteFilename = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"), Slot + TEXT(".sav"));
+
+	UE_LOG(LogTemp, Log, TEXT("CreateAeyerjiSave: Created new save object for slot %s (%s)."), *Slot, *AbsoluteFilename);
+	UE_LOG(LogTemp, Display, TEXT("CreateAeyerjiSave: Initialized new slot %s with XP=%f Level=%d"), *Slot, Data->Attributes.XP, Data->Attributes.Level);
+
 	return Data;
 }
 
@@ -688,19 +731,30 @@ void UCharacterStatsLibrary::SaveAeyerjiChar(
 		return;
 	}
 
+	// Each section is only re-captured (and re-serialized by the save service) when its source changed.
+	// A section revision of 0 means Data has never been captured for it.
+
 	// Capture the current difficulty slider for persistence.
-	Data->bHasDifficultySelection = false;
+	bool bHasDifficultySelection = false;
+	float DifficultySlider = Data->DifficultySlider;
 	if (PS->GetWorld())
 	{
 		if (const UAeyerjiGameInstance* GI = Cast<UAeyerjiGameInstance>(PS->GetWorld()->GetGameInstance()))
 		{
 			if (GI->HasDifficultySelection())
 			{
-				Data->DifficultySlider = GI->GetDifficultySlider();
-				Data->bHasDifficultySelection = true;
+				DifficultySlider = GI->GetDifficultySlider();
+				bHasDifficultySelection = true;
 			}
 		}
 	}
+	if (Data->GetSectionRevision(EAeyerjiSaveSection::RunRecords) == 0 ||
+		Data->bHasDifficultySelection != bHasDifficultySelection || Data->DifficultySlider != DifficultySlider)
+	{
+		Data->bHasDifficultySelection = bHasDifficultySelection;
+		Data->DifficultySlider = DifficultySlider;
+		Data->MarkSectionChanged(EAeyerjiSaveSection::RunRecords);
+	}
 
 	const APawn *Pawn = PS->GetPawn();
 
@@ -710,10 +764,19 @@ void UCharacterStatsLibrary::SaveAeyerjiChar(
 
 		if (UAeyerjiInventoryComponent *Inventory = Pawn->FindComponentByClass<UAeyerjiInventoryComponent>())
 		{
-			Data->Inventory = Inventory->BuildSaveData();
-			UE_LOG(LogTemp, Display, TEXT("SaveAeyerjiChar: Captured inventory with %d items, %d placements"),
-				   Data->Inventory.ItemSnapshots.Num(),
-				   Data->Inventory.GridPlacements.Num());
+			const uint64 InventoryRevision = Inventory->GetSaveRevision();
+			if (Data->GetSectionRevision(EAeyerjiSaveSection::Inventory) != InventoryRevision)
+			{
+				Data->Inventory = Inventory->BuildSaveData();
+				Data->SetSectionRevision(EAeyerjiSaveSection::Inventory, InventoryRevision);
+				UE_LOG(LogTemp, Display, TEXT("SaveAeyerjiChar: Captured inventory with %d items, %d placements"),
+					   Data->Inventory.ItemSnapshots.Num(),
+					   Data->Inventory.GridPlacements.Num());
+			}
+			else
+			{
+				UE_LOG(LogTemp, Verbose, TEXT("SaveAeyerjiChar: Inventory unchanged since last capture; reusing section"));
+			}
 		}
 		else
 		{
@@ -740,11 +803,17 @@ void UCharacterStatsLibrary::SaveAeyerjiChar(
 
 						UE_LOG(LogTemp, Log, TEXT("SaveAeyerjiChar: Found Attribute XP found '%f'"), AeyerjiSet->GetXP());
 
-						Data->Attributes.XP = AeyerjiSet->GetXP();
+						const float XP = AeyerjiSet->GetXP();
 
-						Data->Attributes.Level = FMath::RoundToInt(AeyerjiSet->GetLevel());
+						const int32 Level = FMath::RoundToInt(AeyerjiSet->GetLevel());
 
-						Data->Attributes.Level = FMath::RoundToInt(AeyerjiSet->GetLevel());
+						if (Data->GetSectionRevision(EAeyerjiSaveSection::Attributes) == 0 ||
+							Data->Attributes.XP != XP || Data->Attributes.Level != Level)
+						{
+							Data->Attributes.XP = XP;
+							Data->Attributes.Level = Level;
+							Data->MarkSectionChanged(EAeyerjiSaveSection::Attributes);
+						}
 					}
 				}
 			}
@@ -753,7 +822,12 @@ void UCharacterStatsLibrary::SaveAeyerjiChar(
 
 	if (const UPlayerStatsTrackingComponent* StatsComp = PS->FindComponentByClass<UPlayerStatsTrackingComponent>())
 	{
-		StatsComp->ExtractLootStats(Data->LootStats);
+		const uint64 LootStatsRevision = StatsComp->GetSaveRevision();
+		if (Data->GetSectionRevision(EAeyerjiSaveSection::LootStats) != LootStatsRevision)
+		{
+			StatsComp->ExtractLootStats(Data->LootStats);
+			Data->SetSectionRevision(EAeyerjiSaveSection::LootStats, LootStatsRevision);
+		}
 	}
 	else
 	{
@@ -762,8 +836,14 @@ void UCharacterStatsLibrary::SaveAeyerjiChar(
 
 	// Save action bar data
 
-	Data->ActionBar = PS->ActionBar;
-	Data->SelectedPassiveId = PS->GetSelectedPassiveId();
+	const FName SelectedPassiveId = PS->GetSelectedPassiveId();
+	if (Data->GetSectionRevision(EAeyerjiSaveSection::ActionBar) == 0 ||
+		Data->SelectedPassiveId != SelectedPassiveId || !AbilitySlotsMatch(Data->ActionBar, PS->ActionBar))
+	{
+		Data->ActionBar = PS->ActionBar;
+		Data->SelectedPassiveId = SelectedPassiveId;
+		Data->MarkSectionChanged(EAeyerjiSaveSection::ActionBar);
+	}
 
 	UE_LOG(LogTemp, Display, TEXT("SaveAeyerjiChar(BeforeWrite): Slot=%s PS=%s Pawn=%s DataXP=%f DataLevel=%d"),
 		   *Slot,
@@ -807,6 +887,23 @@ void UCharacterStatsLibrary::SaveAeyerjiChar(
 
 	// extend the struct with CharacterId etc.
 
+	// Snapshot now, serialize + write on a background task; bursts of saves to the same slot are coalesced.
+	if (UAeyerjiSaveService *SaveService = UAeyerjiSaveService::Get())
+	{
+		if (SaveService->RequestSave(Data, Slot))
+		{
+			UE_LOG(LogTemp, Display, TEXT("SaveAeyerjiChar(Queued): Slot=%s XP=%f Level=%d"),
+				   *Slot,
+				   Data->Attributes.XP,
+				   Data->Attributes.Level);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Save failed for slot %s"), *Slot);
+		}
+		return;
+	}
+
 	if (!UGameplayStatics::SaveGameToSlot(Data, Slot, 0))
 
 	{
@@ -854,6 +951,17 @@ FGameplayTag UCharacterStatsLibrary::GetLeafTagFromBranchTag(const UAbilitySyste
 		return BranchTag; // fallback
 	}
 
+	// Characters carry a cached index; the scan below only serves ASCs on actors without one.
+
+	if (UAeyerjiAbilityIndexComponent *Index = UAeyerjiAbilityIndexComponent::Get(ASC))
+
+	{
+
+		FGameplayTag Leaf;
+
+		return Index->FindLeafTag(BranchTag, Leaf) ? Leaf : BranchTag;
+	}
+
 	FGameplayTag BestTag; // invalid means "not found yet"
 
 	int32 BestDepth = -1;
@@ -943,19 +1051,7 @@ FGameplayTag UCharacterStatsLibrary::GetLeafTagFromBranchTag_Container(const UAb
 
 	// Use the first tag in the container as the branch.
 
-	FGameplayTag Branch;
-
-	{
-
-		TArray<FGameplayTag> Arr;
-
-		BranchTags.GetGameplayTagArray(Arr);
-
-		if (Arr.Num() > 0)
-		{
-			Branch = Arr[0];
-		}
-	}
+	const FGameplayTag Branch = BranchTags.IsEmpty() ? FGameplayTag() : BranchTags.First();
 
 	return GetLeafTagFromBranchTag(ASC, Branch);
 }
@@ -1083,6 +1179,13 @@ TSubclassOf<UGameplayAbility> UCharacterStatsLibrary::GetAbilityClassForBranchTa
 
 {
 
+	if (UAeyerjiAbilityIndexComponent *Index = UAeyerjiAbilityIndexComponent::Get(ASC))
+
+	{
+
+		return BranchTag.IsValid() ? Index->FindAbilityClass(BranchTag) : nullptr;
+	}
+
 	FGameplayTag Leaf;
 
 	if (const FGameplayAbilitySpec *Spec = FindBestSpecForBranchTag(ASC, BranchTag, Leaf))
@@ -1101,6 +1204,13 @@ UGameplayAbility *UCharacterStatsLibrary::GetAbilityCDOForBranchTag(
 
 {
 
+	if (UAeyerjiAbilityIndexComponent *Index = UAeyerjiAbilityIndexComponent::Get(ASC))
+
+	{
+
+		return BranchTag.IsValid() ? Index->FindAbilityCDO(BranchTag) : nullptr;
+	}
+
 	FGameplayTag Leaf;
 
 	if (const FGameplayAbilitySpec *Spec = FindBestSpecForBranchTag(ASC, BranchTag, Leaf))
@@ -1499,6 +1609,13 @@ bool UCharacterStatsLibrary::RecordBestRunTimeSecondsForDifficulty(const AAeyerj
 	}
 
 	Data->BestRunTimeSecondsByDifficulty.Add(DifficultyKey, RunTimeSeconds);
+	Data->MarkSectionChanged(EAeyerjiSaveSection::RunRecords);
+
+	if (UAeyerjiSaveService* SaveService = UAeyerjiSaveService::Get())
+	{
+		return SaveService->RequestSave(Data, Slot);
+	}
+
 	return UGameplayStatics::SaveGameToSlot(Data, Slot, 0);
 }
 
@@ -1512,13 +1629,21 @@ bool UCharacterStatsLibrary::GetBestRunTimeSecondsForDifficulty(const AAeyerjiPl
 	}
 
 	const FString Slot = MakeStableCharSlotName(PS);
-	if (Slot.IsEmpty() || !UGameplayStatics::DoesSaveGameExist(Slot, 0))
+	if (Slot.IsEmpty())
 	{
 		return false;
 	}
 
-	USaveGame* RawSave = UGameplayStatics::LoadGameFromSlot(Slot, 0);
-	const UAeyerjiSaveGame* Data = Cast<UAeyerjiSaveGame>(RawSave);
+	UAeyerjiSaveService* SaveService = UAeyerjiSaveService::Get();
+	const UAeyerjiSaveGame* Data = SaveService ? SaveService->PeekLatestSave(Slot) : nullptr;
+	if (!Data)
+	{
+		if (!UGameplayStatics::DoesSaveGameExist(Slot, 0))
+		{
+			return false;
+		}
+		Data = SaveService ? SaveService->LoadSave(Slot) : Cast<UAeyerjiSaveGame>(UGameplayStatics::LoadGameFromSlot(Slot, 0));
+	}
 	if (!Data)
 	{
 		return false;
@@ -0,0 +1,176 @@
+// AeyerjiAbilityIndexComponent.cpp
+
+#include "Components/AeyerjiAbilityIndexComponent.h"
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "AeyerjiCharacter.h"
+#include "GameplayAbilitySpec.h"
+
+UAeyerjiAbilityIndexComponent::UAeyerjiAbilityIndexComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(false);
+}
+
+UAeyerjiAbilityIndexComponent* UAeyerjiAbilityIndexComponent::Get(const UAbilitySystemComponent* ASC)
+{
+	if (!ASC)
+	{
+		return nullptr;
+	}
+
+	AActor* Owner = ASC->GetOwner();
+	if (!Owner)
+	{
+		return nullptr;
+	}
+
+	UAeyerjiAbilityIndexComponent* Index = nullptr;
+	if (const AAeyerjiCharacter* Char = Cast<AAeyerjiCharacter>(Owner))
+	{
+		Index = Char->GetAbilityIndex();
+	}
+	else
+	{
+		Index = Owner->FindComponentByClass<UAeyerjiAbilityIndexComponent>();
+	}
+
+	if (Index && Index->BoundASC.Get() != ASC)
+	{
+		// Queries only read the ASC; binding just registers for its dirty callback.
+		Index->Bind(const_cast<UAbilitySystemComponent*>(ASC));
+	}
+
+	return Index;
+}
+
+bool UAeyerjiAbilityIndexComponent::FindLeafTag(const FGameplayTag& Branch, FGameplayTag& OutLeaf)
+{
+	if (const FBranchEntry* Entry = FindEntry(Branch))
+	{
+		OutLeaf = Entry->Leaf;
+		return true;
+	}
+	return false;
+}
+
+UGameplayAbility* UAeyerjiAbilityIndexComponent::FindAbilityCDO(const FGameplayTag& Branch)
+{
+	const FBranchEntry* Entry = FindEntry(Branch);
+	return Entry ? Entry->Ability.Get() : nullptr;
+}
+
+TSubclassOf<UGameplayAbility> UAeyerjiAbilityIndexComponent::FindAbilityClass(const FGameplayTag& Branch)
+{
+	const UGameplayAbility* Ability = FindAbilityCDO(Branch);
+	return Ability ? Ability->GetClass() : nullptr;
+}
+
+void UAeyerjiAbilityIndexComponent::OnUnregister()
+{
+	Unbind();
+	Super::OnUnregister();
+}
+
+void UAeyerjiAbilityIndexComponent::Bind(UAbilitySystemComponent* ASC)
+{
+	Unbind();
+
+	BoundASC = ASC;
+	if (ASC)
+	{
+		SpecDirtiedHandle = ASC->AbilitySpecDirtiedCallbacks.AddUObject(this, &UAeyerjiAbilityIndexComponent::HandleSpecDirtied);
+	}
+	bDirty = true;
+}
+
+void UAeyerjiAbilityIndexComponent::Unbind()
+{
+	if (UAbilitySystemComponent* ASC = BoundASC.Get())
+	{
+		ASC->AbilitySpecDirtiedCallbacks.Remove(SpecDirtiedHandle);
+	}
+	SpecDirtiedHandle.Reset();
+	BoundASC.Reset();
+	BranchIndex.Reset();
+	bDirty = true;
+}
+
+void UAeyerjiAbilityIndexComponent::HandleSpecDirtied(const FGameplayAbilitySpec& /*Spec*/)
+{
+	bDirty = true;
+}
+
+const UAeyerjiAbilityIndexComponent::FBranchEntry* UAeyerjiAbilityIndexComponent::FindEntry(const FGameplayTag& Branch)
+{
+	if (!Branch.IsValid() || !BoundASC.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (bDirty)
+	{
+		Rebuild();
+	}
+	return BranchIndex.Find(Branch);
+}
+
+void UAeyerjiAbilityIndexComponent::Rebuild()
+{
+	BranchIndex.Reset();
+	bDirty = false;
+
+	const UAbilitySystemComponent* ASC = BoundASC.Get();
+	if (!ASC)
+	{
+		return;
+	}
+
+	const TArray<FGameplayAbilitySpec>& Specs = ASC->GetActivatableAbilities();
+	for (const FGameplayAbilitySpec& Spec : Specs)
+	{
+		auto Consider = [this, &Spec](const FGameplayTag& Candidate, const bool bFromDynamic)
+		{
+			if (!Candidate.IsValid())
+			{
+				return;
+			}
+
+			// The candidate itself plus every parent: each one is a branch this candidate answers for.
+			const FGameplayTagContainer Branches = Candidate.GetGameplayTagParents();
+			const int32 Depth = Branches.Num() - 1;
+
+			for (const FGameplayTag& Branch : Branches)
+			{
+				FBranchEntry* Entry = BranchIndex.Find(Branch);
+				if (!Entry)
+				{
+					Entry = &BranchIndex.Add(Branch);
+				}
+				else if (!(Depth > Entry->Depth || (Depth == Entry->Depth && bFromDynamic && !Entry->bFromDynamic)))
+				{
+					continue;
+				}
+
+				Entry->Leaf = Candidate;
+				Entry->Ability = Spec.Ability;
+				Entry->Depth = Depth;
+				Entry->bFromDynamic = bFromDynamic;
+			}
+		};
+
+		for (const FGameplayTag& Tag : Spec.GetDynamicSpecSourceTags())
+		{
+			Consider(Tag, /*bFromDynamic=*/true);
+		}
+
+		if (Spec.Ability)
+		{
+			for (const FGameplayTag& Tag : Spec.Ability->GetAssetTags())
+			{
+				Consider(Tag, /*bFromDynamic=*/false);
+			}
+		}
+	}
+}
@@ -12,6 +12,7 @@
 #include "Logging/AeyerjiLog.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/MaterialInterface.h"
+#include "Logging/AeyerjiStats.h"
 
 // Configure default tick behavior for fade interpolation.
 UAeyerjiCameraOcclusionFadeComponent::UAeyerjiCameraOcclusionFadeComponent()
@@ -145,6 +146,8 @@ void UAeyerjiCameraOcclusionFadeComponent::TickComponent(
 // Run traces from camera to pawn samples and update occluder targets.
 void UAeyerjiCameraOcclusionFadeComponent::EvaluateOccluders()
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_OcclusionSweep);
+
 	FVector CameraLoc = FVector::ZeroVector;
 	FVector CameraDir = FVector::ForwardVector;
 	APawn* Pawn = nullptr;
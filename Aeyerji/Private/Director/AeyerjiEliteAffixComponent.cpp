@@ -0,0 +1,141 @@
+// Copyright (c) 2025 Aeyerji.
+#include "Director/AeyerjiEliteAffixComponent.h"
+
+#include "Director/AeyerjiSpawnerGroup.h"
+#include "Enemy/AeyerjiEnemyVisualVariantCache.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Pawn.h"
+#include "Net/UnrealNetwork.h"
+#include "Systems/AeyerjiElitePresentationSubsystem.h"
+
+UAeyerjiEliteAffixComponent::UAeyerjiEliteAffixComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetIsReplicatedByDefault(true);
+}
+
+UAeyerjiEliteAffixComponent* UAeyerjiEliteAffixComponent::FindOrAdd(APawn* Pawn)
+{
+	if (!IsValid(Pawn))
+	{
+		return nullptr;
+	}
+
+	if (UAeyerjiEliteAffixComponent* Existing = Pawn->FindComponentByClass<UAeyerjiEliteAffixComponent>())
+	{
+		return Existing;
+	}
+
+	UAeyerjiEliteAffixComponent* Component = NewObject<UAeyerjiEliteAffixComponent>(Pawn, TEXT("EliteAffixComponent"));
+	Pawn->AddInstanceComponent(Component);
+	Component->RegisterComponent();
+	return Component;
+}
+
+void UAeyerjiEliteAffixComponent::SetPresentation(const FAeyerjiElitePresentationState& NewState)
+{
+	State = NewState;
+	ApplyLocalPresentation();
+}
+
+void UAeyerjiEliteAffixComponent::GetAffixes(TArray<const FEliteAffixDefinition*>& OutAffixes) const
+{
+	OutAffixes.Reset();
+
+	const AAeyerjiSpawnerGroup* Source = State.Source;
+	if (!Source)
+	{
+		return;
+	}
+
+	const int32 NumBits = FMath::Min(Source->EliteAffixPool.Num(), MaxAffixes);
+	for (int32 Index = 0; Index < NumBits; ++Index)
+	{
+		if (State.AffixMask & (1u << Index))
+		{
+			OutAffixes.Add(&Source->EliteAffixPool[Index]);
+		}
+	}
+}
+
+float UAeyerjiEliteAffixComponent::GetThreat() const
+{
+	float RankWeight = 1.f;
+	switch (State.Rank)
+	{
+	case EAeyerjiEliteRank::MiniBoss: RankWeight = 2.f; break;
+	case EAeyerjiEliteRank::Boss: RankWeight = 4.f; break;
+	default: break;
+	}
+
+	return RankWeight * (1.f + 0.25f * GetNumAffixes());
+}
+
+void UAeyerjiEliteAffixComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UAeyerjiEliteAffixComponent, State);
+}
+
+void UAeyerjiEliteAffixComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAeyerjiElitePresentationSubsystem* Presentation = UAeyerjiElitePresentationSubsystem::Get(this))
+	{
+		Presentation->UnregisterElite(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAeyerjiEliteAffixComponent::OnRep_State()
+{
+	ApplyLocalPresentation();
+}
+
+void UAeyerjiEliteAffixComponent::ApplyLocalPresentation()
+{
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	const float SafeScale = State.ScaleMultiplier > 0.f ? State.ScaleMultiplier : 1.f;
+	if (!FMath::IsNearlyEqual(SafeScale, AppliedScale))
+	{
+		Owner->SetActorScale3D(Owner->GetActorScale3D() * (SafeScale / AppliedScale));
+		AppliedScale = SafeScale;
+	}
+
+	if (Owner->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// Materials are part of the elite's look, not its FX budget; they stay on regardless of distance.
+	if (State.Source && State.AffixMask != AppliedMaterialMask)
+	{
+		const ACharacter* Character = Cast<ACharacter>(Owner);
+		UAeyerjiEnemyVisualVariantCache* VariantCache = UAeyerjiEnemyVisualVariantCache::Get(this);
+		if (Character && VariantCache)
+		{
+			TArray<const FEliteAffixDefinition*> Affixes;
+			GetAffixes(Affixes);
+			VariantCache->ApplyAffixVariants(Character->GetMesh(), Affixes);
+			AppliedMaterialMask = State.AffixMask;
+		}
+	}
+
+	if (UAeyerjiElitePresentationSubsystem* Presentation = UAeyerjiElitePresentationSubsystem::Get(this))
+	{
+		if (State.bShowFX && State.Source)
+		{
+			Presentation->RegisterElite(this);
+		}
+		else
+		{
+			Presentation->UnregisterElite(this);
+		}
+	}
+}
@@ -18,9 +18,11 @@
 #include "EngineUtils.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "HAL/IConsoleManager.h"
+#include "Logging/AeyerjiStats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogEncounterDirector, Log, All);
 
@@ -47,6 +49,9 @@ namespace
 			ECVF_Default);
 		return *CVar;
 	}
+
+	// A cluster hit from outside its sleep distance stays awake this long after the last hit.
+	constexpr double DisturbedStayAwakeSeconds = 10.0;
 }
 
 TSubclassOf<AEnemyParentNative> UEnemySpawnGroupDefinition::ResolveEnemyClass() const
@@ -251,6 +256,8 @@ void AAeyerjiEncounterDirector::StopFixedWorldPopulation()
 
 void AAeyerjiEncounterDirector::Tick(float DeltaSeconds)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_DirectorTick);
+
 	Super::Tick(DeltaSeconds);
 
 	if (GetNetMode() == NM_Client)
@@ -369,6 +376,8 @@ void AAeyerjiEncounterDirector::UpdateRecentPlayerPath()
 
 void AAeyerjiEncounterDirector::CleanupInactiveEnemies()
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_CleanupInactiveEnemies);
+
 	for (int32 Index = LiveEnemies.Num() - 1; Index >= 0; --Index)
 	{
 		if (!LiveEnemies[Index].IsValid())
@@ -382,6 +391,8 @@ void AAeyerjiEncounterDirector::CleanupInactiveEnemies()
 
 void AAeyerjiEncounterDirector::UpdateEnemyLOD(float DeltaSeconds)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_UpdateEnemyLOD);
+
 	if (!CachedPlayerPawn.IsValid())
 	{
 		return;
@@ -397,8 +408,32 @@ void AAeyerjiEncounterDirector::UpdateEnemyLOD(float DeltaSeconds)
 		EnemyLODTimeAccumulator = 0.f;
 	}
 
-	const FVector PlayerLocation = CachedPlayerPawn->GetActorLocation();
-	UpdateFixedClusterLOD(PlayerLocation);
+	// Co-op: every player keeps nearby enemies awake, not just player 0.
+	TArray<FVector, TInlineAllocator<4>> PlayerLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (const APawn* Pawn = PC ? PC->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+	if (PlayerLocations.IsEmpty())
+	{
+		PlayerLocations.Add(CachedPlayerPawn->GetActorLocation());
+	}
+
+	auto NearestPlayerDistSq = [&PlayerLocations](const FVector& Location)
+	{
+		float BestDistSq = TNumericLimits<float>::Max();
+		for (const FVector& PlayerLocation : PlayerLocations)
+		{
+			BestDistSq = FMath::Min(BestDistSq, static_cast<float>(FVector::DistSquared2D(Location, PlayerLocation)));
+		}
+		return BestDistSq;
+	};
+
+	UpdateFixedClusterLOD(NearestPlayerDistSq);
 
 	if (!bEnableEnemyLODThrottling)
 	{
@@ -425,7 +460,7 @@ void AAeyerjiEncounterDirector::UpdateEnemyLOD(float DeltaSeconds)
 			continue;
 		}
 
-		const float DistSq = FVector::DistSquared2D(Enemy->GetActorLocation(), PlayerLocation);
+		const float DistSq = NearestPlayerDistSq(Enemy->GetActorLocation());
 		uint8 NewBucket = 0;
 		if (DistSq > FarDistSq)
 		{
@@ -443,7 +478,7 @@ void AAeyerjiEncounterDirector::UpdateEnemyLOD(float DeltaSeconds)
 	}
 }
 
-void AAeyerjiEncounterDirector::UpdateFixedClusterLOD(const FVector& PlayerLocation)
+void AAeyerjiEncounterDirector::UpdateFixedClusterLOD(TFunctionRef<float(const FVector&)> NearestPlayerDistSq)
 {
 	if (!bEnableFixedClusterSleeping || !bFixedPopulationActive || FixedClusters.IsEmpty())
 	{
@@ -454,13 +489,15 @@ void AAeyerjiEncounterDirector::UpdateFixedClusterLOD(const FVector& PlayerLocat
 	const float WakeDistance = FMath::Max(0.f, FMath::Min(FixedClusterWakeDistance, SleepDistance));
 	const float SleepDistSq = FMath::Square(SleepDistance);
 	const float WakeDistSq = FMath::Square(WakeDistance);
+	const double Now = GetWorld()->GetTimeSeconds();
 
 	for (TPair<int32, FFixedSpawnCluster>& Pair : FixedClusters)
 	{
 		FFixedSpawnCluster& Cluster = Pair.Value;
-		const float DistSq = FVector::DistSquared2D(PlayerLocation, Cluster.Center);
+		const float DistSq = NearestPlayerDistSq(Cluster.Center);
 
-		if (!Cluster.bSleeping && DistSq >= SleepDistSq)
+		const bool bRecentlyDisturbed = Cluster.LastDisturbedTime >= 0.0 && Now - Cluster.LastDisturbedTime < DisturbedStayAwakeSeconds;
+		if (!Cluster.bSleeping && DistSq >= SleepDistSq && !bRecentlyDisturbed)
 		{
 			Cluster.bSleeping = true;
 			ApplyFixedClusterSleepState(Pair.Key, true);
@@ -547,9 +584,20 @@ void AAeyerjiEncounterDirector::ApplyEnemySleepState(AEnemyParentNative* Enemy,
 		{
 			Perception->SetComponentTickEnabled(false);
 		}
+
+		// Nothing on a sleeping enemy changes until its cluster wakes; stop considering it for replication.
+		if (Enemy->HasAuthority())
+		{
+			Enemy->SetNetDormancy(DORM_DormantAll);
+		}
 	}
 	else
 	{
+		if (Enemy->HasAuthority())
+		{
+			Enemy->SetNetDormancy(DORM_Awake);
+		}
+
 		if (MoveComp)
 		{
 			MoveComp->SetComponentTickEnabled(State.bMovementTickEnabled);
@@ -1937,6 +1985,8 @@ int32 AAeyerjiEncounterDirector::QueueSpawnsFromGroup(const UEnemySpawnGroupDefi
 
 void AAeyerjiEncounterDirector::ProcessSpawnQueue()
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_ProcessSpawnQueue);
+
 	if (GetNetMode() == NM_Client)
 	{
 		return;
@@ -2209,10 +2259,32 @@ void AAeyerjiEncounterDirector::RegisterSpawnedEnemy(AEnemyParentNative* Enemy)
 	Enemy->OnEnemyDied.AddDynamic(this, &AAeyerjiEncounterDirector::HandleTrackedEnemyDied);
 	Enemy->OnDestroyed.RemoveDynamic(this, &AAeyerjiEncounterDirector::HandleTrackedEnemyDestroyed);
 	Enemy->OnDestroyed.AddDynamic(this, &AAeyerjiEncounterDirector::HandleTrackedEnemyDestroyed);
+	Enemy->OnEnemyDisturbed.RemoveAll(this);
+	Enemy->OnEnemyDisturbed.AddUObject(this, &AAeyerjiEncounterDirector::HandleTrackedEnemyDisturbed);
 
 	GetOrCreateEnemyLODState(Enemy);
 }
 
+void AAeyerjiEncounterDirector::HandleTrackedEnemyDisturbed(AEnemyParentNative* Enemy)
+{
+	// Hit while asleep (e.g. by a ranged attack from outside wake range): wake the whole cluster so it fights back.
+	const int32* ClusterId = FixedEnemyClusterMap.Find(Enemy);
+	FFixedSpawnCluster* Cluster = ClusterId ? FixedClusters.Find(*ClusterId) : nullptr;
+	if (Cluster)
+	{
+		Cluster->LastDisturbedTime = GetWorld()->GetTimeSeconds();
+		if (Cluster->bSleeping)
+		{
+			Cluster->bSleeping = false;
+			ApplyFixedClusterSleepState(*ClusterId, false);
+		}
+	}
+	else
+	{
+		ApplyEnemySleepState(Enemy, false);
+	}
+}
+
 void AAeyerjiEncounterDirector::HandleTrackedEnemyDied(AActor* DeadEnemy)
 {
 	if (!DeadEnemy)
@@ -14,6 +14,7 @@
 #include "Enemy/AeyerjiEnemyManagementBPFL.h"
 #include "Enemy/EnemyParentNative.h"
 #include "../AeyerjiGameInstance.h"
+#include "../AeyerjiGameState.h"
 
 namespace
 {
@@ -42,6 +43,9 @@ void AAeyerjiLevelDirector::BeginPlay()
 		}
 	}
 
+	// Seed the cached party difficulty now that the slider is final.
+	RefreshPartyDifficulty();
+
 	for (AAeyerjiSpawnerGroup* Spawner : SpawnerSequence)
 	{
 		BindSpawner(Spawner);
@@ -297,6 +301,32 @@ float AAeyerjiLevelDirector::GetCurvedDifficulty() const
 	return FMath::Pow(Scale, FMath::Max(0.1f, DifficultyExponent));
 }
 
+void AAeyerjiLevelDirector::SetDifficultySlider(float NewSlider)
+{
+	DifficultySlider = FMath::Clamp(NewSlider, 0.f, 1000.f);
+	RefreshPartyDifficulty();
+}
+
+void AAeyerjiLevelDirector::SetDifficultyExponent(float NewExponent)
+{
+	DifficultyExponent = FMath::Max(0.1f, NewExponent);
+	RefreshPartyDifficulty();
+}
+
+void AAeyerjiLevelDirector::RefreshPartyDifficulty()
+{
+	UWorld* World = GetWorld();
+	if (!HasAuthority() || !World || !World->IsGameWorld())
+	{
+		return;
+	}
+
+	if (AAeyerjiGameState* AeyerjiGS = World->GetGameState<AAeyerjiGameState>())
+	{
+		AeyerjiGS->RefreshPartyStats();
+	}
+}
+
 int32 AAeyerjiLevelDirector::GetCurrentPlayerLevel() const
 {
 	if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0))
@@ -7,14 +7,13 @@
 #include "Systems/AeyerjiGameplayEventSubsystem.h"
 #include "TimerManager.h"
 #include "AIController.h"
+#include "Director/AeyerjiEliteAffixComponent.h"
 #include "Director/AeyerjiEncounterDefinition.h"
 #include "Director/AeyerjiLevelDirector.h"
 #include "GameFramework/Character.h"
 #include "Enemy/AeyerjiEnemyManagementBPFL.h"
 #include "Enemy/EnemyParentNative.h"
 #include "Engine/Engine.h"
-#include "NiagaraComponent.h"
-#include "NiagaraFunctionLibrary.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "Attributes/AeyerjiAttributeSet.h"
@@ -607,200 +606,6 @@ void AAeyerjiSpawnerGroup::OnEnemyDestroyed(AActor* DestroyedEnemy)
 	CheckWaveCompletion();
 }
 
-void AAeyerjiSpawnerGroup::MulticastApplyElitePresentation_Implementation(APawn* SpawnedPawn, float ScaleMultiplier, const TArray<FGameplayTag>& AffixTags)
-{
-	if (!IsValid(SpawnedPawn))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("MulticastApplyElitePresentation skipped: invalid pawn"));
-		return;
-	}
-
-	const ENetMode NetMode = GetNetMode();
-	const auto* NetModeLabel = [NetMode]() -> const TCHAR*
-	{
-		switch (NetMode)
-		{
-		case NM_Client: return TEXT("Client");
-		case NM_ListenServer: return TEXT("ListenServer");
-		case NM_DedicatedServer: return TEXT("DedicatedServer");
-		default: return TEXT("Standalone");
-		}
-	}();
-
-	const float SafeScale = ScaleMultiplier > 0.f ? ScaleMultiplier : 1.0f;
-	if (!FMath::IsNearlyEqual(SafeScale, 1.0f))
-	{
-		const FVector NewScale = SpawnedPawn->GetActorScale3D() * SafeScale;
-		SpawnedPawn->SetActorScale3D(NewScale);
-		UE_LOG(LogTemp, Log, TEXT("Applied elite scale %.2f to %s (NetMode=%s NewScale=%s)"),
-			SafeScale,
-			*GetNameSafe(SpawnedPawn),
-			NetModeLabel,
-			*NewScale.ToString());
-	}
-	else
-	{
-		UE_LOG(LogTemp, Log, TEXT("Elite scale unchanged for %s (ScaleMultiplier=%.2f NetMode=%s)"),
-			*GetNameSafe(SpawnedPawn),
-			SafeScale,
-			NetModeLabel);
-	}
-
-	// Dedicated servers cannot render Niagara; only proceed there if replication is explicitly requested.
-	if (NetMode == NM_DedicatedServer && !bReplicateEliteVFX)
-	{
-		UE_LOG(LogTemp, Log, TEXT("Skipping elite VFX on dedicated server for %s (bReplicateEliteVFX=%d)"),
-			*GetNameSafe(SpawnedPawn),
-			bReplicateEliteVFX ? 1 : 0);
-		return;
-	}
-
-	// Honor the "Replicate" toggle: skip client-side cosmetic work if designer has disabled it.
-	if (!bReplicateEliteVFX && NetMode == NM_Client)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Skipping elite VFX on client for %s because bReplicateEliteVFX is false"),
-			*GetNameSafe(SpawnedPawn));
-		return;
-	}
-
-	TArray<const FEliteAffixDefinition*> Affixes;
-	for (const FGameplayTag& Tag : AffixTags)
-	{
-		if (const FEliteAffixDefinition* Def = FindAffixDefinition(Tag))
-		{
-			Affixes.Add(Def);
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Elite affix tag %s missing definition on %s; affix VFX may be missing"),
-				*Tag.ToString(),
-				*GetNameSafe(this));
-		}
-	}
-
-	ApplyElitePresentation(SpawnedPawn, 1.0f, Affixes, /*bApplyScale=*/false);
-}
-
-void AAeyerjiSpawnerGroup::ApplyElitePresentation(APawn* SpawnedPawn, float ScaleMultiplier, const TArray<const FEliteAffixDefinition*>& Affixes, bool bApplyScale)
-{
-	if (!IsValid(SpawnedPawn))
-	{
-		return;
-	}
-
-	const float SafeScale = ScaleMultiplier > 0.f ? ScaleMultiplier : 1.0f;
-	if (bApplyScale && !FMath::IsNearlyEqual(SafeScale, 1.0f))
-	{
-		const FVector NewScale = SpawnedPawn->GetActorScale3D() * SafeScale;
-		SpawnedPawn->SetActorScale3D(NewScale);
-	}
-
-	if (!EliteVFXSystem)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Elite VFX system not set; skipping FX for %s"), *GetNameSafe(SpawnedPawn));
-		return;
-	}
-
-	// Skip cosmetic FX on dedicated servers unless replication is requested.
-	if (SpawnedPawn->GetNetMode() == NM_DedicatedServer && !bReplicateEliteVFX)
-	{
-		return;
-	}
-
-	UWorld* World = SpawnedPawn->GetWorld();
-	if (!World || !World->IsGameWorld())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Elite VFX skipped because world was invalid for %s"), *GetNameSafe(SpawnedPawn));
-		return;
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("Applying elite VFX for %s (NetMode=%d System=%s AttachSocket=%s Offset=%s ApplyScale=%d)"),
-		*GetNameSafe(SpawnedPawn),
-		static_cast<int32>(SpawnedPawn->GetNetMode()),
-		*GetNameSafe(EliteVFXSystem),
-		*EliteVFXSocket.ToString(),
-		*EliteVFXOffset.ToString(),
-		bApplyScale ? 1 : 0);
-
-	USceneComponent* AttachParent = nullptr;
-	if (ACharacter* CharacterOwner = Cast<ACharacter>(SpawnedPawn))
-	{
-		AttachParent = CharacterOwner->GetMesh();
-	}
-
-	if (!AttachParent)
-	{
-		AttachParent = SpawnedPawn->GetRootComponent();
-	}
-
-	// If we somehow have no valid, registered parent, bail out entirely to avoid crashing during component registration.
-	if (!AttachParent || !AttachParent->IsRegistered() || !AttachParent->GetOwner())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Elite VFX skipped: invalid attach parent for %s (Parent=%s Registered=%d Owner=%s)"),
-			*GetNameSafe(SpawnedPawn),
-			*GetNameSafe(AttachParent),
-			AttachParent ? (AttachParent->IsRegistered() ? 1 : 0) : 0,
-			*GetNameSafe(AttachParent ? AttachParent->GetOwner() : nullptr));
-		return;
-	}
-
-	UNiagaraComponent* NiagaraComp = nullptr;
-	NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(
-		EliteVFXSystem,
-		AttachParent,
-		EliteVFXSocket,
-		EliteVFXOffset,
-		FRotator::ZeroRotator,
-		EAttachLocation::KeepRelativeOffset,
-		true);
-
-	// As a last resort, spawn unattached in world space with the same offset.
-	if (!NiagaraComp && World)
-	{
-		const FTransform OwnerTransform = SpawnedPawn->GetActorTransform();
-		const FVector WorldOffset = OwnerTransform.TransformVector(EliteVFXOffset);
-		NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-			World,
-			EliteVFXSystem,
-			OwnerTransform.GetLocation() + WorldOffset,
-			OwnerTransform.Rotator());
-	}
-
-	if (!NiagaraComp)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Elite VFX failed to spawn for %s using system %s (AttachParent=%s WorldValid=%d NetMode=%d ApplyScale=%d)"),
-			*GetNameSafe(SpawnedPawn),
-			*GetNameSafe(EliteVFXSystem),
-			*GetNameSafe(AttachParent),
-			World ? 1 : 0,
-			static_cast<int32>(SpawnedPawn->GetNetMode()),
-			bApplyScale ? 1 : 0);
-		return;
-	}
-
-	NiagaraComp->SetAutoDestroy(true);
-	NiagaraComp->SetUsingAbsoluteScale(false);
-
-	if (bReplicateEliteVFX && SpawnedPawn->GetLocalRole() == ROLE_Authority)
-	{
-		NiagaraComp->SetIsReplicated(true);
-	}
-
-	UE_LOG(LogTemp, Log, TEXT("Elite VFX spawned on %s (Attached=%d Socket=%s Offset=%s)"),
-		*GetNameSafe(SpawnedPawn),
-		NiagaraComp->GetAttachParent() ? 1 : 0,
-		*EliteVFXSocket.ToString(),
-		*EliteVFXOffset.ToString());
-
-	for (const FEliteAffixDefinition* Affix : Affixes)
-	{
-		if (Affix && Affix->VFXSystem)
-		{
-			ApplyAffixVFX(SpawnedPawn, *Affix);
-		}
-	}
-}
-
 FEnemySet AAeyerjiSpawnerGroup::ResolveEliteSpawnSet(const FEnemySet& EnemySet) const
 {
 	FEnemySet ResolvedSet = EnemySet;
@@ -1141,87 +946,6 @@ void AAeyerjiSpawnerGroup::ApplyEliteGameplay(APawn* SpawnedPawn, const FEnemySe
 	}
 }
 
-void AAeyerjiSpawnerGroup::ApplyAffixVFX(APawn* SpawnedPawn, const FEliteAffixDefinition& Affix)
-{
-	if (!IsValid(SpawnedPawn) || !Affix.VFXSystem)
-	{
-		if (!Affix.VFXSystem)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Affix %s has no VFXSystem; skipping VFX for %s"),
-				*Affix.AffixTag.ToString(),
-				*GetNameSafe(SpawnedPawn));
-		}
-		return;
-	}
-
-	if (SpawnedPawn->GetNetMode() == NM_DedicatedServer && !bReplicateEliteVFX)
-	{
-		return;
-	}
-
-	USceneComponent* AttachParent = nullptr;
-	if (ACharacter* CharacterOwner = Cast<ACharacter>(SpawnedPawn))
-	{
-		AttachParent = CharacterOwner->GetMesh();
-	}
-
-	if (!AttachParent)
-	{
-		AttachParent = SpawnedPawn->GetRootComponent();
-	}
-
-	if (!AttachParent || !AttachParent->IsRegistered())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Affix VFX skipped: invalid attach parent for %s (Affix=%s Parent=%s Registered=%d)"),
-			*GetNameSafe(SpawnedPawn),
-			*Affix.AffixTag.ToString(),
-			*GetNameSafe(AttachParent),
-			AttachParent ? (AttachParent->IsRegistered() ? 1 : 0) : 0);
-		return;
-	}
-
-	UNiagaraComponent* NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAttached(
-		Affix.VFXSystem,
-		AttachParent,
-		Affix.VFXSocket,
-		Affix.VFXOffset,
-		FRotator::ZeroRotator,
-		EAttachLocation::KeepRelativeOffset,
-		true);
-
-	if (!NiagaraComp)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Affix VFX failed for %s (Affix=%s AttachParent=%s)"),
-			*GetNameSafe(SpawnedPawn),
-			*Affix.AffixTag.ToString(),
-			*GetNameSafe(AttachParent));
-		if (UWorld* World = SpawnedPawn->GetWorld())
-		{
-			const FTransform OwnerTransform = SpawnedPawn->GetActorTransform();
-			const FVector WorldOffset = OwnerTransform.TransformVector(Affix.VFXOffset);
-			NiagaraComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				World,
-				Affix.VFXSystem,
-				OwnerTransform.GetLocation() + WorldOffset,
-				OwnerTransform.Rotator());
-		}
-	}
-
-	if (!NiagaraComp)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Affix VFX failed at world spawn for %s (Affix=%s)"), *GetNameSafe(SpawnedPawn), *Affix.AffixTag.ToString());
-		return;
-	}
-
-	NiagaraComp->SetAutoDestroy(true);
-	NiagaraComp->SetUsingAbsoluteScale(false);
-
-	if (bReplicateEliteVFX && SpawnedPawn->GetLocalRole() == ROLE_Authority)
-	{
-		NiagaraComp->SetIsReplicated(true);
-	}
-}
-
 void AAeyerjiSpawnerGroup::ApplyElitePackage(APawn* SpawnedPawn, const FEnemySet& EnemySet)
 {
 	if (!HasAuthority() || !IsValid(SpawnedPawn))
@@ -1288,17 +1012,35 @@ void AAeyerjiSpawnerGroup::ApplyElitePackage(APawn* SpawnedPawn, const FEnemySet
 	ApplyEliteStats(SpawnedPawn, HealthMult, DamageMult, RangeMult);
 	ApplyEliteGameplay(SpawnedPawn, RuntimeSet, Affixes);
 
-	TArray<FGameplayTag> AffixTags;
+	// Presentation replicates as pool indices on the elite itself; each client budgets its own FX from that.
+	FAeyerjiElitePresentationState Presentation;
+	Presentation.Source = this;
+	Presentation.ScaleMultiplier = ScaleMult;
+	Presentation.Rank = RuntimeSet.bIsBoss ? EAeyerjiEliteRank::Boss
+		: RuntimeSet.bIsMiniBoss ? EAeyerjiEliteRank::MiniBoss
+		: EAeyerjiEliteRank::Elite;
+	Presentation.bShowFX = bReplicateEliteVFX;
+
 	for (const FEliteAffixDefinition* Affix : Affixes)
 	{
-		if (Affix && Affix->AffixTag.IsValid())
+		const int32 PoolIndex = Affix ? static_cast<int32>(Affix - EliteAffixPool.GetData()) : INDEX_NONE;
+		if (PoolIndex >= 0 && PoolIndex < UAeyerjiEliteAffixComponent::MaxAffixes)
 		{
-			AffixTags.Add(Affix->AffixTag);
+			Presentation.AffixMask |= 1u << PoolIndex;
+		}
+		else if (Affix)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Elite affix %s on %s is past pool index %d; it will not be presented"),
+				*Affix->AffixTag.ToString(),
+				*GetNameSafe(this),
+				UAeyerjiEliteAffixComponent::MaxAffixes - 1);
 		}
 	}
 
-	// Cosmetic FX are multicast so dedicated servers can show them to clients even though they cannot render.
-	MulticastApplyElitePresentation(SpawnedPawn, ScaleMult, AffixTags);
+	if (UAeyerjiEliteAffixComponent* EliteComponent = UAeyerjiEliteAffixComponent::FindOrAdd(SpawnedPawn))
+	{
+		EliteComponent->SetPresentation(Presentation);
+	}
 }
 
 void AAeyerjiSpawnerGroup::HandleActivationEvent(const FGameplayTag& EventTag, const FGameplayEventData& Payload)
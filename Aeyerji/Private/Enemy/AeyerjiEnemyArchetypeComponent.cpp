@@ -3,171 +3,74 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
-#include "Attributes/AeyerjiAttributeSet.h"
 #include "Enemy/AeyerjiEnemyArchetypeData.h"
 #include "Enemy/AeyerjiEnemyArchetypeLibrary.h"
+#include "Enemy/AeyerjiEnemyArchetypeRegistry.h"
 #include "Enemy/AeyerjiEnemyTraitComponent.h"
+#include "Enemy/AeyerjiEnemyVisualVariantCache.h"
 #include "Enemy/EnemyParentNative.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/World.h"
 #include "GameplayEffect.h"
+#include "Logging/AeyerjiStats.h"
 #include "Materials/MaterialInterface.h"
 #include "Net/UnrealNetwork.h"
 
 namespace
 {
-template <typename TArchetypeData>
-void ValidateArchetypeInternal(bool& bValidated, const TArchetypeData& Data, const FString& DebugName)
+void ApplyArchetypeBundle(const FAeyerjiArchetypeBundle& Bundle, UAbilitySystemComponent& ASC, AActor* Owner)
 {
-	if (bValidated)
+	if (Bundle.AttributeDefaultsTable && Bundle.AttributeSetClass)
 	{
-		return;
-	}
-
-	bValidated = true;
-
-	if (Data.bWarnIfMissingAttackMontage && Data.AttackMontage.IsNull())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Enemy archetype %s has no AttackMontage"), *DebugName);
-	}
-
-	if (Data.bWarnIfMissingInitEffects && Data.InitGameplayEffects.IsEmpty())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Enemy archetype %s has no InitGameplayEffects"), *DebugName);
-	}
-
-	if (Data.bWarnIfMissingGrantedTags && Data.GrantedTags.IsEmpty() && !Data.ArchetypeTag.IsValid())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Enemy archetype %s has no GrantedTags"), *DebugName);
-	}
-}
-
-template <typename TArchetypeData>
-void ApplyAttributeDefaultsInternal(const TArchetypeData& Data, UAbilitySystemComponent& ASC)
-{
-	if (Data.AttributeDefaultsTable.IsNull())
-	{
-		return;
-	}
-
-	UDataTable* DefaultsTable = Data.AttributeDefaultsTable.LoadSynchronous();
-	if (!DefaultsTable)
-	{
-		return;
+		ASC.InitStats(Bundle.AttributeSetClass, Bundle.AttributeDefaultsTable);
 	}
 
-	UClass* AttributeSetClass = Data.AttributeSetClass ? Data.AttributeSetClass.Get() : UAeyerjiAttributeSet::StaticClass();
-	if (!AttributeSetClass)
-	{
-		return;
-	}
-
-	ASC.InitStats(AttributeSetClass, DefaultsTable);
-}
-
-template <typename TArchetypeData>
-void ApplyGrantedTagsInternal(const TArchetypeData& Data, UAbilitySystemComponent& ASC)
-{
-	if (Data.ArchetypeTag.IsValid())
+	if (!Bundle.LooseTags.IsEmpty())
 	{
-		ASC.AddLooseGameplayTag(Data.ArchetypeTag);
+		ASC.AddLooseGameplayTags(Bundle.LooseTags);
 	}
 
-	if (!Data.GrantedTags.IsEmpty())
+	if (AEnemyParentNative* Enemy = Cast<AEnemyParentNative>(Owner))
 	{
-		ASC.AddLooseGameplayTags(Data.GrantedTags);
-	}
-}
-
-template <typename TArchetypeData>
-void ApplyTeamOverridesInternal(const TArchetypeData& Data, AEnemyParentNative* Enemy)
-{
-	if (!Enemy)
-	{
-		return;
-	}
-
-	if (Data.bOverrideTeamId)
-	{
-		Enemy->SetGenericTeamId(FGenericTeamId(Data.TeamIdOverride));
-	}
-
-	if (Data.bOverrideTeamTag && Data.TeamTagOverride.IsValid())
-	{
-		Enemy->SetActiveTeamTag(Data.TeamTagOverride);
-	}
-}
-
-template <typename TArchetypeData>
-void GrantAbilitiesInternal(const TArchetypeData& Data, UAbilitySystemComponent& ASC, AActor* Owner)
-{
-	if (Data.GrantedAbilities.IsEmpty())
-	{
-		return;
-	}
-
-	const int32 ClampedLevel = FMath::Max(1, Data.AbilityLevel);
-	for (const TSubclassOf<UGameplayAbility>& AbilityClass : Data.GrantedAbilities)
-	{
-		if (!*AbilityClass)
+		if (Bundle.bOverrideTeamId)
 		{
-			continue;
+			Enemy->SetGenericTeamId(FGenericTeamId(Bundle.TeamIdOverride));
 		}
 
-		if (ASC.FindAbilitySpecFromClass(AbilityClass))
+		if (Bundle.bOverrideTeamTag)
 		{
-			continue;
+			Enemy->SetActiveTeamTag(Bundle.TeamTagOverride);
 		}
-
-		ASC.GiveAbility(FGameplayAbilitySpec(AbilityClass, ClampedLevel, INDEX_NONE, Owner));
 	}
-}
 
-template <typename TArchetypeData>
-void ApplyInitEffectsInternal(const TArchetypeData& Data, UAbilitySystemComponent& ASC)
-{
-	if (Data.InitGameplayEffects.IsEmpty())
+	for (const TSubclassOf<UGameplayAbility>& AbilityClass : Bundle.Abilities)
 	{
-		return;
-	}
-
-	const float ClampedLevel = FMath::Max(0.01f, Data.EffectLevel);
-	for (const TSubclassOf<UGameplayEffect>& EffectClass : Data.InitGameplayEffects)
-	{
-		if (!EffectClass)
+		if (!ASC.FindAbilitySpecFromClass(AbilityClass))
 		{
-			continue;
+			ASC.GiveAbility(FGameplayAbilitySpec(AbilityClass, Bundle.AbilityLevel, INDEX_NONE, Owner));
 		}
+	}
 
+	if (!Bundle.InitEffects.IsEmpty())
+	{
 		const FGameplayEffectContextHandle Context = ASC.MakeEffectContext();
-		FGameplayEffectSpecHandle Spec = ASC.MakeOutgoingSpec(EffectClass, ClampedLevel, Context);
-		if (Spec.IsValid())
+		for (const TSubclassOf<UGameplayEffect>& EffectClass : Bundle.InitEffects)
 		{
-			ASC.ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+			const FGameplayEffectSpecHandle Spec = ASC.MakeOutgoingSpec(EffectClass, Bundle.EffectLevel, Context);
+			if (Spec.IsValid())
+			{
+				ASC.ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+			}
 		}
 	}
-}
-
-template <typename TArchetypeData>
-void AddTraitComponentsInternal(const TArchetypeData& Data, AActor* Owner)
-{
-	if (Data.TraitComponents.IsEmpty())
-	{
-		return;
-	}
 
 	if (!Owner)
 	{
 		return;
 	}
 
-	for (const TSubclassOf<UAeyerjiEnemyTraitComponent>& TraitClass : Data.TraitComponents)
+	for (const TSubclassOf<UAeyerjiEnemyTraitComponent>& TraitClass : Bundle.Traits)
 	{
-		if (!*TraitClass)
-		{
-			continue;
-		}
-
 		if (Owner->GetComponentByClass(TraitClass))
 		{
 			continue;
@@ -184,64 +87,6 @@ void AddTraitComponentsInternal(const TArchetypeData& Data, AActor* Owner)
 		NewTrait->RegisterComponent();
 	}
 }
-
-template <typename TArchetypeData>
-void ApplyMeshOverridesInternal(const TArchetypeData& Data, AEnemyParentNative* Enemy)
-{
-	const FAeyerjiEnemyMeshOverrides& MeshOverrides = Data.MeshOverrides;
-	if (MeshOverrides.SkeletalMesh.IsNull() && MeshOverrides.AnimClass == nullptr
-		&& MeshOverrides.MaterialOverrides.IsEmpty() && !MeshOverrides.bOverrideRelativeTransform)
-	{
-		return;
-	}
-
-	if (!Enemy)
-	{
-		return;
-	}
-
-	USkeletalMeshComponent* MeshComp = Enemy->GetMesh();
-	if (!MeshComp)
-	{
-		return;
-	}
-
-	if (!MeshOverrides.SkeletalMesh.IsNull())
-	{
-		if (USkeletalMesh* MeshAsset = MeshOverrides.SkeletalMesh.LoadSynchronous())
-		{
-			MeshComp->SetSkeletalMesh(MeshAsset);
-		}
-	}
-
-	if (MeshOverrides.AnimClass)
-	{
-		MeshComp->SetAnimationMode(EAnimationMode::AnimationBlueprint);
-		MeshComp->SetAnimInstanceClass(MeshOverrides.AnimClass);
-	}
-
-	if (MeshOverrides.bOverrideRelativeTransform)
-	{
-		MeshComp->SetRelativeTransform(MeshOverrides.RelativeTransform);
-	}
-
-	if (!MeshOverrides.MaterialOverrides.IsEmpty())
-	{
-		const int32 MaxIndex = MeshOverrides.MaterialOverrides.Num();
-		for (int32 Index = 0; Index < MaxIndex; ++Index)
-		{
-			if (MeshOverrides.MaterialOverrides[Index].IsNull())
-			{
-				continue;
-			}
-
-			if (UMaterialInterface* Material = MeshOverrides.MaterialOverrides[Index].LoadSynchronous())
-			{
-				MeshComp->SetMaterial(Index, Material);
-			}
-		}
-	}
-}
 } // namespace
 
 UAeyerjiEnemyArchetypeComponent::UAeyerjiEnemyArchetypeComponent()
@@ -271,12 +116,7 @@ void UAeyerjiEnemyArchetypeComponent::GetLifetimeReplicatedProps(TArray<FLifetim
 
 void UAeyerjiEnemyArchetypeComponent::OnRep_ArchetypeSource()
 {
-	bApplied = false;
-	bValidated = false;
-	bVisualsApplied = false;
-	bLoggedInvalidLibraryTag = false;
-	bLoggedMissingLibraryEntry = false;
-	bLoggedBothSources = false;
+	ResetResolvedArchetype();
 
 	ApplyArchetypeVisuals(/*bAllowInEditor=*/false, /*bForce=*/true);
 }
@@ -311,9 +151,10 @@ void UAeyerjiEnemyArchetypeComponent::ApplyArchetype()
 		return;
 	}
 
-	const FAeyerjiEnemyArchetypeEntry* LibraryEntry = ResolveArchetypeEntry(true);
-	const UAeyerjiEnemyArchetypeData* DataAsset = LibraryEntry ? nullptr : ResolveArchetypeData(true);
-	if (!LibraryEntry && !DataAsset)
+	AJ_SCOPE_CYCLE(STAT_AJ_ApplyArchetype);
+
+	const FAeyerjiArchetypeBundle* Bundle = ResolveBundle(true);
+	if (!Bundle)
 	{
 		return;
 	}
@@ -325,35 +166,8 @@ void UAeyerjiEnemyArchetypeComponent::ApplyArchetype()
 		return;
 	}
 
-	if (LibraryEntry)
-	{
-		ValidateArchetype(*LibraryEntry);
-	}
-	else
-	{
-		ValidateArchetype(*DataAsset);
-	}
-
 	bApplied = true;
-
-	if (LibraryEntry)
-	{
-		ApplyAttributeDefaults(*LibraryEntry, *ASC);
-		ApplyGrantedTags(*LibraryEntry, *ASC);
-		ApplyTeamOverrides(*LibraryEntry, *ASC);
-		GrantAbilities(*LibraryEntry, *ASC);
-		ApplyInitEffects(*LibraryEntry, *ASC);
-		AddTraitComponents(*LibraryEntry);
-	}
-	else
-	{
-		ApplyAttributeDefaults(*DataAsset, *ASC);
-		ApplyGrantedTags(*DataAsset, *ASC);
-		ApplyTeamOverrides(*DataAsset, *ASC);
-		GrantAbilities(*DataAsset, *ASC);
-		ApplyInitEffects(*DataAsset, *ASC);
-		AddTraitComponents(*DataAsset);
-	}
+	ApplyArchetypeBundle(*Bundle, *ASC, Owner);
 }
 
 void UAeyerjiEnemyArchetypeComponent::SetArchetypeData(UAeyerjiEnemyArchetypeData* NewData, bool bApplyImmediately)
@@ -361,12 +175,7 @@ void UAeyerjiEnemyArchetypeComponent::SetArchetypeData(UAeyerjiEnemyArchetypeDat
 	ArchetypeData = NewData;
 	ArchetypeLibrary = nullptr;
 	ArchetypeTag = FGameplayTag();
-	bApplied = false;
-	bValidated = false;
-	bVisualsApplied = false;
-	bLoggedInvalidLibraryTag = false;
-	bLoggedMissingLibraryEntry = false;
-	bLoggedBothSources = false;
+	ResetResolvedArchetype();
 
 	if (bApplyImmediately)
 	{
@@ -386,12 +195,7 @@ void UAeyerjiEnemyArchetypeComponent::SetArchetypeFromLibrary(UAeyerjiEnemyArche
 	ArchetypeLibrary = NewLibrary;
 	ArchetypeTag = NewTag;
 	ArchetypeData = nullptr;
-	bApplied = false;
-	bValidated = false;
-	bVisualsApplied = false;
-	bLoggedInvalidLibraryTag = false;
-	bLoggedMissingLibraryEntry = false;
-	bLoggedBothSources = false;
+	ResetResolvedArchetype();
 
 	if (bApplyImmediately)
 	{
@@ -435,21 +239,19 @@ void UAeyerjiEnemyArchetypeComponent::ApplyArchetypeVisuals(bool bAllowInEditor,
 		return;
 	}
 
-	const FAeyerjiEnemyArchetypeEntry* LibraryEntry = ResolveArchetypeEntry(true);
-	const UAeyerjiEnemyArchetypeData* DataAsset = LibraryEntry ? nullptr : ResolveArchetypeData(true);
-	if (!LibraryEntry && !DataAsset)
+	if (bForce && !UAeyerjiEnemyArchetypeRegistry::Get(this))
 	{
-		return;
+		// Editor previews recompile so edits to the archetype asset show up.
+		ResolvedBundle.Reset();
 	}
 
-	if (LibraryEntry)
-	{
-		ApplyMeshOverrides(*LibraryEntry);
-	}
-	else
+	const FAeyerjiArchetypeBundle* Bundle = ResolveBundle(true);
+	if (!Bundle)
 	{
-		ApplyMeshOverrides(*DataAsset);
+		return;
 	}
+
+	ApplyMeshOverrides(*Bundle);
 	bVisualsApplied = true;
 }
 
@@ -475,18 +277,8 @@ FGameplayTag UAeyerjiEnemyArchetypeComponent::GetArchetypeTag() const
 
 UAnimMontage* UAeyerjiEnemyArchetypeComponent::GetAttackMontage() const
 {
-	if (const FAeyerjiEnemyArchetypeEntry* LibraryEntry = ResolveArchetypeEntry(true))
-	{
-		return LibraryEntry->AttackMontage.LoadSynchronous();
-	}
-
-	const UAeyerjiEnemyArchetypeData* Data = ResolveArchetypeData(true);
-	if (!Data)
-	{
-		return nullptr;
-	}
-
-	return Data->AttackMontage.LoadSynchronous();
+	const FAeyerjiArchetypeBundle* Bundle = ResolveBundle(true);
+	return Bundle ? Bundle->AttackMontage.Get() : nullptr;
 }
 
 TSubclassOf<UGameplayEffect> UAeyerjiEnemyArchetypeComponent::GetBasicAttackEffect() const
@@ -528,13 +320,8 @@ void UAeyerjiEnemyArchetypeComponent::GetGrantedTags(FGameplayTagContainer& OutT
 
 const FAeyerjiEnemyStatMultipliers* UAeyerjiEnemyArchetypeComponent::GetStatMultipliers() const
 {
-	if (const FAeyerjiEnemyArchetypeEntry* LibraryEntry = ResolveArchetypeEntry(true))
-	{
-		return &LibraryEntry->StatMultipliers;
-	}
-
-	const UAeyerjiEnemyArchetypeData* Data = ResolveArchetypeData(true);
-	return Data ? &Data->StatMultipliers : nullptr;
+	const FAeyerjiArchetypeBundle* Bundle = ResolveBundle(true);
+	return Bundle ? &Bundle->StatMultipliers : nullptr;
 }
 
 bool UAeyerjiEnemyArchetypeComponent::HasArchetypeData() const
@@ -603,83 +390,102 @@ const UAeyerjiEnemyArchetypeData* UAeyerjiEnemyArchetypeComponent::ResolveArchet
 	return bLoadIfNeeded ? ArchetypeData.LoadSynchronous() : ArchetypeData.Get();
 }
 
-void UAeyerjiEnemyArchetypeComponent::ValidateArchetype(const UAeyerjiEnemyArchetypeData& Data)
+const FAeyerjiArchetypeBundle* UAeyerjiEnemyArchetypeComponent::ResolveBundle(bool bLoadIfNeeded) const
 {
-	ValidateArchetypeInternal(bValidated, Data, GetNameSafe(&Data));
-}
+	if (ResolvedBundle.IsValid())
+	{
+		return ResolvedBundle.Get();
+	}
 
-void UAeyerjiEnemyArchetypeComponent::ValidateArchetype(const FAeyerjiEnemyArchetypeEntry& Data)
-{
-	const FString DebugName = Data.ArchetypeTag.IsValid() ? Data.ArchetypeTag.ToString() : TEXT("Unknown");
-	ValidateArchetypeInternal(bValidated, Data, DebugName);
-}
+	UAeyerjiEnemyArchetypeRegistry* Registry = UAeyerjiEnemyArchetypeRegistry::Get(this);
 
-void UAeyerjiEnemyArchetypeComponent::ApplyAttributeDefaults(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyAttributeDefaultsInternal(Data, ASC);
-}
-
-void UAeyerjiEnemyArchetypeComponent::ApplyAttributeDefaults(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyAttributeDefaultsInternal(Data, ASC);
-}
+	// Preloaded archetypes resolve with one lookup, without touching the library entries.
+	if (Registry)
+	{
+		if (!ArchetypeLibrary.IsNull() && ArchetypeTag.IsValid())
+		{
+			ResolvedBundle = Registry->Find(ArchetypeLibrary.ToSoftObjectPath(), ArchetypeTag);
+		}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyGrantedTags(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyGrantedTagsInternal(Data, ASC);
-}
+		if (!ResolvedBundle.IsValid() && !ArchetypeData.IsNull() && (ArchetypeLibrary.IsNull() || !ArchetypeTag.IsValid()))
+		{
+			ResolvedBundle = Registry->Find(ArchetypeData.ToSoftObjectPath(), FGameplayTag());
+		}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyGrantedTags(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyGrantedTagsInternal(Data, ASC);
-}
+		if (ResolvedBundle.IsValid())
+		{
+			return ResolvedBundle.Get();
+		}
+	}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyTeamOverrides(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyTeamOverridesInternal(Data, Cast<AEnemyParentNative>(GetOwner()));
-}
+	if (const FAeyerjiEnemyArchetypeEntry* LibraryEntry = ResolveArchetypeEntry(bLoadIfNeeded))
+	{
+		ResolvedBundle = Registry
+			? Registry->FindOrCompile(*ArchetypeLibrary.Get(), *LibraryEntry)
+			: UAeyerjiEnemyArchetypeRegistry::Compile(*LibraryEntry);
+	}
+	else if (const UAeyerjiEnemyArchetypeData* DataAsset = ResolveArchetypeData(bLoadIfNeeded))
+	{
+		ResolvedBundle = Registry
+			? Registry->FindOrCompile(*DataAsset)
+			: UAeyerjiEnemyArchetypeRegistry::Compile(*DataAsset);
+	}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyTeamOverrides(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyTeamOverridesInternal(Data, Cast<AEnemyParentNative>(GetOwner()));
+	return ResolvedBundle.Get();
 }
 
-void UAeyerjiEnemyArchetypeComponent::GrantAbilities(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC)
+void UAeyerjiEnemyArchetypeComponent::ResetResolvedArchetype()
 {
-	GrantAbilitiesInternal(Data, ASC, GetOwner());
+	bApplied = false;
+	bVisualsApplied = false;
+	bLoggedInvalidLibraryTag = false;
+	bLoggedMissingLibraryEntry = false;
+	bLoggedBothSources = false;
+	ResolvedBundle.Reset();
 }
 
-void UAeyerjiEnemyArchetypeComponent::GrantAbilities(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC)
+void UAeyerjiEnemyArchetypeComponent::ApplyMeshOverrides(const FAeyerjiArchetypeBundle& Bundle)
 {
-	GrantAbilitiesInternal(Data, ASC, GetOwner());
-}
+	if (!Bundle.bHasMeshOverrides)
+	{
+		return;
+	}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyInitEffects(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyInitEffectsInternal(Data, ASC);
-}
+	const AEnemyParentNative* Enemy = Cast<AEnemyParentNative>(GetOwner());
+	USkeletalMeshComponent* MeshComp = Enemy ? Enemy->GetMesh() : nullptr;
+	if (!MeshComp)
+	{
+		return;
+	}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyInitEffects(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC)
-{
-	ApplyInitEffectsInternal(Data, ASC);
-}
+	if (Bundle.SkeletalMesh)
+	{
+		MeshComp->SetSkeletalMesh(Bundle.SkeletalMesh);
+	}
 
-void UAeyerjiEnemyArchetypeComponent::AddTraitComponents(const UAeyerjiEnemyArchetypeData& Data)
-{
-	AddTraitComponentsInternal(Data, GetOwner());
-}
+	if (Bundle.AnimClass)
+	{
+		MeshComp->SetAnimationMode(EAnimationMode::AnimationBlueprint);
+		MeshComp->SetAnimInstanceClass(Bundle.AnimClass);
+	}
 
-void UAeyerjiEnemyArchetypeComponent::AddTraitComponents(const FAeyerjiEnemyArchetypeEntry& Data)
-{
-	AddTraitComponentsInternal(Data, GetOwner());
-}
+	if (Bundle.bOverrideRelativeTransform)
+	{
+		MeshComp->SetRelativeTransform(Bundle.RelativeTransform);
+	}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyMeshOverrides(const UAeyerjiEnemyArchetypeData& Data)
-{
-	ApplyMeshOverridesInternal(Data, Cast<AEnemyParentNative>(GetOwner()));
-}
+	// Elites may already show a shared affix variant; keep the affix look on top of the new material.
+	UAeyerjiEnemyVisualVariantCache* VariantCache = UAeyerjiEnemyVisualVariantCache::Get(this);
+	for (int32 Index = 0; Index < Bundle.MaterialOverrides.Num(); ++Index)
+	{
+		if (UMaterialInterface* Material = Bundle.MaterialOverrides[Index])
+		{
+			MeshComp->SetMaterial(Index, VariantCache ? VariantCache->RebaseMaterial(MeshComp->GetMaterial(Index), Material) : Material);
+		}
+	}
 
-void UAeyerjiEnemyArchetypeComponent::ApplyMeshOverrides(const FAeyerjiEnemyArchetypeEntry& Data)
-{
-	ApplyMeshOverridesInternal(Data, Cast<AEnemyParentNative>(GetOwner()));
+	if (Bundle.bApplyInstanceTint)
+	{
+		UAeyerjiEnemyVisualVariantCache::SetInstanceTint(MeshComp, AeyerjiEnemyCustomData::ArchetypeTint, Bundle.InstanceTint);
+	}
 }
@@ -0,0 +1,498 @@
+// AeyerjiEnemyArchetypeRegistry.cpp
+#include "Enemy/AeyerjiEnemyArchetypeRegistry.h"
+
+#include "Abilities/GameplayAbility.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
+#include "Attributes/AeyerjiAttributeSet.h"
+#include "Director/AeyerjiEncounterDefinition.h"
+#include "Director/AeyerjiEncounterDirector.h"
+#include "Director/AeyerjiLevelDirector.h"
+#include "Director/AeyerjiSpawnerGroup.h"
+#include "Director/AeyerjiWorldSpawnProfile.h"
+#include "Enemy/AeyerjiEnemyArchetypeComponent.h"
+#include "Enemy/AeyerjiEnemyArchetypeLibrary.h"
+#include "Enemy/AeyerjiEnemyTraitComponent.h"
+#include "Enemy/EnemyParentNative.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataTable.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameplayEffect.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/AeyerjiLog.h"
+#include "Materials/MaterialInterface.h"
+
+namespace
+{
+static TAutoConsoleVariable<int32>& GetArchetypePreloadCVar()
+{
+	// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+	static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+		TEXT("aeyerji.Enemy.PreloadArchetypes"),
+		1,
+		TEXT("1 = async-preload and compile every enemy archetype the level can spawn on world begin play. 0 = compile on first spawn."),
+		ECVF_Default);
+	return *CVar;
+}
+
+template <typename TArchetypeData>
+void ValidateArchetype(const TArchetypeData& Data, const FString& DebugName)
+{
+	if (Data.bWarnIfMissingAttackMontage && Data.AttackMontage.IsNull())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Enemy archetype %s has no AttackMontage"), *DebugName);
+	}
+
+	if (Data.bWarnIfMissingInitEffects && Data.InitGameplayEffects.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Enemy archetype %s has no InitGameplayEffects"), *DebugName);
+	}
+
+	if (Data.bWarnIfMissingGrantedTags && Data.GrantedTags.IsEmpty() && !Data.ArchetypeTag.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Enemy archetype %s has no GrantedTags"), *DebugName);
+	}
+}
+
+// Dedicated servers never apply mesh overrides, so they neither load nor keep those assets.
+bool WantsArchetypeVisuals()
+{
+	return !IsRunningDedicatedServer();
+}
+
+template <typename TArchetypeData>
+void CollectArchetypeDependencies(const TArchetypeData& Data, TArray<FSoftObjectPath>& OutPaths)
+{
+	auto Add = [&OutPaths](const FSoftObjectPath& Path)
+	{
+		if (!Path.IsNull())
+		{
+			OutPaths.AddUnique(Path);
+		}
+	};
+
+	Add(Data.AttributeDefaultsTable.ToSoftObjectPath());
+	Add(Data.AttackMontage.ToSoftObjectPath());
+
+	if (WantsArchetypeVisuals())
+	{
+		Add(Data.MeshOverrides.SkeletalMesh.ToSoftObjectPath());
+		for (const TSoftObjectPtr<UMaterialInterface>& Material : Data.MeshOverrides.MaterialOverrides)
+		{
+			Add(Material.ToSoftObjectPath());
+		}
+	}
+}
+
+template <typename TArchetypeData>
+TSharedRef<const FAeyerjiArchetypeBundle> CompileArchetype(const TArchetypeData& Data, const FString& DebugName)
+{
+	ValidateArchetype(Data, DebugName);
+
+	TSharedRef<FAeyerjiArchetypeBundle> Bundle = MakeShared<FAeyerjiArchetypeBundle>();
+	Bundle->ArchetypeTag = Data.ArchetypeTag;
+	Bundle->DebugName = DebugName;
+
+	Bundle->LooseTags = Data.GrantedTags;
+	if (Data.ArchetypeTag.IsValid())
+	{
+		Bundle->LooseTags.AddTag(Data.ArchetypeTag);
+	}
+
+	Bundle->bOverrideTeamId = Data.bOverrideTeamId;
+	Bundle->TeamIdOverride = Data.TeamIdOverride;
+	Bundle->bOverrideTeamTag = Data.bOverrideTeamTag && Data.TeamTagOverride.IsValid();
+	Bundle->TeamTagOverride = Data.TeamTagOverride;
+
+	Bundle->AbilityLevel = FMath::Max(1, Data.AbilityLevel);
+	for (const TSubclassOf<UGameplayAbility>& AbilityClass : Data.GrantedAbilities)
+	{
+		if (*AbilityClass)
+		{
+			Bundle->Abilities.AddUnique(AbilityClass);
+		}
+	}
+
+	Bundle->EffectLevel = FMath::Max(0.01f, Data.EffectLevel);
+	for (const TSubclassOf<UGameplayEffect>& EffectClass : Data.InitGameplayEffects)
+	{
+		if (EffectClass)
+		{
+			Bundle->InitEffects.Add(EffectClass);
+		}
+	}
+
+	Bundle->BasicAttackEffect = Data.BasicAttackEffect;
+
+	for (const TSubclassOf<UAeyerjiEnemyTraitComponent>& TraitClass : Data.TraitComponents)
+	{
+		if (*TraitClass)
+		{
+			Bundle->Traits.AddUnique(TraitClass);
+		}
+	}
+
+	if (!Data.AttributeDefaultsTable.IsNull())
+	{
+		Bundle->AttributeDefaultsTable = Data.AttributeDefaultsTable.LoadSynchronous();
+		Bundle->AttributeSetClass = Data.AttributeSetClass ? Data.AttributeSetClass : TSubclassOf<UAttributeSet>(UAeyerjiAttributeSet::StaticClass());
+	}
+
+	if (!Data.AttackMontage.IsNull())
+	{
+		Bundle->AttackMontage = Data.AttackMontage.LoadSynchronous();
+	}
+
+	Bundle->StatMultipliers = Data.StatMultipliers;
+
+	const FAeyerjiEnemyMeshOverrides& MeshOverrides = Data.MeshOverrides;
+	if (WantsArchetypeVisuals())
+	{
+		if (!MeshOverrides.SkeletalMesh.IsNull())
+		{
+			Bundle->SkeletalMesh = MeshOverrides.SkeletalMesh.LoadSynchronous();
+		}
+
+		Bundle->AnimClass = MeshOverrides.AnimClass;
+		Bundle->bOverrideRelativeTransform = MeshOverrides.bOverrideRelativeTransform;
+		Bundle->RelativeTransform = MeshOverrides.RelativeTransform;
+		Bundle->bApplyInstanceTint = MeshOverrides.bApplyInstanceTint;
+		Bundle->InstanceTint = MeshOverrides.InstanceTint;
+
+		Bundle->MaterialOverrides.SetNum(MeshOverrides.MaterialOverrides.Num());
+		for (int32 Index = 0; Index < MeshOverrides.MaterialOverrides.Num(); ++Index)
+		{
+			if (!MeshOverrides.MaterialOverrides[Index].IsNull())
+			{
+				Bundle->MaterialOverrides[Index] = MeshOverrides.MaterialOverrides[Index].LoadSynchronous();
+			}
+		}
+
+		Bundle->bHasMeshOverrides = Bundle->SkeletalMesh || Bundle->AnimClass || Bundle->bOverrideRelativeTransform || Bundle->bApplyInstanceTint
+			|| Bundle->MaterialOverrides.ContainsByPredicate([](const TObjectPtr<UMaterialInterface>& Material) { return Material != nullptr; });
+	}
+
+	return Bundle;
+}
+
+FString GetEntryDebugName(const FAeyerjiEnemyArchetypeEntry& Entry)
+{
+	return Entry.ArchetypeTag.IsValid() ? Entry.ArchetypeTag.ToString() : TEXT("Unknown");
+}
+} // namespace
+
+UAeyerjiEnemyArchetypeRegistry* UAeyerjiEnemyArchetypeRegistry::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UAeyerjiEnemyArchetypeRegistry>() : nullptr;
+}
+
+TSharedRef<const FAeyerjiArchetypeBundle> UAeyerjiEnemyArchetypeRegistry::Compile(const UAeyerjiEnemyArchetypeData& Data)
+{
+	return CompileArchetype(Data, GetNameSafe(&Data));
+}
+
+TSharedRef<const FAeyerjiArchetypeBundle> UAeyerjiEnemyArchetypeRegistry::Compile(const FAeyerjiEnemyArchetypeEntry& Entry)
+{
+	return CompileArchetype(Entry, GetEntryDebugName(Entry));
+}
+
+TSharedPtr<const FAeyerjiArchetypeBundle> UAeyerjiEnemyArchetypeRegistry::Find(const FSoftObjectPath& Source, const FGameplayTag& Tag) const
+{
+	return Bundles.FindRef(FBundleKey{Source, Tag});
+}
+
+TSharedRef<const FAeyerjiArchetypeBundle> UAeyerjiEnemyArchetypeRegistry::FindOrCompile(const UAeyerjiEnemyArchetypeData& Data)
+{
+	const FBundleKey Key{FSoftObjectPath(&Data), FGameplayTag()};
+	if (const TSharedPtr<const FAeyerjiArchetypeBundle>* Existing = Bundles.Find(Key))
+	{
+		return Existing->ToSharedRef();
+	}
+
+	return AddBundle(Key, Data, Compile(Data));
+}
+
+TSharedRef<const FAeyerjiArchetypeBundle> UAeyerjiEnemyArchetypeRegistry::FindOrCompile(const UAeyerjiEnemyArchetypeLibrary& Library, const FAeyerjiEnemyArchetypeEntry& Entry)
+{
+	const FBundleKey Key{FSoftObjectPath(&Library), Entry.ArchetypeTag};
+	if (const TSharedPtr<const FAeyerjiArchetypeBundle>* Existing = Bundles.Find(Key))
+	{
+		return Existing->ToSharedRef();
+	}
+
+	return AddBundle(Key, Library, Compile(Entry));
+}
+
+TSharedRef<const FAeyerjiArchetypeBundle> UAeyerjiEnemyArchetypeRegistry::AddBundle(const FBundleKey& Key, const UObject& SourceAsset, TSharedRef<const FAeyerjiArchetypeBundle> Bundle)
+{
+	if (bPreloading)
+	{
+		UE_LOG(LogAeyerji, Verbose, TEXT("Enemy archetype %s compiled before the level preload finished."), *Bundle->DebugName);
+	}
+
+	// Source assets hold the hard class references (abilities, effects, traits, anim class).
+	PinnedAssets.AddUnique(const_cast<UObject*>(&SourceAsset));
+
+	auto Pin = [this](UObject* Asset)
+	{
+		if (Asset)
+		{
+			PinnedAssets.AddUnique(Asset);
+		}
+	};
+
+	Pin(Bundle->AttributeDefaultsTable);
+	Pin(Bundle->AttackMontage);
+	Pin(Bundle->SkeletalMesh);
+	for (const TObjectPtr<UMaterialInterface>& Material : Bundle->MaterialOverrides)
+	{
+		Pin(Material);
+	}
+
+	Bundles.Add(Key, Bundle);
+	return Bundle;
+}
+
+bool UAeyerjiEnemyArchetypeRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAeyerjiEnemyArchetypeRegistry::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (GetArchetypePreloadCVar().GetValueOnGameThread() != 0)
+	{
+		StartPreload();
+	}
+}
+
+void UAeyerjiEnemyArchetypeRegistry::Deinitialize()
+{
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+
+	bPreloading = false;
+	PreloadEnemyClasses.Reset();
+	PreloadKeys.Reset();
+	Bundles.Reset();
+	PinnedAssets.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAeyerjiEnemyArchetypeRegistry::StartPreload()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	bPreloading = true;
+	PreloadStartTime = FPlatformTime::Seconds();
+
+	TArray<FSoftObjectPath> ClassPaths;
+	auto AddClass = [&ClassPaths](const UClass* EnemyClass)
+	{
+		if (EnemyClass)
+		{
+			ClassPaths.AddUnique(FSoftObjectPath(EnemyClass));
+		}
+	};
+
+	auto AddGroup = [&AddClass](const UEnemySpawnGroupDefinition* Group)
+	{
+		if (Group)
+		{
+			for (const TSubclassOf<AEnemyParentNative>& EnemyType : Group->EnemyTypes)
+			{
+				AddClass(EnemyType.Get());
+			}
+		}
+	};
+
+	for (TActorIterator<AAeyerjiSpawnerGroup> It(World); It; ++It)
+	{
+		for (const FWaveDefinition& Wave : It->Waves)
+		{
+			for (const FEnemySet& Set : Wave.EnemySets)
+			{
+				AddClass(Set.EnemyClass.Get());
+			}
+		}
+
+		if (const UAeyerjiEncounterDefinition* Encounter = It->EncounterDefinition)
+		{
+			for (const FWaveDefData& Wave : Encounter->Waves)
+			{
+				for (const FEnemySetDef& Set : Wave.EnemySets)
+				{
+					if (!Set.EnemyClass.IsNull())
+					{
+						ClassPaths.AddUnique(Set.EnemyClass.ToSoftObjectPath());
+					}
+				}
+			}
+		}
+	}
+
+	for (TActorIterator<AAeyerjiEncounterDirector> It(World); It; ++It)
+	{
+		for (const UEnemySpawnGroupDefinition* Group : It->GetSpawnGroups())
+		{
+			AddGroup(Group);
+		}
+	}
+
+	for (TActorIterator<AAeyerjiLevelDirector> It(World); It; ++It)
+	{
+		if (const UAeyerjiWorldSpawnProfile* Profile = It->WorldSpawnProfile)
+		{
+			for (const FWeightedSpawnGroup& Weighted : Profile->SpawnGroups)
+			{
+				AddGroup(Weighted.Group);
+			}
+		}
+	}
+
+	for (TActorIterator<AEnemyParentNative> It(World); It; ++It)
+	{
+		AddClass(It->GetClass());
+	}
+
+	PreloadEnemyClasses = ClassPaths;
+	LoadThen(MoveTemp(ClassPaths), &UAeyerjiEnemyArchetypeRegistry::HandleEnemyClassesLoaded);
+}
+
+void UAeyerjiEnemyArchetypeRegistry::LoadThen(TArray<FSoftObjectPath>&& Paths, void (UAeyerjiEnemyArchetypeRegistry::*Next)())
+{
+	Paths.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull() || Path.ResolveObject() != nullptr; });
+
+	if (Paths.IsEmpty())
+	{
+		(this->*Next)();
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(Paths),
+		FStreamableDelegate::CreateUObject(this, Next),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	// The delegate may already have run (and moved on to the next stage) when everything was in memory.
+	if (Handle.IsValid() && Handle->IsLoadingInProgress())
+	{
+		PreloadHandle = Handle;
+	}
+}
+
+void UAeyerjiEnemyArchetypeRegistry::HandleEnemyClassesLoaded()
+{
+	TArray<FSoftObjectPath> SourcePaths;
+
+	for (const FSoftObjectPath& ClassPath : PreloadEnemyClasses)
+	{
+		UClass* EnemyClass = Cast<UClass>(ClassPath.ResolveObject());
+		if (EnemyClass)
+		{
+			// The stage handle is released once the next stage starts; without a pin the class can be collected again
+			// before the first spawn.
+			PinnedAssets.AddUnique(EnemyClass);
+		}
+
+		const AActor* CDO = EnemyClass ? Cast<AActor>(EnemyClass->GetDefaultObject()) : nullptr;
+		const UAeyerjiEnemyArchetypeComponent* Archetype = CDO ? CDO->FindComponentByClass<UAeyerjiEnemyArchetypeComponent>() : nullptr;
+		if (!Archetype)
+		{
+			continue;
+		}
+
+		// Same sources ApplyArchetype resolves: the library entry first, the data asset as fallback.
+		const FSoftObjectPath LibraryPath = Archetype->GetArchetypeLibrarySource().ToSoftObjectPath();
+		const FGameplayTag LibraryTag = Archetype->GetArchetypeLibraryTag();
+		if (!LibraryPath.IsNull() && LibraryTag.IsValid())
+		{
+			PreloadKeys.AddUnique(FBundleKey{LibraryPath, LibraryTag});
+			SourcePaths.AddUnique(LibraryPath);
+		}
+
+		const FSoftObjectPath DataPath = Archetype->GetArchetypeDataSource().ToSoftObjectPath();
+		if (!DataPath.IsNull())
+		{
+			PreloadKeys.AddUnique(FBundleKey{DataPath, FGameplayTag()});
+			SourcePaths.AddUnique(DataPath);
+		}
+	}
+
+	PreloadEnemyClasses.Reset();
+	LoadThen(MoveTemp(SourcePaths), &UAeyerjiEnemyArchetypeRegistry::HandleSourcesLoaded);
+}
+
+void UAeyerjiEnemyArchetypeRegistry::HandleSourcesLoaded()
+{
+	TArray<FSoftObjectPath> DependencyPaths;
+
+	for (const FBundleKey& Key : PreloadKeys)
+	{
+		UObject* Source = Key.Source.ResolveObject();
+		if (Source)
+		{
+			// Same reason as the classes: stay resident while the dependency stage loads.
+			PinnedAssets.AddUnique(Source);
+		}
+
+		if (const UAeyerjiEnemyArchetypeLibrary* Library = Cast<UAeyerjiEnemyArchetypeLibrary>(Source))
+		{
+			if (const FAeyerjiEnemyArchetypeEntry* Entry = Library->FindEntryByTag(Key.Tag))
+			{
+				CollectArchetypeDependencies(*Entry, DependencyPaths);
+			}
+		}
+		else if (const UAeyerjiEnemyArchetypeData* Data = Cast<UAeyerjiEnemyArchetypeData>(Source))
+		{
+			CollectArchetypeDependencies(*Data, DependencyPaths);
+		}
+	}
+
+	LoadThen(MoveTemp(DependencyPaths), &UAeyerjiEnemyArchetypeRegistry::HandleDependenciesLoaded);
+}
+
+void UAeyerjiEnemyArchetypeRegistry::HandleDependenciesLoaded()
+{
+	for (const FBundleKey& Key : PreloadKeys)
+	{
+		UObject* Source = Key.Source.ResolveObject();
+		if (const UAeyerjiEnemyArchetypeLibrary* Library = Cast<UAeyerjiEnemyArchetypeLibrary>(Source))
+		{
+			if (const FAeyerjiEnemyArchetypeEntry* Entry = Library->FindEntryByTag(Key.Tag))
+			{
+				FindOrCompile(*Library, *Entry);
+			}
+		}
+		else if (const UAeyerjiEnemyArchetypeData* Data = Cast<UAeyerjiEnemyArchetypeData>(Source))
+		{
+			FindOrCompile(*Data);
+		}
+	}
+
+	UE_LOG(LogAeyerji, Log, TEXT("Enemy archetype registry: %d archetypes ready for %s (%.1f ms)."),
+		Bundles.Num(), *GetNameSafe(GetWorld()), (FPlatformTime::Seconds() - PreloadStartTime) * 1000.0);
+
+	PreloadKeys.Reset();
+	PreloadHandle.Reset();
+	bPreloading = false;
+}
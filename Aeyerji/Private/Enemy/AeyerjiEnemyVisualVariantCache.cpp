@@ -0,0 +1,193 @@
+// AeyerjiEnemyVisualVariantCache.cpp
+#include "Enemy/AeyerjiEnemyVisualVariantCache.h"
+
+#include "Components/MeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Director/AeyerjiSpawnerGroup.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Materials/MaterialInterface.h"
+
+UAeyerjiEnemyVisualVariantCache* UAeyerjiEnemyVisualVariantCache::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UAeyerjiEnemyVisualVariantCache>() : nullptr;
+}
+
+void UAeyerjiEnemyVisualVariantCache::SetInstanceTint(UPrimitiveComponent* Primitive, int32 FirstIndex, const FLinearColor& Tint)
+{
+	if (Primitive)
+	{
+		Primitive->SetCustomPrimitiveDataVector4(FirstIndex, FVector4(Tint.R, Tint.G, Tint.B, Tint.A));
+	}
+}
+
+void UAeyerjiEnemyVisualVariantCache::ApplyAffixVariants(UMeshComponent* Mesh, TConstArrayView<const FEliteAffixDefinition*> Affixes)
+{
+	if (!Mesh)
+	{
+		return;
+	}
+
+	for (const FEliteAffixDefinition* Affix : Affixes)
+	{
+		if (Affix && Affix->bApplyInstanceTint)
+		{
+			SetInstanceTint(Mesh, AeyerjiEnemyCustomData::EliteTint, Affix->InstanceTint);
+			break;
+		}
+	}
+
+	const FAffixLayer* Layer = FindOrAddLayer(Affixes);
+	if (!Layer)
+	{
+		return;
+	}
+
+	const int32 NumSlots = Mesh->GetNumMaterials();
+	for (int32 Index = 0; Index < NumSlots; ++Index)
+	{
+		UMaterialInterface* Current = Mesh->GetMaterial(Index);
+		if (!Current)
+		{
+			continue;
+		}
+
+		// Re-rolled presentation on a pawn that already shows a variant: start again from its base material.
+		UMaterialInterface* Base = Current;
+		if (VariantLayers.Contains(Current))
+		{
+			Base = CastChecked<UMaterialInstanceDynamic>(Current)->Parent;
+		}
+
+		UMaterialInterface* Variant = Base ? FindOrAddVariant(Base, *Layer) : nullptr;
+		if (Variant && Variant != Current)
+		{
+			Mesh->SetMaterial(Index, Variant);
+		}
+	}
+}
+
+UMaterialInterface* UAeyerjiEnemyVisualVariantCache::RebaseMaterial(const UMaterialInterface* Current, UMaterialInterface* NewBase)
+{
+	if (!Current || !NewBase)
+	{
+		return NewBase;
+	}
+
+	const FAffixLayer* const* Layer = VariantLayers.Find(Current);
+	if (!Layer)
+	{
+		return NewBase;
+	}
+
+	UMaterialInterface* Variant = FindOrAddVariant(NewBase, **Layer);
+	return Variant ? Variant : NewBase;
+}
+
+bool UAeyerjiEnemyVisualVariantCache::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAeyerjiEnemyVisualVariantCache::Deinitialize()
+{
+	Variants.Reset();
+	VariantLayers.Reset();
+	VariantMaterials.Reset();
+	Layers.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAeyerjiEnemyVisualVariantCache::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+const UAeyerjiEnemyVisualVariantCache::FAffixLayer* UAeyerjiEnemyVisualVariantCache::FindOrAddLayer(TConstArrayView<const FEliteAffixDefinition*> Affixes)
+{
+	TArray<const FEliteAffixDefinition*, TInlineAllocator<4>> Contributing;
+	for (const FEliteAffixDefinition* Affix : Affixes)
+	{
+		if (Affix && (!Affix->MaterialScalarParameters.IsEmpty() || !Affix->MaterialVectorParameters.IsEmpty()))
+		{
+			Contributing.Add(Affix);
+		}
+	}
+
+	if (Contributing.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// Roll order must not matter: the same affixes always merge in the same order.
+	Contributing.StableSort([](const FEliteAffixDefinition& A, const FEliteAffixDefinition& B)
+	{
+		return A.AffixTag.GetTagName().LexicalLess(B.AffixTag.GetTagName());
+	});
+
+	FAffixLayer Candidate;
+	for (const FEliteAffixDefinition* Affix : Contributing)
+	{
+		Candidate.AffixTags.Add(Affix->AffixTag);
+		Candidate.ScalarParameters.Append(Affix->MaterialScalarParameters);
+		Candidate.VectorParameters.Append(Affix->MaterialVectorParameters);
+	}
+
+	// Compare parameters too: two spawners may define the same affix tag differently.
+	for (const TUniquePtr<FAffixLayer>& Layer : Layers)
+	{
+		if (Layer->AffixTags == Candidate.AffixTags
+			&& Layer->ScalarParameters.OrderIndependentCompareEqual(Candidate.ScalarParameters)
+			&& Layer->VectorParameters.OrderIndependentCompareEqual(Candidate.VectorParameters))
+		{
+			return Layer.Get();
+		}
+	}
+
+	return Layers.Add_GetRef(MakeUnique<FAffixLayer>(MoveTemp(Candidate))).Get();
+}
+
+UMaterialInterface* UAeyerjiEnemyVisualVariantCache::FindOrAddVariant(UMaterialInterface* BaseMaterial, const FAffixLayer& Layer)
+{
+	const FVariantKey Key{BaseMaterial, &Layer};
+	if (const TWeakObjectPtr<UMaterialInstanceDynamic>* Existing = Variants.Find(Key))
+	{
+		if (UMaterialInstanceDynamic* Variant = Existing->Get())
+		{
+			return Variant;
+		}
+	}
+
+	UMaterialInstanceDynamic* Variant = UMaterialInstanceDynamic::Create(BaseMaterial, this);
+	if (!Variant)
+	{
+		return nullptr;
+	}
+
+	for (const TPair<FName, float>& Param : Layer.ScalarParameters)
+	{
+		Variant->SetScalarParameterValue(Param.Key, Param.Value);
+	}
+	for (const TPair<FName, FLinearColor>& Param : Layer.VectorParameters)
+	{
+		Variant->SetVectorParameterValue(Param.Key, Param.Value);
+	}
+
+	Variants.Add(Key, Variant);
+	VariantLayers.Add(Variant, &Layer);
+	VariantMaterials.Add(Variant);
+
+	UE_LOG(LogTemp, Verbose, TEXT("Enemy visual variant %s created for %s (%d affixes)"),
+		*GetNameSafe(Variant),
+		*GetNameSafe(BaseMaterial),
+		Layer.AffixTags.Num());
+
+	return Variant;
+}
@@ -17,6 +17,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Progression/AeyerjiLevelingComponent.h"
 #include "Progression/AeyerjiRewardConfigComponent.h"
+#include "Systems/AeyerjiServerTelemetry.h"
 #if WITH_EDITOR
 #include "UObject/UnrealType.h"
 #endif
@@ -264,6 +265,10 @@ void AEnemyParentNative::InitAbilityActorInfo()
 		return;
 	}
     AbilitySystemAeyerji->InitAbilityActorInfo(this, this);
+    if (UAeyerjiServerTelemetry* Telemetry = UAeyerjiServerTelemetry::Get(this))
+    {
+        Telemetry->RegisterAbilitySystem(AbilitySystemAeyerji);
+    }
     // Ensure the AttributeSet instance exists so AI can read/write attributes.
     if (!AbilitySystemAeyerji->GetSet<UAeyerjiAttributeSet>())
     {
@@ -291,11 +296,29 @@ void AEnemyParentNative::InitAbilityActorInfo()
 	{
 		AJ_LOG(this, TEXT("HandleASCReady - Adding startup abilities (server)"));
 		AddStartupAbilities();
+
+		AbilitySystemAeyerji->GetGameplayAttributeValueChangeDelegate(UAeyerjiAttributeSet::GetHealthAttribute())
+			.AddUObject(this, &AEnemyParentNative::HandleHealthChanged);
 	}
 	
 	// OPTIONAL: Set tag relationship tables, etc.
 }
 
+void AEnemyParentNative::HandleHealthChanged(const FOnAttributeChangeData& Data)
+{
+	if (Data.NewValue >= Data.OldValue)
+	{
+		return;
+	}
+
+	// A dormant enemy would keep its damage from clients; wake it and let the director wake its cluster.
+	if (NetDormancy > DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+	OnEnemyDisturbed.Broadcast(this);
+}
+
 void AEnemyParentNative::GiveStartupAbilitiesAndEffects()
 {
 	if (bStartupGiven || !AbilitySystemAeyerji || !HasAuthority())
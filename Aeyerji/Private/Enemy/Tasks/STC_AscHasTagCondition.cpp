@@ -5,9 +5,12 @@
 #include "AIController.h"
 #include "Logging/AeyerjiLog.h"
 #include "StateTreeExecutionContext.h"
+#include "Logging/AeyerjiStats.h"
 
 bool USTC_AscHasTagCondition::TestCondition(FStateTreeExecutionContext& Context) const
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeCondition);
+
 	AActor* OwnerActor = Cast<AActor>(Context.GetOwner());
 	AActor* TargetActor = AscOwner;
 	if (!TargetActor)
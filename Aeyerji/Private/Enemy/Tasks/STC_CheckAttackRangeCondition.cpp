@@ -9,9 +9,12 @@
 #include "GameFramework/Pawn.h"
 #include "StateTreeExecutionContext.h"
 #include "Enemy/EnemyAIController.h"
+#include "Logging/AeyerjiStats.h"
 
 bool USTC_CheckAttackRangeCondition::TestCondition(FStateTreeExecutionContext& Context) const
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeCondition);
+
 	AAIController* AI = Cast<AAIController>(Context.GetOwner());
 	APawn* Pawn = AI ? AI->GetPawn() : nullptr;
 	if (!AI || !Pawn)
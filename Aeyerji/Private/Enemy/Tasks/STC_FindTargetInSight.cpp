@@ -17,6 +17,7 @@
 #include "Engine/World.h"
 #include "CollisionQueryParams.h"
 #include "Engine/EngineTypes.h"
+#include "Logging/AeyerjiStats.h"
 
 USTC_FindTargetInSight::USTC_FindTargetInSight(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -33,6 +34,8 @@ static FORCEINLINE float DistSq2D(const FVector& A, const FVector& B)
 
 bool USTC_FindTargetInSight::TestCondition(FStateTreeExecutionContext& Context) const
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeCondition);
+
 	AAIController* AI = Cast<AAIController>(Context.GetOwner());
 	APawn* Self = AI ? AI->GetPawn() : nullptr;
 
@@ -3,9 +3,12 @@
 #include "Enemy/EnemyAIController.h"
 #include "AIController.h"
 #include "StateTreeExecutionContext.h"
+#include "Logging/AeyerjiStats.h"
 
 bool USTC_HasTargetCondition::TestCondition(FStateTreeExecutionContext& Context) const
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeCondition);
+
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     if (!AI)
     {
@@ -8,6 +8,7 @@
 #include "GameFramework/Pawn.h"
 #include "StateTreeExecutionContext.h"
 #include "Logging/AeyerjiLog.h"
+#include "Logging/AeyerjiStats.h"
 
 
 USTT_ActivatePrimaryAttackTask::USTT_ActivatePrimaryAttackTask(const FObjectInitializer& ObjectInitializer)
@@ -20,6 +21,8 @@ USTT_ActivatePrimaryAttackTask::USTT_ActivatePrimaryAttackTask(const FObjectInit
 EStateTreeRunStatus USTT_ActivatePrimaryAttackTask::EnterState(FStateTreeExecutionContext& Context,
                                                                const FStateTreeTransitionResult& Transition)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     UnregisterCompletionListener();
     bRequestedActivation = false;
     bPrimaryAttackCompleted = false;
@@ -29,6 +32,8 @@ EStateTreeRunStatus USTT_ActivatePrimaryAttackTask::EnterState(FStateTreeExecuti
 
 EStateTreeRunStatus USTT_ActivatePrimaryAttackTask::Tick(FStateTreeExecutionContext& Context, float)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     APawn* Pawn = AI ? AI->GetPawn() : nullptr;
     if (!Pawn) return EStateTreeRunStatus::Failed;
@@ -13,6 +13,7 @@
 #include "Abilities/GameplayAbilityTypes.h"
 #include "GameplayTagContainer.h"
 #include "Logging/AeyerjiLog.h"
+#include "Logging/AeyerjiStats.h"
 
 USTT_CycleOwnedAbilitiesTask::USTT_CycleOwnedAbilitiesTask(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -29,6 +30,8 @@ USTT_CycleOwnedAbilitiesTask::USTT_CycleOwnedAbilitiesTask(const FObjectInitiali
 
 EStateTreeRunStatus USTT_CycleOwnedAbilitiesTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
 	PendingAbilityOrder.Reset();
 	ActiveAbilityHandle = FGameplayAbilitySpecHandle();
 	PendingEndedHandle = FGameplayAbilitySpecHandle();
@@ -41,6 +44,8 @@ EStateTreeRunStatus USTT_CycleOwnedAbilitiesTask::EnterState(FStateTreeExecution
 
 EStateTreeRunStatus USTT_CycleOwnedAbilitiesTask::Tick(FStateTreeExecutionContext& Context, float DeltaTime)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
 	AAIController* AI = Cast<AAIController>(Context.GetOwner());
 	APawn* Pawn = AI ? AI->GetPawn() : nullptr;
 	if (!Pawn)
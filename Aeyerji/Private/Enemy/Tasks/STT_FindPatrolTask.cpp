@@ -9,6 +9,7 @@
 #include "GameFramework/Pawn.h"
 #include "StateTreeExecutionContext.h"
 #include "Enemy/EnemyAIController.h"
+#include "Logging/AeyerjiStats.h"
 
 USTT_FindPatrolTask::USTT_FindPatrolTask(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer), OverridePatrolRadius(0.0f), PatrolLocation(FVector::ZeroVector)
@@ -17,6 +18,8 @@ USTT_FindPatrolTask::USTT_FindPatrolTask(const FObjectInitializer& ObjectInitial
 
 EStateTreeRunStatus USTT_FindPatrolTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     // Get AI controller and pawn
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     APawn* Pawn = AI ? AI->GetPawn() : nullptr;
@@ -5,9 +5,12 @@
 #include "AIController.h"
 #include "StateTreeExecutionContext.h"
 #include "Enemy/EnemyAIController.h"
+#include "Logging/AeyerjiStats.h"
 
 EStateTreeRunStatus USTT_FocusTargetTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     // On entering the state, immediately set focus if a target exists.
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     if (AI && AI->GetFocusActor() == nullptr)  // GetFocusActor() returns current focused actor if any
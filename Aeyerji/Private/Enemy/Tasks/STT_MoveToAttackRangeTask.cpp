@@ -13,6 +13,7 @@
 #include "Attributes/AeyerjiAttributeSet.h"
 #include "StateTreeExecutionContext.h"
 #include "Enemy/EnemyAIController.h"
+#include "Logging/AeyerjiStats.h"
 
 #define MOVE_TO_ATTACK_RANGE_LOGGING 0
 
@@ -151,6 +152,8 @@ USTT_MoveToAttackRangeTask::USTT_MoveToAttackRangeTask(const FObjectInitializer&
 
 EStateTreeRunStatus USTT_MoveToAttackRangeTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
 	AAIController* AI = Cast<AAIController>(Context.GetOwner());
 	APawn* Pawn = AI ? AI->GetPawn() : nullptr;
 	if (!AI || !Pawn)
@@ -247,6 +250,8 @@ EStateTreeRunStatus USTT_MoveToAttackRangeTask::EnterState(FStateTreeExecutionCo
 
 EStateTreeRunStatus USTT_MoveToAttackRangeTask::Tick(FStateTreeExecutionContext& Context, float DeltaTime)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
 	AAIController* AI = Cast<AAIController>(Context.GetOwner());
 	APawn* Pawn = AI ? AI->GetPawn() : nullptr;
 	if (!AI || !Pawn)
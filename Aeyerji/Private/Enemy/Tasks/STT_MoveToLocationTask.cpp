@@ -6,6 +6,7 @@
 #include "GameFramework/Pawn.h"
 #include "NavigationSystem.h"
 #include "Enemy/EnemyAIController.h"
+#include "Logging/AeyerjiStats.h"
 
 USTT_MoveToLocationTask::USTT_MoveToLocationTask(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -15,6 +16,8 @@ USTT_MoveToLocationTask::USTT_MoveToLocationTask(const FObjectInitializer& Objec
 EStateTreeRunStatus USTT_MoveToLocationTask::EnterState(FStateTreeExecutionContext& Context,
                                                         const FStateTreeTransitionResult& /*Transition*/)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
 	AAIController* AI = Cast<AAIController>(Context.GetOwner());
 	APawn*         Pawn = AI ? AI->GetPawn() : nullptr;
 
@@ -61,6 +64,8 @@ EStateTreeRunStatus USTT_MoveToLocationTask::EnterState(FStateTreeExecutionConte
 EStateTreeRunStatus USTT_MoveToLocationTask::Tick(FStateTreeExecutionContext& Context,
                                                   const float /*DeltaTime*/)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     APawn*         Pawn = AI ? AI->GetPawn() : nullptr;
 
@@ -10,6 +10,7 @@
 #include "AIController.h"
 #include "StateTreeExecutionContext.h"
 #include "Logging/AeyerjiLog.h"
+#include "Logging/AeyerjiStats.h"
 
 USTT_SetSpeedFromAttributeTask::USTT_SetSpeedFromAttributeTask(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -19,6 +20,8 @@ USTT_SetSpeedFromAttributeTask::USTT_SetSpeedFromAttributeTask(const FObjectInit
 
 EStateTreeRunStatus USTT_SetSpeedFromAttributeTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
 	// Get the controlled character
 	AAIController* AI = Cast<AAIController>(Context.GetOwner());
 	ACharacter* Char = AI ? Cast<ACharacter>(AI->GetPawn()) : nullptr;
@@ -6,6 +6,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AbilitySystemComponent.h"
 #include "StateTreeExecutionContext.h"
+#include "Logging/AeyerjiStats.h"
 
 USTT_SmoothRampDownTask::USTT_SmoothRampDownTask(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -15,6 +16,8 @@ USTT_SmoothRampDownTask::USTT_SmoothRampDownTask(const FObjectInitializer& Objec
 
 EStateTreeRunStatus USTT_SmoothRampDownTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult&)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     ACharacter* Char = AI ? Cast<ACharacter>(AI->GetPawn()) : nullptr;
     if (!Char)
@@ -60,6 +63,8 @@ EStateTreeRunStatus USTT_SmoothRampDownTask::EnterState(FStateTreeExecutionConte
 
 EStateTreeRunStatus USTT_SmoothRampDownTask::Tick(FStateTreeExecutionContext& Context, float)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     if (!CachedMove.IsValid())
     {
         return EStateTreeRunStatus::Failed;
@@ -6,6 +6,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "AbilitySystemComponent.h"
 #include "StateTreeExecutionContext.h"
+#include "Logging/AeyerjiStats.h"
 
 USTT_SmoothRampUpTask::USTT_SmoothRampUpTask(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -15,6 +16,8 @@ USTT_SmoothRampUpTask::USTT_SmoothRampUpTask(const FObjectInitializer& ObjectIni
 
 EStateTreeRunStatus USTT_SmoothRampUpTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult&)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     ACharacter* Char = AI ? Cast<ACharacter>(AI->GetPawn()) : nullptr;
     if (!Char)
@@ -66,6 +69,8 @@ EStateTreeRunStatus USTT_SmoothRampUpTask::EnterState(FStateTreeExecutionContext
 
 EStateTreeRunStatus USTT_SmoothRampUpTask::Tick(FStateTreeExecutionContext& Context, float)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     if (!CachedMove.IsValid())
     {
         return EStateTreeRunStatus::Failed;
@@ -5,6 +5,7 @@
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "StateTreeExecutionContext.h"
+#include "Logging/AeyerjiStats.h"
 
 USTT_SmoothStopPauseTask::USTT_SmoothStopPauseTask(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
@@ -14,6 +15,8 @@ USTT_SmoothStopPauseTask::USTT_SmoothStopPauseTask(const FObjectInitializer& Obj
 
 EStateTreeRunStatus USTT_SmoothStopPauseTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult&)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     AAIController* AI = Cast<AAIController>(Context.GetOwner());
     ACharacter* Char = AI ? Cast<ACharacter>(AI->GetPawn()) : nullptr;
     if (!Char)
@@ -38,6 +41,8 @@ EStateTreeRunStatus USTT_SmoothStopPauseTask::EnterState(FStateTreeExecutionCont
 
 EStateTreeRunStatus USTT_SmoothStopPauseTask::Tick(FStateTreeExecutionContext& Context, float)
 {
+    AJ_SCOPE_CYCLE(STAT_AJ_StateTreeTask);
+
     if (!CachedMove.IsValid())
     {
         return EStateTreeRunStatus::Failed;
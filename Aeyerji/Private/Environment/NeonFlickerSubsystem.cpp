@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+#include "Environment/NeonFlickerSubsystem.h"
+
+#include "Environment/NeonRailFlickerComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/AeyerjiStats.h"
+
+namespace
+{
+	static TAutoConsoleVariable<float>& GetFlickerCullDistanceCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Neon.FlickerCullDistance"),
+			6000.f,
+			TEXT("Neon rails farther than this from every local view stop flickering until they are back in range. 0 disables."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	/** How often suspension is re-evaluated, and how far a suspended event is pushed back. */
+	constexpr double SuspensionCheckInterval = 0.25;
+	constexpr double SuspendedRetryDelay = 0.5;
+
+	/** Floor on toggle delays so a zero-length on/off range cannot spin inside one frame. */
+	constexpr float MinToggleDelay = 0.01f;
+}
+
+UNeonFlickerSubsystem* UNeonFlickerSubsystem::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UNeonFlickerSubsystem>() : nullptr;
+}
+
+bool UNeonFlickerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && !IsRunningDedicatedServer();
+}
+
+bool UNeonFlickerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNeonFlickerSubsystem::Deinitialize()
+{
+	Events.Reset();
+	RegisteredComponents.Reset();
+	SuspendedComponents.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UNeonFlickerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNeonFlickerSubsystem, STATGROUP_Tickables);
+}
+
+void UNeonFlickerSubsystem::ScheduleToggle(UNeonRailFlickerComponent* Component, int32 SegmentIndex, uint32 Generation, float Delay)
+{
+	const UWorld* World = GetWorld();
+	if (!World || !Component)
+	{
+		return;
+	}
+
+	FFlickerEvent Event;
+	Event.DueTime = World->GetTimeSeconds() + FMath::Max(MinToggleDelay, Delay);
+	Event.Component = Component;
+	Event.SegmentIndex = SegmentIndex;
+	Event.Generation = Generation;
+	Events.HeapPush(MoveTemp(Event));
+
+	RegisteredComponents.Add(Component);
+}
+
+void UNeonFlickerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Events.Num() == 0)
+	{
+		return;
+	}
+
+	AJ_SCOPE_CYCLE(STAT_AJ_NeonFlicker);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	if (Now >= NextSuspensionCheckTime)
+	{
+		UpdateSuspension();
+		NextSuspensionCheckTime = Now + SuspensionCheckInterval;
+	}
+
+	TArray<UNeonRailFlickerComponent*, TInlineAllocator<16>> Touched;
+
+	while (Events.Num() > 0 && Events.HeapTop().DueTime <= Now)
+	{
+		FFlickerEvent Event;
+		Events.HeapPop(Event, EAllowShrinking::No);
+
+		UNeonRailFlickerComponent* Component = Event.Component.Get();
+		if (!Component || Component->FlickerGeneration != Event.Generation)
+		{
+			continue;
+		}
+
+		if (SuspendedComponents.Contains(Event.Component))
+		{
+			// Jitter so a rail coming back into range does not resume with every segment in lockstep.
+			Event.DueTime = Now + SuspendedRetryDelay * (1.0 + FMath::FRand());
+			Events.HeapPush(MoveTemp(Event));
+			continue;
+		}
+
+		Component->ToggleSegment(Event.SegmentIndex);
+		Touched.AddUnique(Component);
+	}
+
+	for (UNeonRailFlickerComponent* Component : Touched)
+	{
+		Component->FlushBatchedUpdates();
+	}
+}
+
+void UNeonFlickerSubsystem::UpdateSuspension()
+{
+	SuspendedComponents.Reset();
+
+	for (auto It = RegisteredComponents.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const float CullDistance = GetFlickerCullDistanceCVar().GetValueOnGameThread();
+	if (CullDistance <= 0.f)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	// No view yet (loading, spectator handoff): keep everything running rather than freezing the level dark.
+	if (ViewLocations.Num() == 0)
+	{
+		return;
+	}
+
+	const double CullDistanceSq = FMath::Square(static_cast<double>(CullDistance));
+	for (const TWeakObjectPtr<UNeonRailFlickerComponent>& WeakComponent : RegisteredComponents)
+	{
+		const UNeonRailFlickerComponent* Component = WeakComponent.Get();
+		if (!Component || !Component->FlickerBounds.IsValid)
+		{
+			continue;
+		}
+
+		// Rails are long: measure against their bounds rather than the actor pivot.
+		const FBox& Bounds = Component->FlickerBounds;
+
+		const bool bInRange = ViewLocations.ContainsByPredicate([&Bounds, CullDistanceSq](const FVector& ViewLocation)
+		{
+			return Bounds.ComputeSquaredDistanceToPoint(ViewLocation) <= CullDistanceSq;
+		});
+
+		if (!bInRange)
+		{
+			SuspendedComponents.Add(WeakComponent);
+		}
+	}
+}
@@ -32,6 +32,12 @@ ANeonRailActor::ANeonRailActor()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
+#if WITH_EDITORONLY_DATA
+	// Rerunning construction destroys and respawns every segment; while dragging spline points the builder's
+	// debounced incremental rebuild keeps the rail live instead.
+	bRunConstructionScriptOnDrag = false;
+#endif
+
 	Spline = CreateDefaultSubobject<USplineComponent>(TEXT("Spline"));
 	RootComponent = Spline;
 	Spline->bDrawDebug = true;
@@ -73,7 +79,14 @@ void ANeonRailActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChang
 
 	if (RailBuilder && bAutoRebuildOnConstruction)
 	{
-		RailBuilder->BuildRail();
+		if (PropertyChangedEvent.ChangeType == EPropertyChangeType::Interactive)
+		{
+			RailBuilder->RequestRebuild();
+		}
+		else
+		{
+			RailBuilder->BuildRail();
+		}
 	}
 
 	if (Flicker)
@@ -3,14 +3,21 @@
 
 #include "Components/SplineComponent.h"
 #include "Components/SplineMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 
 UNeonRailBuilderComponent::UNeonRailBuilderComponent()
 {
+#if WITH_EDITOR
+	// Ticks only to watch the spline in editor worlds; game worlds build once on register.
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
 	bTickInEditor = true;
+#else
+	PrimaryComponentTick.bCanEverTick = false;
+#endif
 }
 
 void UNeonRailBuilderComponent::OnRegister()
@@ -21,6 +28,21 @@ void UNeonRailBuilderComponent::OnRegister()
 	BuildRail();
 }
 
+void UNeonRailBuilderComponent::OnUnregister()
+{
+	SegmentBuild.Cancel();
+
+	Super::OnUnregister();
+}
+
+void UNeonRailBuilderComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// PIE: the rail is final once play starts.
+	SetComponentTickEnabled(false);
+}
+
 void UNeonRailBuilderComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -42,7 +64,7 @@ void UNeonRailBuilderComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 	{
 		CachedSplineVersion = CurrentVersion;
 		bHasCachedVersion = true;
-		BuildRail();
+		RequestRebuild();
 	}
 #endif
 }
@@ -53,7 +75,16 @@ void UNeonRailBuilderComponent::PostEditChangeProperty(FPropertyChangedEvent& Pr
 	Super::PostEditChangeProperty(PropertyChangedEvent);
 
 	CacheSplineVersion();
-	BuildRail();
+
+	// Slider drags fire every frame; let the debounced path absorb them.
+	if (PropertyChangedEvent.ChangeType == EPropertyChangeType::Interactive)
+	{
+		RequestRebuild();
+	}
+	else
+	{
+		BuildRail();
+	}
 }
 #endif
 
@@ -82,6 +113,20 @@ void UNeonRailBuilderComponent::ClearPreviousMeshes()
 {
 	SpawnedSegments.Reset();
 
+	// The instanced rail is a single component owned by this builder: reuse it across rebuilds, drop it when the mode changes.
+	if (UInstancedStaticMeshComponent* Instanced = GetInstancedRail())
+	{
+		if (RenderMode == ENeonRailRenderMode::Instanced)
+		{
+			Instanced->ClearInstances();
+		}
+		else
+		{
+			Instanced->DestroyComponent();
+			InstancedRail.Reset();
+		}
+	}
+
 	if (!bClearPrevious)
 	{
 		return;
@@ -105,6 +150,15 @@ void UNeonRailBuilderComponent::ClearPreviousMeshes()
 	}
 }
 
+FSplineSegmentBuildInput UNeonRailBuilderComponent::MakeBuildInput(const USplineComponent& UseSpline) const
+{
+	FSplineSegmentBuildInput Input = FSplineSegmentBuildInput::FromSpline(UseSpline);
+	Input.SegmentLength = SegmentLength;
+	Input.TangentScale = TangentScale;
+	Input.Offset = FVector(0.f, 0.f, Height);
+	return Input;
+}
+
 void UNeonRailBuilderComponent::BuildRail()
 {
 	USplineComponent* UseSpline = ResolveSpline();
@@ -113,42 +167,85 @@ void UNeonRailBuilderComponent::BuildRail()
 		return;
 	}
 
-	ClearPreviousMeshes();
+	SegmentBuild.BuildNow(MakeBuildInput(*UseSpline), [this](TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32>)
+	{
+		CommitFullRebuild(Segments);
+	});
 
-	const float SplineLength = UseSpline->GetSplineLength();
-	if (SplineLength <= KINDA_SMALL_NUMBER)
+	CacheSplineVersion();
+}
+
+void UNeonRailBuilderComponent::RequestRebuild()
+{
+	USplineComponent* UseSpline = ResolveSpline();
+	if (!UseSpline || SegmentLength <= KINDA_SMALL_NUMBER)
 	{
-		OnRailRebuilt.Broadcast(this);
-		CacheSplineVersion();
 		return;
 	}
 
-	const int32 NumSteps = FMath::CeilToInt(SplineLength / SegmentLength);
-	if (NumSteps <= 0)
+#if WITH_EDITOR
+	const UWorld* World = GetWorld();
+	if (World && !World->IsGameWorld())
+	{
+		SegmentBuild.RequestBuild(this, MakeBuildInput(*UseSpline), [this](TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32> Changed)
+		{
+			CommitChangedSegments(Segments, Changed);
+		});
+		return;
+	}
+#endif
+
+	BuildRail();
+}
+
+void UNeonRailBuilderComponent::CommitFullRebuild(TConstArrayView<FSplineSegmentParams> Segments)
+{
+	ClearPreviousMeshes();
+
+	USplineComponent* UseSpline = ResolveSpline();
+	if (!UseSpline || Segments.Num() == 0)
 	{
 		OnRailRebuilt.Broadcast(this);
-		CacheSplineVersion();
 		return;
 	}
 
-	for (int32 Index = 0; Index < NumSteps; ++Index)
+	if (RenderMode == ENeonRailRenderMode::Instanced)
 	{
-		const float StartDistance = Index * SegmentLength;
-		const float EndDistance = FMath::Min(StartDistance + SegmentLength, SplineLength);
+		UInstancedStaticMeshComponent* Instanced = TubeMesh ? ResolveOrCreateInstancedRail(*UseSpline) : nullptr;
+		if (!Instanced)
+		{
+			OnRailRebuilt.Broadcast(this);
+			return;
+		}
+
+		TArray<FTransform> Transforms;
+		Transforms.Reserve(Segments.Num());
+		for (const FSplineSegmentParams& Segment : Segments)
+		{
+			Transforms.Add(MakeInstancedSegmentTransform(Segment));
+		}
 
-		if (EndDistance <= StartDistance + KINDA_SMALL_NUMBER)
+		// One batched add and one render-state update for the whole rail
+		Instanced->AddInstances(Transforms, /*bShouldReturnIndices*/ false, /*bWorldSpace*/ false);
+		for (int32 InstanceIndex = 0; InstanceIndex < Transforms.Num(); ++InstanceIndex)
 		{
-			continue;
+			Instanced->SetCustomDataValue(InstanceIndex, 0, InstanceGlowValue, /*bMarkRenderStateDirty*/ false);
 		}
+		Instanced->MarkRenderStateDirty();
 
-		SpawnOneSegment(StartDistance, EndDistance);
+		OnRailRebuilt.Broadcast(this);
+		return;
+	}
+
+	for (const FSplineSegmentParams& Segment : Segments)
+	{
+		SpawnOneSegment(*UseSpline, Segment);
 	}
 
 	OnRailRebuilt.Broadcast(this);
-	CacheSplineVersion();
 }
 
-void UNeonRailBuilderComponent::SpawnOneSegment(const float T0, const float T1)
+void UNeonRailBuilderComponent::CommitChangedSegments(TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32> Changed)
 {
 	USplineComponent* UseSpline = ResolveSpline();
 	if (!UseSpline)
@@ -156,21 +253,99 @@ void UNeonRailBuilderComponent::SpawnOneSegment(const float T0, const float T1)
 		return;
 	}
 
-	FVector StartLocation = UseSpline->GetLocationAtDistanceAlongSpline(T0, ESplineCoordinateSpace::Local);
-	FVector EndLocation = UseSpline->GetLocationAtDistanceAlongSpline(T1, ESplineCoordinateSpace::Local);
+	if (RenderMode == ENeonRailRenderMode::Instanced)
+	{
+		UInstancedStaticMeshComponent* Instanced = GetInstancedRail();
+		if (!Instanced || !TubeMesh || Instanced->GetStaticMesh() != TubeMesh || Segments.Num() == 0)
+		{
+			CommitFullRebuild(Segments);
+			return;
+		}
+
+		const int32 ExistingCount = Instanced->GetInstanceCount();
+		TArray<FTransform> Added;
+		for (const int32 Index : Changed)
+		{
+			const FTransform InstanceTransform = MakeInstancedSegmentTransform(Segments[Index]);
+			if (Index < ExistingCount)
+			{
+				Instanced->UpdateInstanceTransform(Index, InstanceTransform, /*bWorldSpace*/ false, /*bMarkRenderStateDirty*/ false, /*bTeleport*/ true);
+			}
+			else
+			{
+				Added.Add(InstanceTransform);
+			}
+		}
+
+		if (Added.Num() > 0)
+		{
+			Instanced->AddInstances(Added, /*bShouldReturnIndices*/ false, /*bWorldSpace*/ false);
+			for (int32 InstanceIndex = ExistingCount; InstanceIndex < Instanced->GetInstanceCount(); ++InstanceIndex)
+			{
+				Instanced->SetCustomDataValue(InstanceIndex, 0, InstanceGlowValue, /*bMarkRenderStateDirty*/ false);
+			}
+		}
+
+		if (ExistingCount > Segments.Num())
+		{
+			TArray<int32> Removed;
+			for (int32 InstanceIndex = ExistingCount - 1; InstanceIndex >= Segments.Num(); --InstanceIndex)
+			{
+				Removed.Add(InstanceIndex);
+			}
+			Instanced->RemoveInstances(Removed);
+		}
+
+		Instanced->MarkRenderStateDirty();
+		OnRailRebuilt.Broadcast(this);
+		return;
+	}
+
+	// A construction-script rerun or a mode switch leaves nothing to patch; start over.
+	CacheTaggedSegmentsIfNeeded();
+	bool bIntact = GetInstancedRail() == nullptr;
+	for (const TWeakObjectPtr<USplineMeshComponent>& WeakSegment : SpawnedSegments)
+	{
+		bIntact &= WeakSegment.IsValid();
+	}
 
-	FVector StartTangent = UseSpline->GetTangentAtDistanceAlongSpline(T0, ESplineCoordinateSpace::Local);
-	FVector EndTangent = UseSpline->GetTangentAtDistanceAlongSpline(T1, ESplineCoordinateSpace::Local);
+	if (!bIntact)
+	{
+		CommitFullRebuild(Segments);
+		return;
+	}
 
-	StartLocation.Z += Height;
-	EndLocation.Z += Height;
+	// Changed is ascending and covers every index past the current count, so spawns append in segment order.
+	for (const int32 Index : Changed)
+	{
+		if (SpawnedSegments.IsValidIndex(Index))
+		{
+			ApplySegment(*SpawnedSegments[Index].Get(), Segments[Index]);
+		}
+		else
+		{
+			SpawnOneSegment(*UseSpline, Segments[Index]);
+		}
+	}
 
-	if (!FMath::IsNearlyEqual(TangentScale, 1.f))
+	while (SpawnedSegments.Num() > Segments.Num())
 	{
-		StartTangent *= TangentScale;
-		EndTangent *= TangentScale;
+		if (USplineMeshComponent* Extra = SpawnedSegments.Pop().Get())
+		{
+			Extra->DestroyComponent();
+		}
 	}
 
+	OnRailRebuilt.Broadcast(this);
+}
+
+void UNeonRailBuilderComponent::ApplySegment(USplineMeshComponent& SplineMesh, const FSplineSegmentParams& Segment) const
+{
+	SplineMesh.SetStartAndEnd(Segment.StartPos, Segment.StartTangent, Segment.EndPos, Segment.EndTangent, true);
+}
+
+void UNeonRailBuilderComponent::SpawnOneSegment(USplineComponent& UseSpline, const FSplineSegmentParams& Segment)
+{
 	AActor* Owner = GetOwner();
 	if (!Owner)
 	{
@@ -187,7 +362,7 @@ void UNeonRailBuilderComponent::SpawnOneSegment(const float T0, const float T1)
 	SplineMesh->CreationMethod = EComponentCreationMethod::UserConstructionScript;
 	SplineMesh->ComponentTags.Add(RailTag());
 
-	SplineMesh->AttachToComponent(UseSpline, FAttachmentTransformRules(EAttachmentRule::KeepRelative, true));
+	SplineMesh->AttachToComponent(&UseSpline, FAttachmentTransformRules(EAttachmentRule::KeepRelative, true));
 
 	if (TubeMesh)
 	{
@@ -201,13 +376,132 @@ void UNeonRailBuilderComponent::SpawnOneSegment(const float T0, const float T1)
 
 	const ESplineMeshAxis::Type ForwardAxisType = static_cast<ESplineMeshAxis::Type>(ForwardAxis.GetValue());
 	SplineMesh->SetForwardAxis(ForwardAxisType, true);
-	SplineMesh->SetStartAndEnd(StartLocation, StartTangent, EndLocation, EndTangent, true);
+	ApplySegment(*SplineMesh, Segment);
 
 	SplineMesh->RegisterComponent();
 
 	SpawnedSegments.Add(SplineMesh);
 }
 
+bool UNeonRailBuilderComponent::MakeChordInstanceTransform(const UStaticMesh& Mesh, const ESplineMeshAxis::Type InForwardAxis, const FVector& Start, const FVector& End,
+                                                           const FVector2D& CrossScale, const float RollRadians, FTransform& OutTransform)
+{
+	const int32 AxisIndex = static_cast<int32>(InForwardAxis);
+	const FBoxSphereBounds MeshBounds = Mesh.GetBounds();
+	const float MeshLength = MeshBounds.BoxExtent[AxisIndex] * 2.f;
+
+	const FVector Chord = End - Start;
+	const float ChordLength = Chord.Size();
+	if (ChordLength <= KINDA_SMALL_NUMBER || MeshLength <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	const FVector Direction = Chord / ChordLength;
+
+	FQuat Rotation;
+	switch (InForwardAxis)
+	{
+	case ESplineMeshAxis::Y: Rotation = FRotationMatrix::MakeFromY(Direction).ToQuat(); break;
+	case ESplineMeshAxis::Z: Rotation = FRotationMatrix::MakeFromZ(Direction).ToQuat(); break;
+	default:                 Rotation = FRotationMatrix::MakeFromX(Direction).ToQuat(); break;
+	}
+
+	if (!FMath::IsNearlyZero(RollRadians))
+	{
+		Rotation = FQuat(Direction, RollRadians) * Rotation;
+	}
+
+	// Stretch along the forward axis so the mesh bounds span the chord, matching how a spline mesh maps it;
+	// the cross axes follow the spline mesh convention (X: Y,Z  Y: Z,X  Z: X,Y).
+	FVector Scale = FVector::OneVector;
+	Scale[AxisIndex] = ChordLength / MeshLength;
+	Scale[(AxisIndex + 1) % 3] = CrossScale.X;
+	Scale[(AxisIndex + 2) % 3] = CrossScale.Y;
+
+	FVector AxisVector = FVector::ZeroVector;
+	AxisVector[AxisIndex] = 1.f;
+	const float MeshMin = MeshBounds.Origin[AxisIndex] - MeshBounds.BoxExtent[AxisIndex];
+	const FVector Location = Start - Rotation.RotateVector(AxisVector * MeshMin * Scale[AxisIndex]);
+
+	OutTransform = FTransform(Rotation, Location, Scale);
+	return true;
+}
+
+FTransform UNeonRailBuilderComponent::MakeInstancedSegmentTransform(const FSplineSegmentParams& Segment) const
+{
+	FTransform InstanceTransform;
+	if (!TubeMesh || !MakeChordInstanceTransform(*TubeMesh, static_cast<ESplineMeshAxis::Type>(ForwardAxis.GetValue()), Segment.StartPos, Segment.EndPos,
+	                                             FVector2D::UnitVector, 0.f, InstanceTransform))
+	{
+		InstanceTransform = FTransform(FQuat::Identity, Segment.StartPos, FVector::ZeroVector);
+	}
+	return InstanceTransform;
+}
+
+UInstancedStaticMeshComponent* UNeonRailBuilderComponent::ResolveOrCreateInstancedRail(USplineComponent& UseSpline)
+{
+	UInstancedStaticMeshComponent* Instanced = GetInstancedRail();
+	if (!Instanced)
+	{
+		AActor* Owner = GetOwner();
+		if (!Owner)
+		{
+			return nullptr;
+		}
+
+		Instanced = NewObject<UInstancedStaticMeshComponent>(Owner, UInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
+		Instanced->SetMobility(EComponentMobility::Movable);
+		Instanced->CreationMethod = EComponentCreationMethod::UserConstructionScript;
+		Instanced->ComponentTags.Add(RailTag());
+		Instanced->AttachToComponent(&UseSpline, FAttachmentTransformRules(EAttachmentRule::KeepRelative, true));
+		Instanced->NumCustomDataFloats = 1;
+		Instanced->RegisterComponent();
+		InstancedRail = Instanced;
+	}
+
+	if (Instanced->GetStaticMesh() != TubeMesh)
+	{
+		Instanced->SetStaticMesh(TubeMesh);
+	}
+
+	if (NeonMaterial && Instanced->GetMaterial(0) != NeonMaterial)
+	{
+		Instanced->SetMaterial(0, NeonMaterial);
+	}
+
+	if (Instanced->NumCustomDataFloats != 1)
+	{
+		Instanced->SetNumCustomDataFloats(1);
+	}
+
+	return Instanced;
+}
+
+UInstancedStaticMeshComponent* UNeonRailBuilderComponent::GetInstancedRail() const
+{
+	if (UInstancedStaticMeshComponent* Cached = InstancedRail.Get())
+	{
+		return Cached;
+	}
+
+	// Construction-script reruns and loads drop the transient pointer; find the tagged component again.
+	if (AActor* Owner = GetOwner())
+	{
+		TInlineComponentArray<UInstancedStaticMeshComponent*> Components(Owner);
+		for (UInstancedStaticMeshComponent* Component : Components)
+		{
+			if (IsValid(Component) && Component->ComponentHasTag(RailTag()))
+			{
+				InstancedRail = Component;
+				return Component;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
 void UNeonRailBuilderComponent::CacheTaggedSegmentsIfNeeded() const
 {
 	if (SpawnedSegments.Num() > 0)
@@ -2,9 +2,10 @@
 #include "Environment/NeonRailFlickerComponent.h"
 
 #include "Components/SplineMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Environment/NeonRailBuilderComponent.h"
+#include "Environment/NeonFlickerSubsystem.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "TimerManager.h"
 
 UNeonRailFlickerComponent::UNeonRailFlickerComponent()
 {
@@ -61,6 +62,12 @@ void UNeonRailFlickerComponent::RefreshSegments()
 		bHasBoundDelegate = true;
 	}
 
+	if (UInstancedStaticMeshComponent* Instanced = Builder->GetInstancedRail())
+	{
+		SetupForInstances(Instanced);
+		return;
+	}
+
 	TArray<USplineMeshComponent*> Segments;
 	Builder->GetSpawnedSegments(Segments);
 	SetupForSegments(Segments);
@@ -117,25 +124,93 @@ void UNeonRailFlickerComponent::SetupForSegments(const TArray<USplineMeshCompone
 		SegmentMaterials.Add(DynMaterial);
 	}
 
-	for (int32 Index = 0; Index < TrackedSegments.Num(); ++Index)
+	CacheFlickerBounds();
+	StartInitialToggles();
+}
+
+void UNeonRailFlickerComponent::SetupForInstances(UInstancedStaticMeshComponent* Instanced)
+{
+	ClearFlickerState();
+
+	const int32 NumInstances = Instanced ? Instanced->GetInstanceCount() : 0;
+	if (NumInstances == 0 || Instanced->NumCustomDataFloats < 1)
 	{
-		const float InitialDelay = bRandomiseInitialDelay ? FMath::FRandRange(MinOnTime, MaxOnTime) : GetRandomOnTime();
-		ScheduleNextToggle(Index, InitialDelay);
+		return;
+	}
+
+	FlickerInstances = Instanced;
+	TrackedSegments.Reserve(NumInstances);
+
+	for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
+	{
+		TrackedSegments.Emplace(InstanceIndex);
+		if (bAffectMaterial)
+		{
+			Instanced->SetCustomDataValue(InstanceIndex, 0, EmissiveOnValue, /*bMarkRenderStateDirty*/ false);
+		}
+	}
+
+	if (bAffectMaterial)
+	{
+		Instanced->MarkRenderStateDirty();
 	}
+
+	CacheFlickerBounds();
+	StartInitialToggles();
 }
 
-void UNeonRailFlickerComponent::ClearFlickerState()
+void UNeonRailFlickerComponent::CacheFlickerBounds()
 {
-	if (UWorld* World = GetWorld())
+	FlickerBounds = FBox(ForceInit);
+
+	if (UInstancedStaticMeshComponent* Instanced = FlickerInstances.Get())
 	{
-		for (FFlickerSegment& Segment : TrackedSegments)
+		FlickerBounds = Instanced->Bounds.GetBox();
+		return;
+	}
+
+	for (const FFlickerSegment& Entry : TrackedSegments)
+	{
+		if (const USplineMeshComponent* Segment = Entry.Segment.Get())
 		{
-			World->GetTimerManager().ClearTimer(Segment.TimerHandle);
+			FlickerBounds += Segment->Bounds.GetBox();
 		}
 	}
+}
+
+void UNeonRailFlickerComponent::FlushBatchedUpdates()
+{
+	if (!bInstanceDataDirty)
+	{
+		return;
+	}
+
+	bInstanceDataDirty = false;
+	if (UInstancedStaticMeshComponent* Instanced = FlickerInstances.Get())
+	{
+		Instanced->MarkRenderStateDirty();
+	}
+}
+
+void UNeonRailFlickerComponent::StartInitialToggles()
+{
+	for (int32 Index = 0; Index < TrackedSegments.Num(); ++Index)
+	{
+		const float InitialDelay = bRandomiseInitialDelay ? FMath::FRandRange(MinOnTime, MaxOnTime) : GetRandomOnTime();
+		ScheduleNextToggle(Index, InitialDelay);
+	}
+}
+
+void UNeonRailFlickerComponent::ClearFlickerState()
+{
+	// Outstanding subsystem events carry the old generation and are dropped when they come due.
+	++FlickerGeneration;
+	bInstanceDataDirty = false;
+	FlickerBounds = FBox(ForceInit);
 
 	TrackedSegments.Reset();
 	SegmentMaterials.Reset();
+	FlickerInstances.Reset();
 }
 
 void UNeonRailFlickerComponent::ApplySegmentState(int32 Index, bool bIsLit)
@@ -146,6 +221,25 @@ void UNeonRailFlickerComponent::ApplySegmentState(int32 Index, bool bIsLit)
 	}
 
 	FFlickerSegment& Entry = TrackedSegments[Index];
+
+	if (Entry.InstanceIndex != INDEX_NONE)
+	{
+		UInstancedStaticMeshComponent* Instanced = FlickerInstances.Get();
+		if (!Instanced)
+		{
+			return;
+		}
+
+		Entry.bIsLit = bIsLit;
+		if (bAffectMaterial)
+		{
+			// Flushed once per frame for the whole rail by the flicker subsystem
+			Instanced->SetCustomDataValue(Entry.InstanceIndex, 0, bIsLit ? EmissiveOnValue : EmissiveOffValue, /*bMarkRenderStateDirty*/ false);
+			bInstanceDataDirty = true;
+		}
+		return;
+	}
+
 	USplineMeshComponent* Segment = Entry.Segment.Get();
 	if (!Segment)
 	{
@@ -178,22 +272,11 @@ void UNeonRailFlickerComponent::ScheduleNextToggle(int32 Index, float OverrideDe
 		return;
 	}
 
-	if (UWorld* World = GetWorld())
+	if (UNeonFlickerSubsystem* Scheduler = UNeonFlickerSubsystem::Get(this))
 	{
-		FFlickerSegment& Entry = TrackedSegments[Index];
+		const FFlickerSegment& Entry = TrackedSegments[Index];
 		const float Delay = (OverrideDelay >= 0.f) ? OverrideDelay : (Entry.bIsLit ? GetRandomOnTime() : GetRandomOffTime());
-
-		if (Delay <= KINDA_SMALL_NUMBER)
-		{
-			ToggleSegment(Index);
-			return;
-		}
-
-		World->GetTimerManager().SetTimer(
-			Entry.TimerHandle,
-			FTimerDelegate::CreateUObject(this, &UNeonRailFlickerComponent::ToggleSegment, Index),
-			Delay,
-			false);
+		Scheduler->ScheduleToggle(this, Index, FlickerGeneration, Delay);
 	}
 }
 
@@ -205,8 +288,8 @@ void UNeonRailFlickerComponent::ToggleSegment(int32 Index)
 	}
 
 	FFlickerSegment& Entry = TrackedSegments[Index];
-	USplineMeshComponent* Segment = Entry.Segment.Get();
-	if (!Segment)
+	const bool bTargetAlive = Entry.InstanceIndex != INDEX_NONE ? FlickerInstances.IsValid() : Entry.Segment.IsValid();
+	if (!bTargetAlive)
 	{
 		return;
 	}
@@ -2,6 +2,8 @@
 
 #include "Components/SplineComponent.h"
 #include "Components/SplineMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Environment/NeonRailBuilderComponent.h"
 #include "Components/RectLightComponent.h"
 #include "Components/PointLightComponent.h"
 #include "Components/SceneComponent.h"
@@ -34,6 +36,9 @@ ANeonStripSplineActor::ANeonStripSplineActor()
     RollDegrees = 0.0f;
     MeshZOffset = 0.5f;
     ForwardAxis = ESplineMeshAxis::X;
+    bInstancedSegments = false;
+    InstanceSegmentLength = 100.0f;
+    InstanceGlowValue = 5.0f;
 
     bGenerateLights = true;
     LightMode = ENeonLightMode::Rect;
@@ -101,6 +106,15 @@ void ANeonStripSplineActor::ClearGeneratedComponents()
         }
     }
 
+    TInlineComponentArray<UInstancedStaticMeshComponent*> Instanced(this);
+    for (UInstancedStaticMeshComponent* C : Instanced)
+    {
+        if (IsValid(C) && C->ComponentTags.Contains(kNeonMeshTag))
+        {
+            C->DestroyComponent();
+        }
+    }
+
     // Remove previous generated lights (rect or point)
     {
         TInlineComponentArray<URectLightComponent*> Rects(this);
@@ -137,6 +151,12 @@ void ANeonStripSplineActor::BuildMeshes()
         return;
     }
 
+    if (bInstancedSegments)
+    {
+        BuildInstancedMeshes();
+        return;
+    }
+
     const float ScaleY = FMath::Max(0.0f, StripWidth / 100.0f);
     const float ScaleZ = FMath::Max(0.0f, StripThickness / 100.0f);
 
@@ -177,6 +197,58 @@ void ANeonStripSplineActor::BuildMeshes()
     }
 }
 
+void ANeonStripSplineActor::BuildInstancedMeshes()
+{
+    const float Length = Spline->GetSplineLength();
+    const int32 Steps = FMath::Max(1, FMath::CeilToInt(Length / FMath::Max(10.0f, InstanceSegmentLength)));
+    const FVector2D CrossScale(FMath::Max(0.0f, StripWidth / 100.0f), FMath::Max(0.0f, StripThickness / 100.0f));
+    const FVector ZOffset(0.f, 0.f, MeshZOffset);
+
+    TArray<FTransform> Transforms;
+    Transforms.Reserve(Steps);
+    for (int32 s = 0; s < Steps; ++s)
+    {
+        const float D0 = (s / (float)Steps) * Length;
+        const float D1 = ((s + 1) / (float)Steps) * Length;
+        const FVector P0 = Spline->GetLocationAtDistanceAlongSpline(D0, ESplineCoordinateSpace::Local) + ZOffset;
+        const FVector P1 = Spline->GetLocationAtDistanceAlongSpline(D1, ESplineCoordinateSpace::Local) + ZOffset;
+
+        FTransform InstanceTransform;
+        if (UNeonRailBuilderComponent::MakeChordInstanceTransform(*StripMesh, ForwardAxis, P0, P1, CrossScale, FMath::DegreesToRadians(RollDegrees), InstanceTransform))
+        {
+            Transforms.Add(InstanceTransform);
+        }
+    }
+
+    if (Transforms.Num() == 0)
+    {
+        return;
+    }
+
+    UInstancedStaticMeshComponent* Instanced = NewObject<UInstancedStaticMeshComponent>(this);
+    Instanced->CreationMethod = EComponentCreationMethod::UserConstructionScript;
+    Instanced->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+    Instanced->SetMobility(EComponentMobility::Movable);
+    Instanced->ComponentTags.Add(kNeonMeshTag);
+    Instanced->NumCustomDataFloats = 1;
+    Instanced->SetStaticMesh(StripMesh);
+    if (StripMaterial)
+    {
+        Instanced->SetMaterial(0, StripMaterial);
+    }
+    Instanced->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Instanced->SetCastShadow(false);
+    Instanced->RegisterComponent();
+
+    // Single batched add and one render-state update for the whole strip
+    Instanced->AddInstances(Transforms, /*bShouldReturnIndices*/ false, /*bWorldSpace*/ false);
+    for (int32 i = 0; i < Transforms.Num(); ++i)
+    {
+        Instanced->SetCustomDataValue(i, 0, InstanceGlowValue, /*bMarkRenderStateDirty*/ false);
+    }
+    Instanced->MarkRenderStateDirty();
+}
+
 void ANeonStripSplineActor::BuildLights()
 {
     if (!Spline || !bGenerateLights || LightMode == ENeonLightMode::None)
@@ -12,8 +12,18 @@
 #include "GameplayEffect.h"
 #include "Materials/MaterialInterface.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "UObject/ConstructorHelpers.h"
 
+namespace
+{
+    /** Client tick interval while no local view is near the sweep; only long enough to notice one approaching. */
+    constexpr float ClientIdleTickInterval = 0.5f;
+}
+
 ASweepingLightBarrier::ASweepingLightBarrier()
 {
     PrimaryActorTick.bCanEverTick = true;
@@ -53,6 +63,7 @@ ASweepingLightBarrier::ASweepingLightBarrier()
     SweepSpeed = 800.f;
     PauseAtEnds = 1.0f;
     bPingPong = true;
+    ClientUpdateDistance = 6000.f;
 
     bUseRectLight = true;
     LightColor = FLinearColor(0.f, 0.95f, 1.f, 1.f);
@@ -62,6 +73,7 @@ ASweepingLightBarrier::ASweepingLightBarrier()
 
     bDamageContinuous = true;
     DamagePerSecond = 15.f;
+    DamageTickInterval = 0.25f;
     DamageTypeClass = UDamageType::StaticClass();
     DamageEffectClass = UGE_DamagePhysical::StaticClass();
     if (!DamageSetByCallerTag.IsValid())
@@ -71,8 +83,7 @@ ASweepingLightBarrier::ASweepingLightBarrier()
     DamageTypeTag = AeyerjiTags::DamageType_Physical;
 
     Alpha = 0.f;
-    Direction = +1;
-    PauseTimer = 0.f;
+    SweepBounds.Init();
 
     // Simple default mesh/material for visibility
     static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaneMesh(TEXT("StaticMesh'/Engine/BasicShapes/Plane.Plane'"));
@@ -113,6 +124,36 @@ void ASweepingLightBarrier::OnConstruction(const FTransform& Transform)
     UpdateBarrierTransform();
 }
 
+void ASweepingLightBarrier::BeginPlay()
+{
+    Super::BeginPlay();
+
+    SplineLen = Path->GetSplineLength();
+    UpdateSweepBounds();
+
+    if (!HasAuthority())
+    {
+        // Damage is server-side; clients only need the visuals, so the moving box never generates overlaps there.
+        DamageBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    }
+    else if (bDamageContinuous && DamagePerSecond > 0.f)
+    {
+        GetWorldTimerManager().SetTimer(DamageTimerHandle, this, &ASweepingLightBarrier::ApplyContinuousDamage,
+            FMath::Max(0.05f, DamageTickInterval), /*bLoop*/ true);
+    }
+
+    UpdateBarrierTransform();
+}
+
+void ASweepingLightBarrier::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    GetWorldTimerManager().ClearTimer(DamageTimerHandle);
+    Overlapping.Reset();
+    CachedDamageSpec = FGameplayEffectSpecHandle();
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void ASweepingLightBarrier::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
@@ -120,63 +161,78 @@ void ASweepingLightBarrier::Tick(float DeltaSeconds)
     if (SplineLen <= KINDA_SMALL_NUMBER)
     {
         SplineLen = Path->GetSplineLength();
+        UpdateSweepBounds();
         if (SplineLen <= KINDA_SMALL_NUMBER)
         {
             return;
         }
     }
 
-    if (PauseTimer > 0.f)
+    // Pose is derived from shared time, so a client far from the sweep can idle and still be correct when it gets
+    // close. Judged against the whole sweep volume rather than the last pose, which may be stale by now.
+    if (!HasAuthority())
     {
-        PauseTimer -= DeltaSeconds;
-        return;
+        const bool bNearView = IsSweepNearLocalView();
+        SetActorTickInterval(bNearView ? 0.f : ClientIdleTickInterval);
+        if (!bNearView)
+        {
+            return;
+        }
     }
 
-    const float UnitsPerSecond = FMath::Max(1.f, SweepSpeed);
-    const float dAlpha = (UnitsPerSecond / SplineLen) * DeltaSeconds * (float)Direction;
-    Alpha += dAlpha;
+    Alpha = EvaluateAlphaAtTime(GetSharedWorldTime());
+    UpdateBarrierTransform();
+}
 
-    if (Alpha >= 1.f)
+double ASweepingLightBarrier::GetSharedWorldTime() const
+{
+    const UWorld* World = GetWorld();
+    if (!World)
     {
-        Alpha = 1.f;
-        if (bPingPong)
-        {
-            Direction = -1;
-            PauseTimer = PauseAtEnds;
-        }
-        else
-        {
-            Alpha = 0.f; // loop
-        }
+        return 0.0;
     }
-    else if (Alpha <= 0.f)
+
+    if (const AGameStateBase* GameState = World->GetGameState())
     {
-        Alpha = 0.f;
-        if (bPingPong)
-        {
-            Direction = +1;
-            PauseTimer = PauseAtEnds;
-        }
-        else
-        {
-            Alpha = 1.f;
-        }
+        return GameState->GetServerWorldTimeSeconds();
     }
 
-    UpdateBarrierTransform();
+    return World->GetTimeSeconds();
+}
 
-    // Apply continuous damage
-    if (bDamageContinuous && Overlapping.Num() > 0 && DamagePerSecond > 0.f)
+float ASweepingLightBarrier::EvaluateAlphaAtTime(double TimeSeconds) const
+{
+    if (SplineLen <= KINDA_SMALL_NUMBER)
     {
-        const float Damage = DamagePerSecond * DeltaSeconds;
-        for (auto It = Overlapping.CreateIterator(); It; ++It)
-        {
-            if (AActor* Other = It->Get())
-            {
-                ApplyBarrierDamage(Other, Damage);
-            }
-        }
+        return 0.f;
     }
+
+    const double TravelTime = SplineLen / FMath::Max(1.f, SweepSpeed);
+
+    if (!bPingPong)
+    {
+        // Loop: 0 -> 1 then wrap straight back to 0.
+        return static_cast<float>(FMath::Fmod(FMath::Max(0.0, TimeSeconds), TravelTime) / TravelTime);
+    }
+
+    // Ping-pong: forward, pause at 1, backward, pause at 0.
+    const double Pause = FMath::Max(0.f, PauseAtEnds);
+    const double Period = 2.0 * (TravelTime + Pause);
+    const double Phase = FMath::Fmod(FMath::Max(0.0, TimeSeconds), Period);
+
+    if (Phase < TravelTime)
+    {
+        return static_cast<float>(Phase / TravelTime);
+    }
+    if (Phase < TravelTime + Pause)
+    {
+        return 1.f;
+    }
+    if (Phase < 2.0 * TravelTime + Pause)
+    {
+        return static_cast<float>(1.0 - (Phase - TravelTime - Pause) / TravelTime);
+    }
+    return 0.f;
 }
 
 void ASweepingLightBarrier::UpdateBarrierTransform()
@@ -193,6 +249,40 @@ void ASweepingLightBarrier::UpdateBarrierTransform()
     RectLight->SetRelativeRotation(FRotator::ZeroRotator);
 }
 
+void ASweepingLightBarrier::UpdateSweepBounds()
+{
+    SweepBounds = Path->Bounds.GetBox().ExpandBy(FMath::Max(BarrierWidth, BarrierHeight));
+}
+
+bool ASweepingLightBarrier::IsSweepNearLocalView() const
+{
+    const UWorld* World = GetWorld();
+    if (!World || !SweepBounds.IsValid)
+    {
+        return true;
+    }
+
+    const double MaxDistSq = FMath::Square(static_cast<double>(ClientUpdateDistance));
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (!PC || !PC->IsLocalController())
+        {
+            continue;
+        }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        if (SweepBounds.ComputeSquaredDistanceToPoint(ViewLocation) <= MaxDistSq)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void ASweepingLightBarrier::ApplyBarrierDamage(AActor* Other, float Damage)
 {
     if (!IsValid(Other) || Damage <= 0.f)
@@ -200,52 +290,110 @@ void ASweepingLightBarrier::ApplyBarrierDamage(AActor* Other, float Damage)
         return;
     }
 
-    if (DamageEffectClass)
+    if (UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Other))
     {
-        if (UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Other))
+        const FGameplayEffectSpecHandle& SpecHandle = GetOrBuildDamageSpec();
+        if (SpecHandle.IsValid() && SpecHandle.Data.IsValid())
         {
-            FGameplayEffectContextHandle ContextHandle = TargetASC->MakeEffectContext();
-            ContextHandle.AddSourceObject(this);
-
-            FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(DamageEffectClass, 1.f, ContextHandle);
-            if (SpecHandle.IsValid() && SpecHandle.Data.IsValid())
+            // The target copies the spec on application, so the shared template only needs this hit's magnitude.
+            if (ResolvedDamageTag.IsValid())
             {
-                const FGameplayTag DamageTag = DamageSetByCallerTag.IsValid()
-                    ? DamageSetByCallerTag
-                    : FGameplayTag::RequestGameplayTag(TEXT("SetByCaller.Damage.Instant"), /*ErrorIfNotFound=*/false);
-                if (DamageTag.IsValid())
-                {
-                    SpecHandle.Data->SetSetByCallerMagnitude(DamageTag, Damage);
-                }
-                if (DamageTypeTag.IsValid())
-                {
-                    SpecHandle.Data->AddDynamicAssetTag(DamageTypeTag);
-                }
-
-                TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-                return;
+                SpecHandle.Data->SetSetByCallerMagnitude(ResolvedDamageTag, Damage);
             }
+
+            TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+            return;
         }
     }
 
     UGameplayStatics::ApplyDamage(Other, Damage, GetInstigatorController(), this, DamageTypeClass);
 }
 
+const FGameplayEffectSpecHandle& ASweepingLightBarrier::GetOrBuildDamageSpec()
+{
+    if (CachedDamageSpec.IsValid() || !DamageEffectClass)
+    {
+        return CachedDamageSpec;
+    }
+
+    ResolvedDamageTag = DamageSetByCallerTag.IsValid()
+        ? DamageSetByCallerTag
+        : FGameplayTag::RequestGameplayTag(TEXT("SetByCaller.Damage.Instant"), /*ErrorIfNotFound=*/false);
+
+    // Environmental hazard: no source ASC, the barrier itself is the source object.
+    FGameplayEffectContextHandle ContextHandle(UAbilitySystemGlobals::Get().AllocGameplayEffectContext());
+    ContextHandle.AddSourceObject(this);
+
+    CachedDamageSpec = FGameplayEffectSpecHandle(new FGameplayEffectSpec(DamageEffectClass->GetDefaultObject<UGameplayEffect>(), ContextHandle, 1.f));
+    if (DamageTypeTag.IsValid())
+    {
+        CachedDamageSpec.Data->AddDynamicAssetTag(DamageTypeTag);
+    }
+
+    return CachedDamageSpec;
+}
+
+void ASweepingLightBarrier::SettleExposure(AActor* Other, double& ExposureStart, double Now)
+{
+    const float Damage = DamagePerSecond * static_cast<float>(Now - ExposureStart);
+    ExposureStart = Now;
+    ApplyBarrierDamage(Other, Damage);
+}
+
+void ASweepingLightBarrier::ApplyContinuousDamage()
+{
+    if (Overlapping.Num() == 0 || DamagePerSecond <= 0.f)
+    {
+        return;
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    for (auto It = Overlapping.CreateIterator(); It; ++It)
+    {
+        AActor* Other = It.Key().Get();
+        if (!IsValid(Other))
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        SettleExposure(Other, It.Value(), Now);
+    }
+}
+
 void ASweepingLightBarrier::OnDamageOverlapBegin(UPrimitiveComponent* Overlapped, AActor* Other, UPrimitiveComponent* OtherComp, int32 BodyIndex, bool bFromSweep, const FHitResult& Hit)
 {
-    if (!IsValid(Other) || Other == this)
+    if (!IsValid(Other) || Other == this || !HasAuthority())
     {
         return;
     }
-    Overlapping.Add(Other);
 
-    if (!bDamageContinuous && DamagePerSecond > 0.f)
+    if (!bDamageContinuous)
+    {
+        if (DamagePerSecond > 0.f)
+        {
+            ApplyBarrierDamage(Other, DamagePerSecond);
+        }
+        return;
+    }
+
+    if (!Overlapping.Contains(Other))
     {
-        ApplyBarrierDamage(Other, DamagePerSecond);
+        Overlapping.Add(Other, GetWorld()->GetTimeSeconds());
     }
 }
 
 void ASweepingLightBarrier::OnDamageOverlapEnd(UPrimitiveComponent* Overlapped, AActor* Other, UPrimitiveComponent* OtherComp, int32 BodyIndex)
 {
-    Overlapping.Remove(Other);
+    double ExposureStart = 0.0;
+    if (!Overlapping.RemoveAndCopyValue(Other, ExposureStart))
+    {
+        return;
+    }
+
+    // Pay out the partial interval so total damage tracks time spent inside, not how the interval lined up.
+    if (IsValid(Other) && DamagePerSecond > 0.f)
+    {
+        SettleExposure(Other, ExposureStart, GetWorld()->GetTimeSeconds());
+    }
 }
@@ -0,0 +1,35 @@
+// AeyerjiAbilitySystemComponent.cpp
+
+#include "GAS/AeyerjiAbilitySystemComponent.h"
+
+#include "Components/AeyerjiAbilityIndexComponent.h"
+
+void UAeyerjiAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+	InvalidateAbilityIndex();
+}
+
+void UAeyerjiAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnRemoveAbility(AbilitySpec);
+
+	// Still in the list here; the index rebuilds lazily on its next query, after the removal.
+	InvalidateAbilityIndex();
+}
+
+void UAeyerjiAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	// Covers replicated dynamic tag changes, which raise no give/remove callback on clients.
+	InvalidateAbilityIndex();
+}
+
+void UAeyerjiAbilitySystemComponent::InvalidateAbilityIndex()
+{
+	if (UAeyerjiAbilityIndexComponent* Index = UAeyerjiAbilityIndexComponent::Get(this))
+	{
+		Index->Invalidate();
+	}
+}
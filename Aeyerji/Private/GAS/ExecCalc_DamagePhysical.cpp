@@ -10,6 +10,9 @@
 #include "GameplayEffectExtension.h"
 #include "GameplayTagContainer.h"
 #include "Logging/LogMacros.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
 
 namespace
 {
@@ -38,6 +41,75 @@ UExecCalc_DamagePhysical::UExecCalc_DamagePhysical()
 	RelevantAttributesToCapture.Add(DamageStatics().ArmorDef);
 }
 
+const UExecCalc_DamagePhysical::FArmorCurve* UExecCalc_DamagePhysical::ActiveBatchCurve = nullptr;
+
+UExecCalc_DamagePhysical::FScopedArmorTuningBatch::FScopedArmorTuningBatch()
+	: Previous(ActiveBatchCurve)
+{
+	check(IsInGameThread());
+	ActiveBatchCurve = &GetArmorCurve();
+}
+
+UExecCalc_DamagePhysical::FScopedArmorTuningBatch::~FScopedArmorTuningBatch()
+{
+	ActiveBatchCurve = Previous;
+}
+
+const UExecCalc_DamagePhysical::FArmorCurve& UExecCalc_DamagePhysical::GetArmorCurve()
+{
+	// Executions run on the game thread; the settings read only happens when the revision moves.
+	static FArmorCurve Curve;
+
+	const uint32 Revision = UAeyerjiStatSettings::GetTuningRevision();
+	if (Curve.Revision != Revision)
+	{
+		const UAeyerjiStatSettings* Settings = GetDefault<UAeyerjiStatSettings>();
+		const bool bWithTable = Settings && Settings->bUseArmorDRLookupTable;
+		const int32 Resolution = Settings ? Settings->ArmorDRTableResolution : 0;
+
+		BuildArmorCurve(Curve, ResolveArmorTuning(), bWithTable, Resolution);
+		Curve.Revision = Revision;
+	}
+	return Curve;
+}
+
+void UExecCalc_DamagePhysical::BuildArmorCurve(FArmorCurve& OutCurve, const FArmorTuning& Tuning, bool bWithTable, int32 TableResolution)
+{
+	OutCurve.Tuning = Tuning;
+	OutCurve.DRTable.Reset();
+	OutCurve.SamplesPerArmor = 0.f;
+
+	const float SoftCap = OutCurve.Tuning.ArmorSoftCap;
+	if (!bWithTable || SoftCap <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	// The table stops at the soft cap so interpolation never straddles the hyperbola/tail seam.
+	const int32 NumSamples = FMath::Clamp(TableResolution, 16, 65536);
+	OutCurve.SamplesPerArmor = static_cast<float>(NumSamples - 1) / SoftCap;
+	OutCurve.DRTable.SetNumUninitialized(NumSamples);
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		const float Armor = (i == NumSamples - 1) ? SoftCap : static_cast<float>(i) / OutCurve.SamplesPerArmor;
+		OutCurve.DRTable[i] = ComputeArmorDR(Armor, OutCurve.Tuning);
+	}
+}
+
+float UExecCalc_DamagePhysical::FArmorCurve::Evaluate(float Armor) const
+{
+	const float ClampedArmor = FMath::Max(0.f, Armor);
+	if (DRTable.Num() < 2 || ClampedArmor > Tuning.ArmorSoftCap)
+	{
+		return ComputeArmorDR(ClampedArmor, Tuning);
+	}
+
+	const float Position = ClampedArmor * SamplesPerArmor;
+	const int32 Index = FMath::Min(static_cast<int32>(Position), DRTable.Num() - 2);
+	const float Alpha = Position - static_cast<float>(Index);
+	return FMath::Lerp(DRTable[Index], DRTable[Index + 1], Alpha);
+}
+
 UExecCalc_DamagePhysical::FArmorTuning UExecCalc_DamagePhysical::ResolveArmorTuning()
 {
 	FArmorTuning Result;
@@ -102,8 +174,8 @@ void UExecCalc_DamagePhysical::Execute_Implementation(const FGameplayEffectCusto
 			? Spec.GetSetByCallerMagnitude(ArmorPenTag, /*WarnIfNotFound=*/false, 0.f)
 			: 0.f;
 
-		const FArmorTuning ArmorTuning = ResolveArmorTuning();
-		const float DamageReduction = ComputeArmorDR(ArmorValue, ArmorTuning);
+		const FArmorCurve& ArmorCurve = ActiveBatchCurve ? *ActiveBatchCurve : GetArmorCurve();
+		const float DamageReduction = ArmorCurve.Evaluate(ArmorValue);
 		const float EffectiveDR = DamageReduction * (1.f - FMath::Clamp(ArmorPenetration, 0.f, 1.f));
 		FinalDamage = BaseDamage * (1.f - EffectiveDR);
 
@@ -128,3 +200,160 @@ float UExecCalc_DamagePhysical::ComputeArmorDR(float Armor, const FArmorTuning&
 	const float TailDR = 0.5f + (ClampedArmor - Tuning.ArmorSoftCap) * Tuning.ArmorTailSlope;
 	return FMath::Clamp(FMath::Min(TailDR, Tuning.ArmorTailCap), 0.f, 1.f);
 }
+
+void UExecCalc_DamagePhysical::RunArmorDRBenchmark(const TArray<FString>& Args)
+{
+	const int32 NumEvals = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+	const int32 Resolution = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : GetDefault<UAeyerjiStatSettings>()->ArmorDRTableResolution;
+
+	const FArmorDRBenchResult Result = BenchmarkArmorDR(ResolveArmorTuning(), NumEvals, Resolution);
+
+	UE_LOG(LogDamagePhysicalCalc, Display,
+		TEXT("ArmorDR bench: %d evals | analytic %.3f ms (%.2f ns/eval) | table[%d] %.3f ms (%.2f ns/eval) | max abs error %.6f | checksum %.3f / %.3f"),
+		Result.NumEvals,
+		Result.AnalyticSeconds * 1000.0, Result.AnalyticSeconds * 1e9 / Result.NumEvals,
+		Result.TableResolution,
+		Result.TableSeconds * 1000.0, Result.TableSeconds * 1e9 / Result.NumEvals,
+		Result.MaxError,
+		Result.AnalyticSum, Result.TableSum);
+}
+
+UExecCalc_DamagePhysical::FArmorDRBenchResult UExecCalc_DamagePhysical::BenchmarkArmorDR(const FArmorTuning& Tuning, int32 NumEvals, int32 Resolution)
+{
+	FArmorCurve AnalyticCurve;
+	BuildArmorCurve(AnalyticCurve, Tuning, /*bWithTable=*/false, 0);
+
+	FArmorCurve TableCurve;
+	BuildArmorCurve(TableCurve, Tuning, /*bWithTable=*/true, Resolution);
+
+	// Same armor sequence for both paths, kept inside the table's range: past the soft cap both paths are analytic,
+	// so tail samples would only dilute the comparison.
+	const float MaxArmor = FMath::Max(1.f, Tuning.ArmorSoftCap);
+	TArray<float> Inputs;
+	Inputs.SetNumUninitialized(4096);
+	FRandomStream Stream(1337);
+	for (float& Value : Inputs)
+	{
+		Value = Stream.FRandRange(0.f, MaxArmor);
+	}
+
+	auto TimeCurve = [&Inputs, NumEvals](const FArmorCurve& Curve, double& OutSum)
+	{
+		OutSum = 0.0;
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumEvals; ++i)
+		{
+			OutSum += Curve.Evaluate(Inputs[i & (Inputs.Num() - 1)]);
+		}
+		return FPlatformTime::Seconds() - Start;
+	};
+
+	FArmorDRBenchResult Result;
+	Result.NumEvals = NumEvals;
+	Result.TableResolution = TableCurve.DRTable.Num();
+	Result.AnalyticSeconds = TimeCurve(AnalyticCurve, Result.AnalyticSum);
+	Result.TableSeconds = TimeCurve(TableCurve, Result.TableSum);
+
+	for (const float Armor : Inputs)
+	{
+		Result.MaxError = FMath::Max(Result.MaxError, FMath::Abs(AnalyticCurve.Evaluate(Armor) - TableCurve.Evaluate(Armor)));
+	}
+	return Result;
+}
+
+namespace
+{
+	FAutoConsoleCommand GArmorDRBenchCommand(
+		TEXT("aeyerji.Damage.BenchArmorDR"),
+		TEXT("Compares analytic and lookup-table armor DR evaluation. Args: [NumEvals=1000000] [TableResolution=settings]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&UExecCalc_DamagePhysical::RunArmorDRBenchmark));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeyerjiArmorDRCurveTest, "Aeyerji.Damage.ArmorDRCurve",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAeyerjiArmorDRCurveTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 TableResolution = 1024;
+	constexpr float Tolerance = 5e-4f;
+	constexpr int32 NumSamples = 10000;
+
+	using FArmorTuning = UExecCalc_DamagePhysical::FArmorTuning;
+	using FArmorCurve = UExecCalc_DamagePhysical::FArmorCurve;
+
+	FArmorTuning SteepTuning;
+	SteepTuning.ArmorK = 100.f;
+	SteepTuning.ArmorSoftCap = 2000.f;
+
+	const FArmorTuning Cases[] = { FArmorTuning(), SteepTuning, UExecCalc_DamagePhysical::ResolveArmorTuning() };
+	for (const FArmorTuning& Tuning : Cases)
+	{
+		const float SoftCap = Tuning.ArmorSoftCap;
+		if (SoftCap <= KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		FArmorCurve Curve;
+		UExecCalc_DamagePhysical::BuildArmorCurve(Curve, Tuning, /*bWithTable=*/true, TableResolution);
+		if (!TestEqual(TEXT("Table resolution"), Curve.DRTable.Num(), TableResolution))
+		{
+			continue;
+		}
+
+		auto Exact = [&Tuning](float Armor) { return UExecCalc_DamagePhysical::ComputeArmorDR(Armor, Tuning); };
+
+		// Dense sweep of the interpolated range.
+		float MaxError = 0.f;
+		float WorstArmor = 0.f;
+		for (int32 i = 0; i <= NumSamples; ++i)
+		{
+			const float Armor = SoftCap * static_cast<float>(i) / NumSamples;
+			const float Error = FMath::Abs(Curve.Evaluate(Armor) - Exact(Armor));
+			if (Error > MaxError)
+			{
+				MaxError = Error;
+				WorstArmor = Armor;
+			}
+		}
+		TestTrue(FString::Printf(TEXT("K=%.0f SoftCap=%.0f: max error %.6f at armor %.1f within %.6f"),
+			Tuning.ArmorK, SoftCap, MaxError, WorstArmor, Tolerance), MaxError <= Tolerance);
+
+		// Clamp edges: negative armor, both ends of the table, just past the seam and far into the tail.
+		TestEqual(TEXT("Negative armor clamps to zero DR"), Curve.Evaluate(-50.f), Exact(0.f), KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Zero armor"), Curve.Evaluate(0.f), Exact(0.f), KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Soft cap"), Curve.Evaluate(SoftCap), Exact(SoftCap), 1e-5f);
+		TestEqual(TEXT("Just past the soft cap"), Curve.Evaluate(SoftCap + 1.f), Exact(SoftCap + 1.f), KINDA_SMALL_NUMBER);
+		TestEqual(TEXT("Far tail"), Curve.Evaluate(SoftCap * 1000.f), Exact(SoftCap * 1000.f), KINDA_SMALL_NUMBER);
+		TestTrue(TEXT("Far tail stays under the tail cap"), Curve.Evaluate(SoftCap * 1000.f) <= Tuning.ArmorTailCap + KINDA_SMALL_NUMBER);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeyerjiArmorDRBenchTest, "Aeyerji.Damage.ArmorDRBench",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAeyerjiArmorDRBenchTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumEvals = 1000000;
+
+	const UExecCalc_DamagePhysical::FArmorDRBenchResult Result = UExecCalc_DamagePhysical::BenchmarkArmorDR(
+		UExecCalc_DamagePhysical::ResolveArmorTuning(), NumEvals, GetDefault<UAeyerjiStatSettings>()->ArmorDRTableResolution);
+
+	const double AnalyticNs = Result.AnalyticSeconds * 1e9 / NumEvals;
+	const double TableNs = Result.TableSeconds * 1e9 / NumEvals;
+
+	// Timings are reported, not asserted: they depend on the agent's load.
+	AddInfo(FString::Printf(TEXT("%d evals | analytic %.2f ns/eval | table[%d] %.2f ns/eval | max abs error %.6f | checksum %.3f / %.3f"),
+		NumEvals, AnalyticNs, Result.TableResolution, TableNs, Result.MaxError, Result.AnalyticSum, Result.TableSum));
+	AddTelemetryData(TEXT("ArmorDR.AnalyticNsPerEval"), AnalyticNs);
+	AddTelemetryData(TEXT("ArmorDR.TableNsPerEval"), TableNs);
+	AddTelemetryData(TEXT("ArmorDR.TableMaxAbsError"), Result.MaxError);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
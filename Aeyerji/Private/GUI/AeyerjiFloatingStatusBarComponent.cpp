@@ -15,7 +15,8 @@
 
 UAeyerjiFloatingStatusBarComponent::UAeyerjiFloatingStatusBarComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
+    // World-mode billboarding is driven by UAeyerjiStatusBarOverlayComponent, not per component
+    PrimaryComponentTick.bCanEverTick = false;
 
     // Defaults that designers can override in BP
     HealthAttr    = UAeyerjiAttributeSet::GetHPAttribute();
@@ -45,8 +46,11 @@ void UAeyerjiFloatingStatusBarComponent::BeginPlay()
     case EStatusBarMode::Overlay: RegisterWithOverlay();           break;
     }
 
-    // Only tick to billboard in legacy World mode
-    SetComponentTickEnabled(Mode == EStatusBarMode::World && bFaceCamera);
+    // Legacy World mode billboards through the overlay manager's single tick
+    if (Mode == EStatusBarMode::World && bFaceCamera && WidgetComp)
+    {
+        RegisterWithOverlay();
+    }
 }
 
 void UAeyerjiFloatingStatusBarComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -66,32 +70,9 @@ void UAeyerjiFloatingStatusBarComponent::EndPlay(const EEndPlayReason::Type EndP
     // Overlay cleanup
     CleanupOverlay();
 
-    if (RetryTimer.IsValid())
-    {
-        GetWorld()->GetTimerManager().ClearTimer(RetryTimer);
-    }
-
     Super::EndPlay(EndPlayReason);
 }
 
-void UAeyerjiFloatingStatusBarComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTick)
-{
-    Super::TickComponent(DeltaTime, TickType, ThisTick);
-
-    // Simple billboard for legacy world-widget mode
-    if (Mode == EStatusBarMode::World && WidgetComp && bFaceCamera)
-    {
-        if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
-        {
-            FVector CamLoc; FRotator CamRot;
-            PC->GetPlayerViewPoint(CamLoc, CamRot);
-            FRotator LookAt = (CamLoc - WidgetComp->GetComponentLocation()).Rotation();
-            if (bYawOnly) { LookAt.Pitch = 0.f; LookAt.Roll = 0.f; } else { LookAt.Roll = 0.f; }
-            WidgetComp->SetWorldRotation(LookAt);
-        }
-    }
-}
-
 UAbilitySystemComponent* UAeyerjiFloatingStatusBarComponent::FindASC() const
 {
     if (const IAbilitySystemInterface* ASI = Cast<IAbilitySystemInterface>(GetOwner()))
@@ -206,31 +187,19 @@ void UAeyerjiFloatingStatusBarComponent::CreateHUDWidget()
 void UAeyerjiFloatingStatusBarComponent::RegisterWithOverlay()
 {
     if (GetWorld()->IsNetMode(NM_DedicatedServer)) return;
-    if (!StatusBarWidgetClass) { LogMissingWidget(); /* allow manager's DefaultWidgetClass if set */ }
+    if (Mode == EStatusBarMode::Overlay && !StatusBarWidgetClass) { LogMissingWidget(); /* allow manager's DefaultWidgetClass if set */ }
 
+    // Find/create local overlay manager on the PC
     APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-    if (!PC)
+    OverlayMgr = UAeyerjiStatusBarOverlayComponent::FindOrCreateFor(PC);
+    if (!OverlayMgr)
     {
-        // PlayerController not ready yet (PIE network client timing) - retry next tick.
-        if (!RetryTimer.IsValid())
-        {
-            GetWorld()->GetTimerManager().SetTimer(
-                RetryTimer, this, &UAeyerjiFloatingStatusBarComponent::RegisterWithOverlay, 0.02f, false);
-        }
+        // PlayerController not ready yet (PIE network client timing) - the overlay adopts us on BeginPlay.
+        UAeyerjiStatusBarOverlayComponent::DeferUntilOverlayReady(this);
         return;
     }
 
-    // Find/create local overlay manager on the PC
-    OverlayMgr = PC->FindComponentByClass<UAeyerjiStatusBarOverlayComponent>();
-    if (!OverlayMgr)
-    {
-        OverlayMgr = NewObject<UAeyerjiStatusBarOverlayComponent>(PC, UAeyerjiStatusBarOverlayComponent::StaticClass(), TEXT("StatusBarOverlay"));
-        OverlayMgr->RegisterComponent();
-    }
-    if (OverlayMgr)
-    {
-        OverlayMgr->RegisterSource(this);
-    }
+    OverlayMgr->EnqueueSource(this);
 }
 
 void UAeyerjiFloatingStatusBarComponent::CleanupOverlay()
@@ -240,6 +209,10 @@ void UAeyerjiFloatingStatusBarComponent::CleanupOverlay()
         OverlayMgr->UnregisterSource(this);
         OverlayMgr = nullptr;
     }
+    else
+    {
+        UAeyerjiStatusBarOverlayComponent::CancelDeferred(this);
+    }
 }
 
 void UAeyerjiFloatingStatusBarComponent::LogMissingWidget() const
@@ -7,6 +7,14 @@
 #include "Kismet/GameplayStatics.h"
 #include "Blueprint/WidgetLayoutLibrary.h"
 #include "GUI/AeyerjiFloatingStatusBarComponent.h"
+#include "Components/WidgetComponent.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+    /** Sources that asked for an overlay before their world's local PlayerController existed. */
+    TMap<TObjectKey<UWorld>, TArray<TWeakObjectPtr<UAeyerjiFloatingStatusBarComponent>>> GDeferredSources;
+}
 
 UAeyerjiStatusBarOverlayComponent::UAeyerjiStatusBarOverlayComponent()
 {
@@ -16,6 +24,21 @@ UAeyerjiStatusBarOverlayComponent::UAeyerjiStatusBarOverlayComponent()
 void UAeyerjiStatusBarOverlayComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (GetPC() && *DefaultWidgetClass)
+    {
+        PrewarmClasses.AddUnique(DefaultWidgetClass);
+        const int32 DefaultZOrder = BaseZOrder;
+        for (int32 i = CountPooled(DefaultWidgetClass); i < PrewarmWidgetCount; ++i)
+        {
+            if (!CreatePooledWidget(DefaultWidgetClass, DefaultZOrder))
+            {
+                break;
+            }
+        }
+    }
+
+    AdoptDeferredSources();
 }
 
 void UAeyerjiStatusBarOverlayComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -26,11 +49,240 @@ void UAeyerjiStatusBarOverlayComponent::EndPlay(const EEndPlayReason::Type EndPl
         {
             W->RemoveFromParent();
         }
+        if (UAeyerjiFloatingStatusBarComponent* Source = T.Source.Get())
+        {
+            Source->SetOverlayManager(nullptr);
+        }
     }
     Tracked.Empty();
+
+    for (FPooledWidget& P : WidgetPool)
+    {
+        if (UW_AeyerjiStatusBar* W = P.Widget.Get())
+        {
+            W->RemoveFromParent();
+        }
+    }
+    WidgetPool.Empty();
+    PooledWidgetRefs.Empty();
+
+    for (const TWeakObjectPtr<UAeyerjiFloatingStatusBarComponent>& Pending : PendingSources)
+    {
+        if (UAeyerjiFloatingStatusBarComponent* Source = Pending.Get())
+        {
+            Source->SetOverlayManager(nullptr);
+        }
+    }
+    PendingSources.Empty();
+    Billboards.Empty();
+
     Super::EndPlay(EndPlayReason);
 }
 
+UAeyerjiStatusBarOverlayComponent* UAeyerjiStatusBarOverlayComponent::FindOrCreateFor(APlayerController* PC)
+{
+    if (!PC || !PC->IsLocalController()) return nullptr;
+
+    UAeyerjiStatusBarOverlayComponent* Overlay = PC->FindComponentByClass<UAeyerjiStatusBarOverlayComponent>();
+    if (!Overlay)
+    {
+        Overlay = NewObject<UAeyerjiStatusBarOverlayComponent>(PC, UAeyerjiStatusBarOverlayComponent::StaticClass(), TEXT("StatusBarOverlay"));
+        Overlay->RegisterComponent();
+    }
+    return Overlay;
+}
+
+void UAeyerjiStatusBarOverlayComponent::DeferUntilOverlayReady(UAeyerjiFloatingStatusBarComponent* Source)
+{
+    UWorld* World = Source ? Source->GetWorld() : nullptr;
+    if (!World) return;
+
+    // Drop queues of worlds that were torn down before an overlay showed up
+    for (auto It = GDeferredSources.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().ResolveObjectPtr())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    GDeferredSources.FindOrAdd(World).AddUnique(Source);
+}
+
+void UAeyerjiStatusBarOverlayComponent::CancelDeferred(UAeyerjiFloatingStatusBarComponent* Source)
+{
+    UWorld* World = Source ? Source->GetWorld() : nullptr;
+    if (!World) return;
+
+    if (TArray<TWeakObjectPtr<UAeyerjiFloatingStatusBarComponent>>* Queue = GDeferredSources.Find(World))
+    {
+        Queue->Remove(Source);
+        if (Queue->Num() == 0)
+        {
+            GDeferredSources.Remove(World);
+        }
+    }
+}
+
+void UAeyerjiStatusBarOverlayComponent::AdoptDeferredSources()
+{
+    if (!GetPC()) return;
+
+    TArray<TWeakObjectPtr<UAeyerjiFloatingStatusBarComponent>> Deferred;
+    if (!GDeferredSources.RemoveAndCopyValue(GetWorld(), Deferred)) return;
+
+    for (const TWeakObjectPtr<UAeyerjiFloatingStatusBarComponent>& Weak : Deferred)
+    {
+        if (UAeyerjiFloatingStatusBarComponent* Source = Weak.Get())
+        {
+            Source->SetOverlayManager(this);
+            EnqueueSource(Source);
+        }
+    }
+}
+
+void UAeyerjiStatusBarOverlayComponent::EnqueueSource(UAeyerjiFloatingStatusBarComponent* Source)
+{
+    if (!Source) return;
+
+    PendingSources.AddUnique(Source);
+
+    const TSubclassOf<UW_AeyerjiStatusBar> WidgetClass = Source->GetStatusBarWidgetClass();
+    if (Source->GetMode() == EStatusBarMode::Overlay && *WidgetClass)
+    {
+        PrewarmClasses.AddUnique(WidgetClass);
+    }
+}
+
+UW_AeyerjiStatusBar* UAeyerjiStatusBarOverlayComponent::CreatePooledWidget(TSubclassOf<UW_AeyerjiStatusBar> WidgetClass, int32 ZOrder)
+{
+    APlayerController* PC = GetPC();
+    if (!PC || !*WidgetClass) return nullptr;
+
+    UW_AeyerjiStatusBar* W = CreateWidget<UW_AeyerjiStatusBar>(PC, WidgetClass);
+    if (!W) return nullptr;
+
+    W->AddToViewport(ZOrder);
+    W->SetAlignmentInViewport(FVector2D(0.5f, 0.0f));
+    W->SetVisibility(ESlateVisibility::Collapsed);
+
+    FPooledWidget& P = WidgetPool.AddDefaulted_GetRef();
+    P.Widget = W;
+    P.ZOrder = ZOrder;
+    PooledWidgetRefs.Add(W);
+    return W;
+}
+
+int32 UAeyerjiStatusBarOverlayComponent::CountPooled(TSubclassOf<UW_AeyerjiStatusBar> WidgetClass) const
+{
+    int32 Count = 0;
+    for (const FPooledWidget& P : WidgetPool)
+    {
+        const UW_AeyerjiStatusBar* W = P.Widget.Get();
+        if (W && W->GetClass() == WidgetClass.Get())
+        {
+            ++Count;
+        }
+    }
+    return Count;
+}
+
+UW_AeyerjiStatusBar* UAeyerjiStatusBarOverlayComponent::AcquireWidget(TSubclassOf<UW_AeyerjiStatusBar> WidgetClass, int32 ZOrder)
+{
+    // Prefer an idle widget already at the right ZOrder, otherwise any idle widget of the class
+    int32 BestIdx = INDEX_NONE;
+    for (int32 i = WidgetPool.Num() - 1; i >= 0; --i)
+    {
+        const UW_AeyerjiStatusBar* W = WidgetPool[i].Widget.Get();
+        if (!W)
+        {
+            WidgetPool.RemoveAtSwap(i);
+            continue;
+        }
+        if (W->GetClass() != WidgetClass.Get()) continue;
+
+        BestIdx = i;
+        if (WidgetPool[i].ZOrder == ZOrder) break;
+    }
+
+    if (BestIdx == INDEX_NONE)
+    {
+        if (!CreatePooledWidget(WidgetClass, ZOrder)) return nullptr;
+        BestIdx = WidgetPool.Num() - 1;
+    }
+
+    const FPooledWidget P = WidgetPool[BestIdx];
+    WidgetPool.RemoveAtSwap(BestIdx);
+
+    UW_AeyerjiStatusBar* W = P.Widget.Get();
+    PooledWidgetRefs.RemoveSingleSwap(W);
+
+    if (P.ZOrder != ZOrder || !W->IsInViewport())
+    {
+        W->RemoveFromParent();
+        W->AddToViewport(ZOrder);
+        W->SetAlignmentInViewport(FVector2D(0.5f, 0.0f));
+    }
+    return W;
+}
+
+void UAeyerjiStatusBarOverlayComponent::ReleaseWidget(UW_AeyerjiStatusBar* Widget, int32 ZOrder)
+{
+    if (!Widget) return;
+
+    Widget->UnbindFromAttributes();
+
+    if (WidgetPool.Num() >= MaxPooledWidgets || !GetPC())
+    {
+        Widget->RemoveFromParent();
+        return;
+    }
+
+    Widget->SetVisibility(ESlateVisibility::Collapsed);
+
+    FPooledWidget& P = WidgetPool.AddDefaulted_GetRef();
+    P.Widget = Widget;
+    P.ZOrder = ZOrder;
+    PooledWidgetRefs.Add(Widget);
+}
+
+void UAeyerjiStatusBarOverlayComponent::TopUpPool()
+{
+    // One widget per idle tick keeps construction cost off the frames that actually spawn enemies
+    for (const TSubclassOf<UW_AeyerjiStatusBar>& WidgetClass : PrewarmClasses)
+    {
+        if (WidgetPool.Num() >= MaxPooledWidgets) return;
+        if (CountPooled(WidgetClass) < PrewarmWidgetCount)
+        {
+            CreatePooledWidget(WidgetClass, BaseZOrder);
+            return;
+        }
+    }
+}
+
+void UAeyerjiStatusBarOverlayComponent::DrainPendingSources()
+{
+    const int32 Budget = MaxRegistrationsPerTick > 0 ? MaxRegistrationsPerTick : MAX_int32;
+
+    // Pull this tick's batch out first: RegisterSource edits PendingSources through UnregisterSource
+    TArray<UAeyerjiFloatingStatusBarComponent*, TInlineAllocator<8>> Batch;
+    int32 Consumed = 0;
+    for (; Consumed < PendingSources.Num() && Batch.Num() < Budget; ++Consumed)
+    {
+        UAeyerjiFloatingStatusBarComponent* Source = PendingSources[Consumed].Get();
+        if (Source && IsValid(Source->GetOwner()))
+        {
+            Batch.Add(Source);
+        }
+    }
+    PendingSources.RemoveAt(0, Consumed, EAllowShrinking::No);
+
+    for (UAeyerjiFloatingStatusBarComponent* Source : Batch)
+    {
+        RegisterSource(Source);
+    }
+}
+
 UW_AeyerjiStatusBar* UAeyerjiStatusBarOverlayComponent::RegisterSource(UAeyerjiFloatingStatusBarComponent* Source)
 {
     APlayerController* PC = GetPC();
@@ -39,17 +291,30 @@ UW_AeyerjiStatusBar* UAeyerjiStatusBarOverlayComponent::RegisterSource(UAeyerjiF
     AActor* Target = Source->GetOwner();
     if (!IsValid(Target)) return nullptr;
 
+    // Never hold a source twice (re-registration after a deferred adopt, BP re-init, ...)
+    UnregisterSource(Source);
+
+    if (Source->GetMode() == EStatusBarMode::World)
+    {
+        if (UWidgetComponent* WidgetComp = Source->GetWorldWidgetComponent())
+        {
+            FBillboard& B = Billboards.AddDefaulted_GetRef();
+            B.Source = Source;
+            B.WidgetComp = WidgetComp;
+            B.bYawOnly = Source->IsYawOnly();
+        }
+        return nullptr;
+    }
+
     TSubclassOf<UW_AeyerjiStatusBar> WidgetClass = Source->GetStatusBarWidgetClass();
     if (!*WidgetClass) WidgetClass = DefaultWidgetClass;
     if (!*WidgetClass) return nullptr;
 
-    // Build widget for this client
-    UW_AeyerjiStatusBar* W = CreateWidget<UW_AeyerjiStatusBar>(PC, WidgetClass);
+    // Reuse a pre-built widget for this client (falls back to creating one)
+    const int32 ZOrder = BaseZOrder + Source->GetOverlayZOrder();
+    UW_AeyerjiStatusBar* W = AcquireWidget(WidgetClass, ZOrder);
     if (!W) return nullptr;
 
-    // Add to viewport and align bottom-center
-    W->AddToViewport(BaseZOrder + Source->GetOverlayZOrder());
-    W->SetAlignmentInViewport(FVector2D(0.5f, 0.0f));
     W->SetVisibility(ESlateVisibility::Visible);
 
     // Bind attributes
@@ -111,7 +376,7 @@ else
     T.Widget = W;
     T.WorldOffset = Source->GetWorldOffset();
     T.ScreenPixelOffset = Source->GetOverlayPixelOffset();
-    T.ZOrder = BaseZOrder + Source->GetOverlayZOrder();
+    T.ZOrder = ZOrder;
     Tracked.Add(T);
 
     return W;
@@ -119,14 +384,21 @@ else
 
 void UAeyerjiStatusBarOverlayComponent::UnregisterSource(UAeyerjiFloatingStatusBarComponent* Source)
 {
+    PendingSources.Remove(Source);
+
+    for (int32 i = Billboards.Num() - 1; i >= 0; --i)
+    {
+        if (Billboards[i].Source.Get() == Source)
+        {
+            Billboards.RemoveAtSwap(i);
+        }
+    }
+
     for (int32 i = Tracked.Num() - 1; i >= 0; --i)
     {
         if (Tracked[i].Source.Get() == Source)
         {
-            if (UW_AeyerjiStatusBar* W = Tracked[i].Widget.Get())
-            {
-                W->RemoveFromParent();
-            }
+            ReleaseWidget(Tracked[i].Widget.Get(), Tracked[i].ZOrder);
             Tracked.RemoveAtSwap(i);
         }
     }
@@ -197,14 +469,56 @@ void UAeyerjiStatusBarOverlayComponent::TickComponent(
     APlayerController* PC = GetPC();
     if (!PC) return;
 
+    if (PendingSources.Num() > 0)
+    {
+        DrainPendingSources();
+    }
+    else
+    {
+        TopUpPool();
+    }
+
+    TickBillboards();
+    TickOverlayWidgets(PC);
+}
+
+void UAeyerjiStatusBarOverlayComponent::TickBillboards()
+{
+    if (Billboards.Num() == 0) return;
+
+    const APlayerController* PC = GetPC();
+    if (!PC) return;
+
+    FVector CamLoc; FRotator CamRot;
+    PC->GetPlayerViewPoint(CamLoc, CamRot);
+
+    for (int32 i = Billboards.Num() - 1; i >= 0; --i)
+    {
+        const FBillboard& B = Billboards[i];
+        UWidgetComponent* WidgetComp = B.WidgetComp.Get();
+        if (!WidgetComp || !B.Source.IsValid())
+        {
+            Billboards.RemoveAtSwap(i);
+            continue;
+        }
+
+        FRotator LookAt = (CamLoc - WidgetComp->GetComponentLocation()).Rotation();
+        if (B.bYawOnly) { LookAt.Pitch = 0.f; LookAt.Roll = 0.f; } else { LookAt.Roll = 0.f; }
+        WidgetComp->SetWorldRotation(LookAt);
+    }
+}
+
+void UAeyerjiStatusBarOverlayComponent::TickOverlayWidgets(APlayerController* PC)
+{
     for (int32 i = Tracked.Num() - 1; i >= 0; --i)
     {
         FTracked& T = Tracked[i];
 
         AActor* Target = T.Target.Get();
         UW_AeyerjiStatusBar* W = T.Widget.Get();
-        if (!Target || !W)
+        if (!Target || !W || !T.Source.IsValid())
         {
+            ReleaseWidget(W, T.ZOrder);
             Tracked.RemoveAtSwap(i);
             continue;
         }
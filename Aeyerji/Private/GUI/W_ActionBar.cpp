@@ -14,6 +14,8 @@
 #include "Kismet/GameplayStatics.h"
 #include "Logging/AeyerjiLog.h"
 #include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 UW_ActionBar::UW_ActionBar(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -27,7 +29,7 @@ void UW_ActionBar::Refresh(const TArray<FAeyerjiAbilitySlot> &NewBar)
 {
 	if (!SlotsBox)
 	{
-		AJ_LOG(this, "Refresh aborted – SlotsBox == nullptr");
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "Refresh aborted – SlotsBox == nullptr");
 		return;
 	}
 
@@ -42,7 +44,6 @@ void UW_ActionBar::Refresh(const TArray<FAeyerjiAbilitySlot> &NewBar)
 		{
 			SlotWidget->StoredSlotIndex = Idx;
 			SlotWidget->StoredSlotData = NewBar[Idx];
-			SlotWidget->ClearCooldownDisplay();
 
 			if (NewBar[Idx].Icon)
 			{
@@ -55,17 +56,17 @@ void UW_ActionBar::Refresh(const TArray<FAeyerjiAbilitySlot> &NewBar)
 		}
 		else
 		{
-			AJ_LOG(this, "Widget at %d is NOT a UW_ActionSlotNative - skipped", Idx);
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "Widget at %d is NOT a UW_ActionSlotNative - skipped", Idx);
 		}
 	}
 
 	if (ChildCount != IncomingSize)
 	{
-		AJ_LOG(this, "Widget count (%d) ? SaveData count (%d). Check save/load path!", ChildCount, IncomingSize);
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "Widget count (%d) ? SaveData count (%d). Check save/load path!", ChildCount, IncomingSize);
 	}
 
 	EnsureDefaultPotionSlot(NewBar);
-	UpdateCooldowns();
+	RebindCooldownEvents();
 }
 
 /* ----------------------- InitWithPlayerState() --------------------------- */
@@ -73,7 +74,7 @@ void UW_ActionBar::InitWithPlayerState(AAeyerjiPlayerState *PS)
 {
 	if (!PS)
 	{
-		AJ_LOG(this, TEXT("UW_ActionBar::InitWithPlayerState() no PS"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("UW_ActionBar::InitWithPlayerState() no PS"));
 		return;
 	}
 	// AJ_LOG(this, TEXT("UW_ActionBar::InitWithPlayerState() good to go"));
@@ -92,7 +93,7 @@ void UW_ActionBar::InitWithPlayerState(AAeyerjiPlayerState *PS)
 
 	if (PS == CachedPS)
 	{
-		AJ_LOG(this, "InitWithPlayerState called with SAME PS – forcing refresh");
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "InitWithPlayerState called with SAME PS – forcing refresh");
 		Refresh(PS->GetActionBar());
 		return;
 	}
@@ -101,23 +102,24 @@ void UW_ActionBar::InitWithPlayerState(AAeyerjiPlayerState *PS)
 	{
 		CachedPS->OnActionBarChanged.RemoveDynamic(this, &UW_ActionBar::Refresh);
 		CachedPS->OnActionBarSwapBlocked.RemoveDynamic(this, &UW_ActionBar::HandleSwapBlocked);
+		CachedPS->OnPawnSet.RemoveDynamic(this, &UW_ActionBar::HandlePawnSet);
 	}
 
 	CachedPS = PS;
 
 	ResetCachedAbilitySystem();
-	CooldownTickAccumulator = CooldownTickInterval;
 	CachedPS->OnActionBarChanged.AddDynamic(this, &UW_ActionBar::Refresh);
 	CachedPS->OnActionBarSwapBlocked.AddDynamic(this, &UW_ActionBar::HandleSwapBlocked);
+	CachedPS->OnPawnSet.AddDynamic(this, &UW_ActionBar::HandlePawnSet);
 
-	AJ_LOG(this, "Bound to PlayerState=%s", *GetNameSafe(CachedPS));
+	AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "Bound to PlayerState=%s", *GetNameSafe(CachedPS));
 
 	Refresh(CachedPS->GetActionBar());
 }
 
 void UW_ActionBar::HandleSwapBlocked(FText Reason, TSubclassOf<UGameplayAbility> AbilityClass)
 {
-	AJ_LOG(this, TEXT("Action bar swap blocked for %s (%s)"),
+	AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("Action bar swap blocked for %s (%s)"),
 		*GetNameSafe(AbilityClass),
 		*Reason.ToString());
 
@@ -136,39 +138,40 @@ void UW_ActionBar::NativeConstruct()
 
 	ResetCachedAbilitySystem();
 	CachedPotionSlot.Reset();
-	CooldownTickAccumulator = CooldownTickInterval;
-	UpdateCooldowns();
+	RebindCooldownEvents();
 }
 
-void UW_ActionBar::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+void UW_ActionBar::NativeDestruct()
 {
-	Super::NativeTick(MyGeometry, InDeltaTime);
+	UnbindCooldownEvents();
 
-	if (CooldownTickInterval <= 0.f)
+	if (CachedPS)
 	{
-		UpdateCooldowns();
-		return;
+		CachedPS->OnPawnSet.RemoveDynamic(this, &UW_ActionBar::HandlePawnSet);
 	}
 
-	CooldownTickAccumulator += InDeltaTime;
-	if (CooldownTickAccumulator >= CooldownTickInterval)
-	{
-		CooldownTickAccumulator = 0.f;
-		UpdateCooldowns();
-	}
-}/* -------------------- Context-menu & Ability Picker ---------------------- */
+	Super::NativeDestruct();
+}
+
+void UW_ActionBar::HandlePawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn)
+{
+	ResetCachedAbilitySystem();
+	RebindCooldownEvents();
+}
+
+/* -------------------- Context-menu & Ability Picker ---------------------- */
 void UW_ActionBar::HandleSlotRightClicked(int32 Index)
 {
 	if (!PickerClass)
 	{
-		AJ_LOG(this, "PickerClass not set!");
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "PickerClass not set!");
 		return;
 	}
 
 	APlayerController *PC = GetOwningPlayer();
 	if (!PC)
 	{
-		AJ_LOG(this, "HandleSlotRightClicked – GetOwningPlayer() == nullptr");
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "HandleSlotRightClicked – GetOwningPlayer() == nullptr");
 		return;
 	}
 
@@ -182,7 +185,7 @@ void UW_ActionBar::HandleSlotRightClicked(int32 Index)
 		PickerInstance = CreateWidget<UW_AbilitySelectionNative>(PC, PickerClass);
 		if (!PickerInstance)
 		{
-			AJ_LOG(this, "Failed to spawn PickerInstance");
+			AJ_LOG_CAT(LogAeyerjiUI, Log, this, "Failed to spawn PickerInstance");
 			return;
 		}
 
@@ -204,12 +207,12 @@ bool UW_ActionBar::ActivateSlotByIndex(int32 SlotIndex)
 
 	{
 
-		AJ_LOG(this, TEXT("ActivateSlotByIndex() no CachedPS"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ActivateSlotByIndex() no CachedPS"));
 
 		return false;
 	}
 
-	AJ_LOG(this, TEXT("ActivateSlotByIndex() request for index %d"), SlotIndex);
+	AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ActivateSlotByIndex() request for index %d"), SlotIndex);
 
 	const TArray<FAeyerjiAbilitySlot> Bar = CachedPS->GetActionBar();
 
@@ -221,12 +224,12 @@ bool UW_ActionBar::ActivateSlotByIndex(int32 SlotIndex)
 
 		{
 
-			AJ_LOG(this, TEXT("ActivateSlotByIndex() succeeded via PlayerState for %d"), SlotIndex);
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ActivateSlotByIndex() succeeded via PlayerState for %d"), SlotIndex);
 
 			return true;
 		}
 
-		AJ_LOG(this, TEXT("ActivateSlotByIndex() PlayerState data failed, falling back (index %d)"), SlotIndex);
+		AJ_LOG_CAT(LogAeyerjiUI, Log, this, TEXT("ActivateSlotByIndex() PlayerState data failed, falling back (index %d)"), SlotIndex);
 	}
 
 	if (UW_ActionSlotNative *SlotWidget = GetSlotWidget(SlotIndex))
@@ -235,12 +238,12 @@ bool UW_ActionBar::ActivateSlotByIndex(int32 SlotIndex)
 
 		const bool bResult = ExecuteAbilitySlot(SlotWidget->StoredSlotData);
 
-		AJ_LOG(this, TEXT("ActivateSlotByIndex() widget fallback %s for %d"), bResult ? TEXT("succeeded") : TEXT("failed"), SlotIndex);
+		AJ_LOG_CAT(LogAeyerjiUI, Log, this, TEXT("ActivateSlotByIndex() widget fallback %s for %d"), bResult ? TEXT("succeeded") : TEXT("failed"), SlotIndex);
 
 		return bResult;
 	}
 
-	AJ_LOG(this, TEXT("ActivateSlotByIndex() unable to resolve slot %d"), SlotIndex);
+	AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ActivateSlotByIndex() unable to resolve slot %d"), SlotIndex);
 
 	return false;
 }
@@ -249,13 +252,13 @@ UW_ActionSlotNative *UW_ActionBar::GetSlotWidget(int32 SlotIndex) const
 {
 	if (!SlotsBox)
 	{
-		AJ_LOG(this, TEXT("GetSlotWidget() SlotsBox == nullptr"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("GetSlotWidget() SlotsBox == nullptr"));
 		return nullptr;
 	}
 
 	if (SlotIndex < 0 || SlotIndex >= SlotsBox->GetChildrenCount())
 	{
-		AJ_LOG(this, TEXT("GetSlotWidget() index %d out of range"), SlotIndex);
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("GetSlotWidget() index %d out of range"), SlotIndex);
 		return nullptr;
 	}
 
@@ -264,7 +267,7 @@ UW_ActionSlotNative *UW_ActionBar::GetSlotWidget(int32 SlotIndex) const
 		return SlotWidget;
 	}
 
-	AJ_LOG(this, TEXT("GetSlotWidget() child %d is not UW_ActionSlotNative"), SlotIndex);
+	AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("GetSlotWidget() child %d is not UW_ActionSlotNative"), SlotIndex);
 	return nullptr;
 }
 
@@ -317,7 +320,7 @@ void UW_ActionBar::HandleSlotLeftClicked(UW_ActionSlotNative *MySlot)
 
 	{
 
-		AJ_LOG(this, TEXT("HandleSlotLeftClicked() invalid slot"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("HandleSlotLeftClicked() invalid slot"));
 
 		return;
 	}
@@ -334,7 +337,7 @@ void UW_ActionBar::HandleSlotLeftClicked(UW_ActionSlotNative *MySlot)
 
 		{
 
-			AJ_LOG(this, TEXT("HandleSlotLeftClicked() attempting PlayerState index %d"), MySlot->StoredSlotIndex);
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("HandleSlotLeftClicked() attempting PlayerState index %d"), MySlot->StoredSlotIndex);
 
 			bExecutedFromPlayerState = ExecuteAbilitySlot(Bar[MySlot->StoredSlotIndex]);
 
@@ -342,12 +345,12 @@ void UW_ActionBar::HandleSlotLeftClicked(UW_ActionSlotNative *MySlot)
 
 			{
 
-				AJ_LOG(this, TEXT("HandleSlotLeftClicked() succeeded via PlayerState for %d"), MySlot->StoredSlotIndex);
+				AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("HandleSlotLeftClicked() succeeded via PlayerState for %d"), MySlot->StoredSlotIndex);
 
 				return;
 			}
 
-			AJ_LOG(this, TEXT("HandleSlotLeftClicked() fallback to widget data (index %d)"), MySlot->StoredSlotIndex);
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("HandleSlotLeftClicked() fallback to widget data (index %d)"), MySlot->StoredSlotIndex);
 		}
 	}
 
@@ -359,26 +362,26 @@ void UW_ActionBar::HandleSlotLeftClicked(UW_ActionSlotNative *MySlot)
 
 		{
 
-			AJ_LOG(this, TEXT("HandleSlotLeftClicked() CachedPS missing - using widget data"));
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("HandleSlotLeftClicked() CachedPS missing - using widget data"));
 		}
 
 		else if (MySlot->StoredSlotIndex == INDEX_NONE)
 
 		{
 
-			AJ_LOG(this, TEXT("HandleSlotLeftClicked() slot index not initialised - using widget data"));
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("HandleSlotLeftClicked() slot index not initialised - using widget data"));
 		}
 
 		else if (!CachedPS->GetActionBar().IsValidIndex(MySlot->StoredSlotIndex))
 
 		{
 
-			AJ_LOG(this, TEXT("HandleSlotLeftClicked() index %d not in PlayerState bar - using widget data"), MySlot->StoredSlotIndex);
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("HandleSlotLeftClicked() index %d not in PlayerState bar - using widget data"), MySlot->StoredSlotIndex);
 		}
 
 		const bool bWidgetResult = ExecuteAbilitySlot(MySlot->StoredSlotData);
 
-		AJ_LOG(this, TEXT("HandleSlotLeftClicked() widget fallback %s"), bWidgetResult ? TEXT("succeeded") : TEXT("failed"));
+		AJ_LOG_CAT(LogAeyerjiUI, Log, this, TEXT("HandleSlotLeftClicked() widget fallback %s"), bWidgetResult ? TEXT("succeeded") : TEXT("failed"));
 	}
 }
 
@@ -386,7 +389,7 @@ bool UW_ActionBar::ExecuteAbilitySlot(const FAeyerjiAbilitySlot &SlotData)
 {
 	if (!CachedPS)
 	{
-		AJ_LOG(this, TEXT("ExecuteAbilitySlot() invalid PS"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() invalid PS"));
 		return false;
 	}
 
@@ -403,13 +406,13 @@ bool UW_ActionBar::ExecuteAbilitySlot(const FAeyerjiAbilitySlot &SlotData)
 
 	if (!SlotData.Tag.IsValid() && !SlotData.Class)
 	{
-		AJ_LOG(this, TEXT("ExecuteAbilitySlot() slot has no tag or class"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() slot has no tag or class"));
 		return false;
 	}
 
 	const FString TagString = SlotData.Tag.ToString();
 	const int32 TargetModeValue = static_cast<int32>(SlotData.TargetMode);
-	AJ_LOG(this, TEXT("ExecuteAbilitySlot() Tag=%s TargetMode=%d Level=%d"), *TagString, TargetModeValue, SlotData.Level);
+	AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() Tag=%s TargetMode=%d Level=%d"), *TagString, TargetModeValue, SlotData.Level);
 
 	/* ---------- find the owner's ASC ---------- */
 	UAbilitySystemComponent *ASC = nullptr;
@@ -423,7 +426,7 @@ bool UW_ActionBar::ExecuteAbilitySlot(const FAeyerjiAbilitySlot &SlotData)
 
 	if (!ASC)
 	{
-		AJ_LOG(this, TEXT("ExecuteAbilitySlot() ASC not found"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() ASC not found"));
 		return false;
 	}
 
@@ -450,7 +453,7 @@ bool UW_ActionBar::ExecuteAbilitySlot(const FAeyerjiAbilitySlot &SlotData)
 			const bool bCanActivate = ActorInfo
 				? AbilityCDO->CanActivateAbility(Spec.Handle, ActorInfo, nullptr, nullptr, &FailureTags)
 				: false;
-			AJ_LOG(this, TEXT("ExecuteAbilitySlot() Tag match %s CanActivate=%s FailTags=%s"),
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() Tag match %s CanActivate=%s FailTags=%s"),
 				*GetNameSafe(AbilityCDO),
 				bCanActivate ? TEXT("true") : TEXT("false"),
 				*FailureTags.ToString());
@@ -467,7 +470,7 @@ bool UW_ActionBar::ExecuteAbilitySlot(const FAeyerjiAbilitySlot &SlotData)
 
 		if (MatchingSpecs == 0)
 		{
-			AJ_LOG(this, TEXT("ExecuteAbilitySlot() no owned abilities match tag %s"), *TagString);
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() no owned abilities match tag %s"), *TagString);
 		}
 	}
 
@@ -523,14 +526,13 @@ bool UW_ActionBar::ExecuteAbilitySlot(const FAeyerjiAbilitySlot &SlotData)
 		if (!bActivated && SlotData.Class)
 		{
 			bActivated = ASC->TryActivateAbilityByClass(SlotData.Class, /*bAllowRemoteActivation=*/true);
-			AJ_LOG(this, TEXT("ExecuteAbilitySlot() TryActivateAbilityByClass %s (Class=%s)"),
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() TryActivateAbilityByClass %s (Class=%s)"),
 				bActivated ? TEXT("succeeded") : TEXT("failed"),
 				*GetNameSafe(SlotData.Class));
 		}
 
-		CooldownTickAccumulator = CooldownTickInterval;
-		UpdateCooldowns();
-		AJ_LOG(this, TEXT("ExecuteAbilitySlot() TryActivateAbilitiesByTag %s (Tag=%s)"), bActivated ? TEXT("succeeded") : TEXT("failed"), *TagString);
+		// The cooldown display starts from the cooldown tag event; nothing to poll here.
+		AJ_LOG_CAT(LogAeyerjiUI, Log, this, TEXT("ExecuteAbilitySlot() TryActivateAbilitiesByTag %s (Tag=%s)"), bActivated ? TEXT("succeeded") : TEXT("failed"), *TagString);
 		return bActivated;
 	}
 
@@ -540,31 +542,31 @@ bool UW_ActionBar::ExecuteAbilitySlot(const FAeyerjiAbilitySlot &SlotData)
 	{
 		if (IsAbilityOnCooldown(ASC, SlotData.Class))
 		{
-			AJ_LOG(this, TEXT("ExecuteAbilitySlot() %s on cooldown, blocking targeting"),
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() %s on cooldown, blocking targeting"),
 				*GetNameSafe(SlotData.Class));
 			return false;
 		}
 
 		if (auto *PC = GetOwningPlayer<AAeyerjiPlayerController>())
 		{
-			AJ_LOG(this, TEXT("ExecuteAbilitySlot() routing to targeting flow (Tag=%s Mode=%d)"), *TagString, TargetModeValue);
+			AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() routing to targeting flow (Tag=%s Mode=%d)"), *TagString, TargetModeValue);
 			PC->BeginAbilityTargeting(SlotData);
 			return true;
 		}
 
-		AJ_LOG(this, TEXT("ExecuteAbilitySlot() PlayerController missing for targeting"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() PlayerController missing for targeting"));
 		return false;
 	}
 
 	default:
-		AJ_LOG(this, TEXT("ExecuteAbilitySlot() unrecognised TargetMode!"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("ExecuteAbilitySlot() unrecognised TargetMode!"));
 		return false;
 	}
 }
 
 void UW_ActionBar::HandleAbilityPicked(int32 SlotIndex, FAeyerjiAbilitySlot Pick)
 {
-	AJ_LOG(this, "Ability picked for Slot %d (Icon=%s)", SlotIndex, *GetNameSafe(Pick.Icon));
+	AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, "Ability picked for Slot %d (Icon=%s)", SlotIndex, *GetNameSafe(Pick.Icon));
 
 	if (APlayerController *PC = GetOwningPlayer())
 	{
@@ -577,9 +579,6 @@ void UW_ActionBar::HandleAbilityPicked(int32 SlotIndex, FAeyerjiAbilitySlot Pick
 
 				// Ask the server to grant the underlying GA once
 				CachedPS->Server_GrantAbilityFromSlot(Pick);
-
-				CooldownTickAccumulator = CooldownTickInterval;
-				UpdateCooldowns();
 			}
 		}
 	}
@@ -587,110 +586,256 @@ void UW_ActionBar::HandleAbilityPicked(int32 SlotIndex, FAeyerjiAbilitySlot Pick
 
 
 
-void UW_ActionBar::UpdateCooldowns()
+void UW_ActionBar::RebindCooldownEvents()
 {
+	UnbindCooldownEvents();
+
 	if (!SlotsBox)
 	{
-		AJ_LOG(this, TEXT("UpdateCooldowns aborted - SlotsBox null"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("RebindCooldownEvents aborted - SlotsBox null"));
 		return;
 	}
 
-	UAbilitySystemComponent* AbilitySystem = ResolveAbilitySystem();
-	//AJ_LOG(this, TEXT("UpdateCooldowns ASC=%s"), *GetNameSafe(AbilitySystem));
 	const int32 ChildCount = SlotsBox->GetChildrenCount();
-
 	for (int32 Idx = 0; Idx < ChildCount; ++Idx)
 	{
 		if (UW_ActionSlotNative* SlotWidget = Cast<UW_ActionSlotNative>(SlotsBox->GetChildAt(Idx)))
 		{
-			if (!AbilitySystem)
-			{
-				AJ_LOG(this, TEXT("UpdateCooldowns slot %d no ASC - clearing display"), Idx);
-				SlotWidget->ClearCooldownDisplay();
-				continue;
-			}
+			SlotWidget->ClearCooldownDisplay();
+		}
+	}
 
-			if (!TryUpdateSlotCooldown(*AbilitySystem, *SlotWidget))
-			{
-				//AJ_LOG(this, TEXT("UpdateCooldowns slot %d failed to resolve cooldown - clearing display"), Idx);
-				SlotWidget->ClearCooldownDisplay();
-			}
-			// else
-			// {
-			// 	AJ_LOG(this, TEXT("UpdateCooldowns slot %d refreshed cooldown display (Remaining=%.2f Total=%.2f Percent=%.2f)"),
-			// 		Idx,
-			// 		SlotWidget->CooldownTimeRemaining,
-			// 		SlotWidget->CooldownTotalTime,
-			// 		SlotWidget->CooldownPercent);
-			// }
+	SlotCooldowns.Reset();
+	SlotCooldowns.SetNum(ChildCount);
+
+	UAbilitySystemComponent* AbilitySystem = ResolveAbilitySystem();
+	if (!AbilitySystem)
+	{
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("RebindCooldownEvents no ASC yet - waiting for pawn"));
+		return;
+	}
+
+	CooldownEventASC = AbilitySystem;
+
+	FGameplayTagContainer AllCooldownTags;
+	for (int32 Idx = 0; Idx < ChildCount; ++Idx)
+	{
+		const UW_ActionSlotNative* SlotWidget = Cast<UW_ActionSlotNative>(SlotsBox->GetChildAt(Idx));
+		if (!SlotWidget || !SlotWidget->StoredSlotData.Class)
+		{
+			continue;
 		}
-		else
+
+		const UGameplayAbility* AbilityCDO = SlotWidget->StoredSlotData.Class->GetDefaultObject<UGameplayAbility>();
+		if (const FGameplayTagContainer* CooldownTags = AbilityCDO ? AbilityCDO->GetCooldownTags() : nullptr)
+		{
+			SlotCooldowns[Idx].CooldownTags = *CooldownTags;
+			AllCooldownTags.AppendTags(*CooldownTags);
+		}
+	}
+
+	for (const FGameplayTag& Tag : AllCooldownTags)
+	{
+		const FDelegateHandle Handle = AbilitySystem->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved)
+			.AddUObject(this, &UW_ActionBar::HandleCooldownTagChanged);
+		CooldownTagHandles.Emplace(Tag, Handle);
+	}
+
+	// Cooldowns already running (bar edited mid-cooldown, respawn) never fire an add event.
+	bool bAnyActive = false;
+	for (int32 Idx = 0; Idx < SlotCooldowns.Num(); ++Idx)
+	{
+		if (AbilitySystem->HasAnyMatchingGameplayTags(SlotCooldowns[Idx].CooldownTags))
+		{
+			bAnyActive |= BeginSlotCooldown(Idx);
+		}
+	}
+
+	if (bAnyActive)
+	{
+		TickCooldowns();
+	}
+}
+
+void UW_ActionBar::UnbindCooldownEvents()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(CooldownTimerHandle);
+	}
+
+	if (UAbilitySystemComponent* AbilitySystem = CooldownEventASC.Get())
+	{
+		for (const TPair<FGameplayTag, FDelegateHandle>& Entry : CooldownTagHandles)
+		{
+			AbilitySystem->UnregisterGameplayTagEvent(Entry.Value, Entry.Key, EGameplayTagEventType::NewOrRemoved);
+		}
+	}
+
+	CooldownTagHandles.Reset();
+	CooldownEventASC.Reset();
+}
+
+void UW_ActionBar::HandleCooldownTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	UAbilitySystemComponent* AbilitySystem = CooldownEventASC.Get();
+	if (!AbilitySystem)
+	{
+		return;
+	}
+
+	bool bStarted = false;
+	for (int32 Idx = 0; Idx < SlotCooldowns.Num(); ++Idx)
+	{
+		const FSlotCooldownState& State = SlotCooldowns[Idx];
+		if (!State.CooldownTags.HasTagExact(Tag))
+		{
+			continue;
+		}
+
+		if (NewCount > 0)
+		{
+			bStarted |= BeginSlotCooldown(Idx);
+		}
+		else if (State.bActive && !AbilitySystem->HasAnyMatchingGameplayTags(State.CooldownTags))
 		{
-			AJ_LOG(this, TEXT("UpdateCooldowns child %d not UW_ActionSlotNative"), Idx);
+			EndSlotCooldown(Idx);
 		}
 	}
+
+	if (bStarted)
+	{
+		TickCooldowns();
+	}
 }
 
-bool UW_ActionBar::TryUpdateSlotCooldown(UAbilitySystemComponent& AbilitySystem, UW_ActionSlotNative& SlotWidget) const
+bool UW_ActionBar::BeginSlotCooldown(int32 SlotIndex)
 {
-	const FAeyerjiAbilitySlot& SlotData = SlotWidget.StoredSlotData;
-	if (!SlotData.Class)
+	UAbilitySystemComponent* AbilitySystem = CooldownEventASC.Get();
+	UWorld* World = GetWorld();
+	if (!AbilitySystem || !World || !SlotCooldowns.IsValidIndex(SlotIndex))
+	{
+		return false;
+	}
+
+	FSlotCooldownState& State = SlotCooldowns[SlotIndex];
+	if (State.CooldownTags.IsEmpty())
 	{
-		//AJ_LOG(this, TEXT("TryUpdateSlotCooldown SlotIndex=%d no ability class"), SlotWidget.StoredSlotIndex);
 		return false;
 	}
 
+	// Same lookup UGameplayAbility::GetCooldownTimeRemainingAndDuration does, without needing the granted spec.
 	float TimeRemaining = 0.f;
 	float TotalDuration = 0.f;
+	const FGameplayEffectQuery Query = FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(State.CooldownTags);
+	for (const TPair<float, float>& Entry : AbilitySystem->GetActiveEffectsTimeRemainingAndDuration(Query))
+	{
+		if (Entry.Key > TimeRemaining)
+		{
+			TimeRemaining = Entry.Key;
+			TotalDuration = Entry.Value;
+		}
+	}
+
+	if (TimeRemaining <= KINDA_SMALL_NUMBER || TotalDuration <= KINDA_SMALL_NUMBER)
+	{
+		AJ_LOG_THROTTLED(LogAeyerjiUI, Verbose, this, TEXT("BeginSlotCooldown SlotIndex=%d no timed cooldown effect (Remaining=%.2f Total=%.2f)"),
+			SlotIndex, TimeRemaining, TotalDuration);
+		return false;
+	}
+
+	State.Duration = TotalDuration;
+	State.StartTime = World->GetTimeSeconds() - (TotalDuration - TimeRemaining);
+	State.bActive = true;
+	return true;
+}
+
+void UW_ActionBar::EndSlotCooldown(int32 SlotIndex)
+{
+	if (!SlotCooldowns.IsValidIndex(SlotIndex))
+	{
+		return;
+	}
+
+	SlotCooldowns[SlotIndex].bActive = false;
 
-	if (FGameplayAbilitySpec* Spec = AbilitySystem.FindAbilitySpecFromClass(SlotData.Class))
+	if (UW_ActionSlotNative* SlotWidget = SlotsBox ? Cast<UW_ActionSlotNative>(SlotsBox->GetChildAt(SlotIndex)) : nullptr)
 	{
-		if (Spec->Ability)
+		SlotWidget->ClearCooldownDisplay();
+	}
+}
+
+void UW_ActionBar::TickCooldowns()
+{
+	UWorld* World = GetWorld();
+	if (!World || !SlotsBox)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	UAbilitySystemComponent* AbilitySystem = CooldownEventASC.Get();
+	bool bAnyActive = false;
+
+	for (int32 Idx = 0; Idx < SlotCooldowns.Num(); ++Idx)
+	{
+		FSlotCooldownState& State = SlotCooldowns[Idx];
+		if (!State.bActive)
+		{
+			continue;
+		}
+
+		float TimeRemaining = static_cast<float>(State.StartTime + State.Duration - Now);
+		if (TimeRemaining <= KINDA_SMALL_NUMBER)
 		{
-			if (const FGameplayAbilityActorInfo* ActorInfo = AbilitySystem.AbilityActorInfo.Get())
+			// Tag still present past the recorded window: the effect was extended or re-applied without a tag transition.
+			if (AbilitySystem && AbilitySystem->HasAnyMatchingGameplayTags(State.CooldownTags) && BeginSlotCooldown(Idx))
 			{
-				Spec->Ability->GetCooldownTimeRemainingAndDuration(Spec->Handle, ActorInfo, TimeRemaining, TotalDuration);
-				// AJ_LOG(this, TEXT("TryUpdateSlotCooldown SlotIndex=%d Class=%s Remaining=%.2f Total=%.2f"),
-				// 	SlotWidget.StoredSlotIndex,
-				// 	*GetNameSafe(SlotData.Class),
-				// 	TimeRemaining,
-				// 	TotalDuration);
+				TimeRemaining = static_cast<float>(State.StartTime + State.Duration - Now);
 			}
 			else
 			{
-				AJ_LOG(this, TEXT("TryUpdateSlotCooldown SlotIndex=%d missing ActorInfo for class %s"),
-					SlotWidget.StoredSlotIndex,
-					*GetNameSafe(SlotData.Class));
+				EndSlotCooldown(Idx);
+				continue;
 			}
 		}
-		else
+
+		if (UW_ActionSlotNative* SlotWidget = Cast<UW_ActionSlotNative>(SlotsBox->GetChildAt(Idx)))
 		{
-			AJ_LOG(this, TEXT("TryUpdateSlotCooldown SlotIndex=%d Spec ability null for class %s"),
-				SlotWidget.StoredSlotIndex,
-				*GetNameSafe(SlotData.Class));
+			SlotWidget->UpdateCooldownDisplay(TimeRemaining, State.Duration);
 		}
+		bAnyActive = true;
+	}
+
+	if (bAnyActive)
+	{
+		ScheduleCooldownTick();
 	}
 	else
 	{
-		AJ_LOG(this, TEXT("TryUpdateSlotCooldown SlotIndex=%d no spec found for class %s"),
-			SlotWidget.StoredSlotIndex,
-			*GetNameSafe(SlotData.Class));
+		World->GetTimerManager().ClearTimer(CooldownTimerHandle);
 	}
+}
 
-	const bool bValidDuration = TotalDuration > KINDA_SMALL_NUMBER;
-	const bool bValidRemaining = TimeRemaining > KINDA_SMALL_NUMBER;
+void UW_ActionBar::ScheduleCooldownTick()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
 
-	if (!bValidDuration || !bValidRemaining)
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (CooldownTickInterval <= 0.f)
 	{
-		// AJ_LOG(this, TEXT("TryUpdateSlotCooldown SlotIndex=%d invalid cooldown data (Remaining=%.2f Total=%.2f)"),
-		// 	SlotWidget.StoredSlotIndex,
-		// 	TimeRemaining,
-		// 	TotalDuration);
-		return false;
+		CooldownTimerHandle = TimerManager.SetTimerForNextTick(this, &UW_ActionBar::TickCooldowns);
+		return;
 	}
 
-	SlotWidget.UpdateCooldownDisplay(TimeRemaining, TotalDuration);
-	return true;
+	if (!TimerManager.IsTimerActive(CooldownTimerHandle))
+	{
+		TimerManager.SetTimer(CooldownTimerHandle, this, &UW_ActionBar::TickCooldowns, CooldownTickInterval, /*bLoop*/ true);
+	}
 }
 
 UAbilitySystemComponent* UW_ActionBar::ResolveAbilitySystem()
@@ -755,12 +900,12 @@ bool UW_ActionBar::IsDefaultPotionSlotConfigured() const
 
 	if (!bHasTag)
 	{
-		AJ_LOG(this, TEXT("DefaultPotionSlot missing Tag; cannot auto-assign"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("DefaultPotionSlot missing Tag; cannot auto-assign"));
 	}
 
 	if (!bHasClass)
 	{
-		AJ_LOG(this, TEXT("DefaultPotionSlot missing Class; cannot auto-assign"));
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("DefaultPotionSlot missing Class; cannot auto-assign"));
 	}
 
 	return bHasTag && bHasClass;
@@ -791,7 +936,7 @@ UW_ActionSlotNative* UW_ActionBar::ResolvePotionSlotWidget()
 			return SlotWidget;
 		}
 
-		AJ_LOG(this, TEXT("Potion slot widget %s is not a UW_ActionSlotNative"), *PotionSlotWidgetName.ToString());
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("Potion slot widget %s is not a UW_ActionSlotNative"), *PotionSlotWidgetName.ToString());
 	}
 
 	return nullptr;
@@ -842,7 +987,7 @@ void UW_ActionBar::EnsureDefaultPotionSlot(const TArray<FAeyerjiAbilitySlot>& Ne
 
 	if (!NewBar.IsValidIndex(PotionSlotIndex))
 	{
-		AJ_LOG(this, TEXT("Potion slot index %d missing from action bar (size %d)"),
+		AJ_LOG_CAT(LogAeyerjiUI, Verbose, this, TEXT("Potion slot index %d missing from action bar (size %d)"),
 			PotionSlotIndex,
 			NewBar.Num());
 		return;
@@ -104,6 +104,12 @@ void UW_AeyerjiStatusBar::BindToAttributesWithXPAndLevel(UAbilitySystemComponent
 }
 
 void UW_AeyerjiStatusBar::NativeDestruct()
+{
+    UnbindFromAttributes();
+    Super::NativeDestruct();
+}
+
+void UW_AeyerjiStatusBar::UnbindFromAttributes()
 {
     if (ASC.IsValid())
     {
@@ -117,7 +123,27 @@ void UW_AeyerjiStatusBar::NativeDestruct()
         if (HPRegenChangedHandle.IsValid())    ASC->GetGameplayAttributeValueChangeDelegate(HPRegenAttr).Remove(HPRegenChangedHandle);
         if (ManaRegenChangedHandle.IsValid())  ASC->GetGameplayAttributeValueChangeDelegate(ManaRegenAttr).Remove(ManaRegenChangedHandle);
     }
-    Super::NativeDestruct();
+
+    HealthChangedHandle.Reset();
+    MaxHealthChangedHandle.Reset();
+    ManaChangedHandle.Reset();
+    MaxManaChangedHandle.Reset();
+    XPChangedHandle.Reset();
+    MaxXPChangedHandle.Reset();
+    LevelChangedHandle.Reset();
+    HPRegenChangedHandle.Reset();
+    ManaRegenChangedHandle.Reset();
+
+    ASC.Reset();
+    XPAttr        = FGameplayAttribute();
+    XPMaxAttr     = FGameplayAttribute();
+    LevelAttr     = FGameplayAttribute();
+    HPRegenAttr   = FGameplayAttribute();
+    ManaRegenAttr = FGameplayAttribute();
+
+    // Pooled widgets must not flash the previous owner's damage/heal state on reuse
+    HealthGhostHold = ManaGhostHold = XPGhostHold = 0.f;
+    HealFlash = DmgFlash = 0.f;
 }
 
 void UW_AeyerjiStatusBar::OnHealthChanged(const FOnAttributeChangeData& /*Data*/)
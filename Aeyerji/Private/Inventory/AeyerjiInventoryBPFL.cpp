@@ -13,6 +13,7 @@
 #include "Logging/AeyerjiLog.h"
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerState.h"
+#include "Systems/AeyerjiLootRegistry.h"
 #include "Systems/LootService.h"
 #include "CollisionQueryParams.h"
 #include "Engine/Engine.h"
@@ -547,11 +548,14 @@ void UAeyerjiInventoryBPFL::SetAllLootLabelsVisible(UObject* WorldContext, bool
 		return;
 	}
 
-	if (UWorld* World = WorldContext->GetWorld())
+	if (const UAeyerjiLootRegistry* Registry = UAeyerjiLootRegistry::Get(WorldContext))
 	{
-		for (TActorIterator<AAeyerjiLootPickup> It(World); It; ++It)
+		for (const TWeakObjectPtr<AAeyerjiLootPickup>& Pickup : Registry->GetPickups())
 		{
-			It->SetLabelVisible(bVisible);
+			if (AAeyerjiLootPickup* Loot = Pickup.Get())
+			{
+				Loot->SetLabelVisible(bVisible);
+			}
 		}
 	}
 }
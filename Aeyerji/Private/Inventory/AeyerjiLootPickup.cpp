@@ -30,6 +30,7 @@
 #include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "Logging/AeyerjiLog.h"
+#include "Logging/AeyerjiStats.h"
 #include "UObject/Package.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/UnrealType.h"
@@ -47,7 +48,9 @@ namespace
 AAeyerjiLootPickup::AAeyerjiLootPickup()
 {
 	bReplicates = true;
-	bAlwaysRelevant = true;
+	// Relevancy is spatial (replication graph grid); settled pickups go dormant, see EnterSettledDormancy.
+	bAlwaysRelevant = false;
+	SetNetCullDistanceSquared(FMath::Square(10000.f));
 	bReplicateUsingRegisteredSubObjectList = true;
 	PrimaryActorTick.bCanEverTick = true;
 	PrimaryActorTick.TickGroup = TG_PrePhysics; // update before physics for smoother motion
@@ -157,7 +160,7 @@ AAeyerjiLootPickup* AAeyerjiLootPickup::SpawnFromInstance(
 
 	if (!ClassToSpawn)
 	{
-		AJ_LOG(&World, TEXT("SpawnFromInstance aborted - ClassToSpawn null, PickupClass=%s"), *GetNameSafe(PickupClass.Get()));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, &World, TEXT("SpawnFromInstance aborted - ClassToSpawn null, PickupClass=%s"), *GetNameSafe(PickupClass.Get()));
 		return nullptr;
 	}
 
@@ -166,7 +169,7 @@ AAeyerjiLootPickup* AAeyerjiLootPickup::SpawnFromInstance(
 
 	if (!Pickup)
 	{
-		AJ_LOG(&World, TEXT("SpawnFromInstance failed - spawn deferred returned null for class %s"), *GetNameSafe(ClassToSpawn));
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, &World, TEXT("SpawnFromInstance failed - spawn deferred returned null for class %s"), *GetNameSafe(ClassToSpawn));
 		return nullptr;
 	}
 
@@ -201,7 +204,7 @@ AAeyerjiLootPickup* AAeyerjiLootPickup::SpawnFromDefinition(
 
 	if (!ClassToSpawn)
 	{
-		AJ_LOG(&World, TEXT("SpawnFromDefinition aborted - ClassToSpawn null, PickupClass=%s"), *GetNameSafe(PickupClass.Get()));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, &World, TEXT("SpawnFromDefinition aborted - ClassToSpawn null, PickupClass=%s"), *GetNameSafe(PickupClass.Get()));
 		return nullptr;
 	}
 
@@ -210,7 +213,7 @@ AAeyerjiLootPickup* AAeyerjiLootPickup::SpawnFromDefinition(
 
 	if (!Pickup)
 	{
-		AJ_LOG(&World, TEXT("SpawnFromDefinition failed - spawn deferred returned null for class %s"), *GetNameSafe(ClassToSpawn));
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, &World, TEXT("SpawnFromDefinition failed - spawn deferred returned null for class %s"), *GetNameSafe(ClassToSpawn));
 		return nullptr;
 	}
 
@@ -273,7 +276,7 @@ void AAeyerjiLootPickup::ExecutePickup(AAeyerjiPlayerController* Controller)
 {
 	if (!HasAuthority() || !Controller || !ItemInstance)
 	{
-		AJ_LOG(this, TEXT("ExecutePickup aborted - Authority=%d Controller=%s Item=%s"),
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ExecutePickup aborted - Authority=%d Controller=%s Item=%s"),
 			HasAuthority(),
 			*GetNameSafe(Controller),
 			ItemInstance ? *ItemInstance->GetName() : TEXT("NULL"));
@@ -282,10 +285,13 @@ void AAeyerjiLootPickup::ExecutePickup(AAeyerjiPlayerController* Controller)
 
 	if (!CanPawnLoot(Controller))
 	{
-		AJ_LOG(this, TEXT("ExecutePickup denied - pawn not eligible (%s)"), *GetNameSafe(Controller));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ExecutePickup denied - pawn not eligible (%s)"), *GetNameSafe(Controller));
 		return;
 	}
 
+	// Wake before touching replicated state so the item change and the FX multicast reach clients.
+	SetNetDormancy(DORM_Awake);
+
 	UAeyerjiItemInstance* GrantedItem = ItemInstance;
 	const FAeyerjiPickupVisualConfig VisualConfig = ResolvePickupVisualConfig(GrantedItem);
 
@@ -294,7 +300,7 @@ void AAeyerjiLootPickup::ExecutePickup(AAeyerjiPlayerController* Controller)
 
 	if (UAeyerjiItemInstance* GrantedInventoryItem = GiveLootToInventory(Controller, GrantedItem))
 	{
-		AJ_LOG(this, TEXT("ExecutePickup success - granted to %s"), *GetNameSafe(Controller));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ExecutePickup success - granted to %s"), *GetNameSafe(Controller));
 		PickupIntents.Empty();
 		BroadcastPickupEvent(Controller, GrantedInventoryItem);
 		TriggerPickupFX(Controller, VisualConfig);
@@ -311,7 +317,8 @@ void AAeyerjiLootPickup::ExecutePickup(AAeyerjiPlayerController* Controller)
 		// Restore the item so the pickup remains usable.
 		ItemInstance = GrantedItem;
 		MARK_PROPERTY_DIRTY_FROM_NAME(AAeyerjiLootPickup, ItemInstance, this);
-		AJ_LOG(this, TEXT("ExecutePickup failed - inventory rejected for %s"), *GetNameSafe(Controller));
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, this, TEXT("ExecutePickup failed - inventory rejected for %s"), *GetNameSafe(Controller));
+		EnterSettledDormancy();
 	}
 }
 
@@ -324,7 +331,7 @@ void AAeyerjiLootPickup::RequestPickupFromClient(AAeyerjiPlayerController* Contr
 
 	if (Controller->IsLocalController())
 	{
-		AJ_LOG(this, TEXT("RequestPickupFromClient - asking server via %s"), *GetNameSafe(Controller));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("RequestPickupFromClient - asking server via %s"), *GetNameSafe(Controller));
 		Controller->Server_RequestPickupActor(this);
 	}
 }
@@ -373,7 +380,7 @@ void AAeyerjiLootPickup::SetHighlighted(bool bInHighlighted)
 	}
 
 	bHighlighted = bInHighlighted;
-	AJ_LOG(this, TEXT("SetHighlighted %s -> %s"), *GetName(), bHighlighted ? TEXT("ON") : TEXT("OFF"));
+	AJ_LOG_THROTTLED(LogAeyerjiLoot, Verbose, this, TEXT("SetHighlighted %s -> %s"), *GetName(), bHighlighted ? TEXT("ON") : TEXT("OFF"));
 	ApplyHighlight(bHighlighted);
 	UpdateLabelVisibility();
 }
@@ -389,6 +396,7 @@ int32 AAeyerjiLootPickup::DebugRefreshItemScaling(const UAeyerjiLootTable& LootT
 	ItemInstance->ApplyLootStatScaling(&LootTable);
 	ItemInstance->ForceItemChangedForUI();
 	MARK_PROPERTY_DIRTY_FROM_NAME(AAeyerjiLootPickup, ItemInstance, this);
+	FlushNetDormancy();
 
 	return 1;
 }
@@ -402,6 +410,7 @@ void AAeyerjiLootPickup::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	DOREPLIFETIME(AAeyerjiLootPickup, ItemLevel);
 	DOREPLIFETIME(AAeyerjiLootPickup, ItemRarity);
 	DOREPLIFETIME(AAeyerjiLootPickup, SeedOverride);
+	DOREPLIFETIME_CONDITION(AAeyerjiLootPickup, LootHandle, COND_InitialOnly);
 }
 
 bool AAeyerjiLootPickup::ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags)
@@ -431,12 +440,23 @@ void AAeyerjiLootPickup::BeginPlay()
 {
 	Super::BeginPlay();
 
+	INC_DWORD_STAT(STAT_AJ_LivePickups);
+
+	if (UAeyerjiLootRegistry* Registry = UAeyerjiLootRegistry::Get(this))
+	{
+		const FAeyerjiLootHandle NewHandle = Registry->Register(this);
+		if (HasAuthority())
+		{
+			LootHandle = NewHandle;
+		}
+	}
+
 	ConfigureVolumes();
 	ApplyDefinitionMesh();
 
 	if (HasAuthority() && !ItemInstance && ItemDefinition)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup BeginPlay rolling item - Def=%s Level=%d Rarity=%d"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup BeginPlay rolling item - Def=%s Level=%d Rarity=%d"),
 			*GetNameSafe(ItemDefinition),
 			ItemLevel,
 			static_cast<int32>(ItemRarity));
@@ -459,7 +479,7 @@ void AAeyerjiLootPickup::BeginPlay()
 	RefreshOutlineTargets();
 	RefreshRarityVisuals();
 
-	UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup BeginPlay init - Loc=%s Authority=%d NetMode=%d Replicates=%d EnableDrop=%d AutoDrop=%d"),
+	UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup BeginPlay init - Loc=%s Authority=%d NetMode=%d Replicates=%d EnableDrop=%d AutoDrop=%d"),
 		*GetActorLocation().ToString(),
 		HasAuthority() ? 1 : 0,
 		GetNetMode(),
@@ -470,24 +490,25 @@ void AAeyerjiLootPickup::BeginPlay()
 	// Start drop on server if enabled
 	if (HasAuthority() && bEnableDropMotion && bAutoStartDrop)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup BeginPlay auto-starting drop - Enable=%d Auto=%d"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup BeginPlay auto-starting drop - Enable=%d Auto=%d"),
 			bEnableDropMotion ? 1 : 0,
 			bAutoStartDrop ? 1 : 0);
 		StartDropToGround();
 	}
 	else
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup BeginPlay drop skipped - HasAuthority=%d Enable=%d Auto=%d"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup BeginPlay drop skipped - HasAuthority=%d Enable=%d Auto=%d"),
 			HasAuthority() ? 1 : 0,
 			bEnableDropMotion ? 1 : 0,
 			bAutoStartDrop ? 1 : 0);
+		EnterSettledDormancy();
 	}
 }
 
 void AAeyerjiLootPickup::NotifyActorBeginCursorOver()
 {
 	Super::NotifyActorBeginCursorOver();
-	AJ_LOG(this, TEXT("NotifyActorBeginCursorOver"));
+	AJ_LOG_THROTTLED(LogAeyerjiLoot, Verbose, this, TEXT("NotifyActorBeginCursorOver"));
 	SetHighlighted(true);
 }
 
@@ -495,12 +516,15 @@ void AAeyerjiLootPickup::StartDropToGround()
 {
 	if (!HasAuthority() || !bEnableDropMotion)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup StartDropToGround blocked - HasAuthority=%d Enable=%d"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup StartDropToGround blocked - HasAuthority=%d Enable=%d"),
 			HasAuthority() ? 1 : 0,
 			bEnableDropMotion ? 1 : 0);
 		return;
 	}
 
+	// A re-drop moves the pickup again; replicate it until it settles.
+	SetNetDormancy(DORM_Awake);
+
 	// Ditch the tick-based arc/trace: immediately kick the mesh into physics with a small randomized toss.
 	bIsDropping = false;
 	bLoggedDropSkip = false;
@@ -517,19 +541,20 @@ void AAeyerjiLootPickup::StartDropToGround()
 	SetActorLocation(LaunchStart, false, nullptr, ETeleportType::TeleportPhysics);
 	UpdateLootBeamAnchor();
 
-	UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup StartDropToGround physics-only - Start=%s"), *LaunchStart.ToString());
+	UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup StartDropToGround physics-only - Start=%s"), *LaunchStart.ToString());
 
 	if (!StartPhysicsHandoff(/*bForceImmediate=*/false))
 	{
-		UE_LOG(LogAeyerji, Warning, TEXT("AeyerjiLootPickup StartDropToGround physics handoff failed - snapping to ground"));
+		UE_LOG(LogAeyerjiLoot, Warning, TEXT("AeyerjiLootPickup StartDropToGround physics handoff failed - snapping to ground"));
 		FinalSnapToGround();
+		EnterSettledDormancy();
 	}
 }
 
 void AAeyerjiLootPickup::ComputeDropEndpoints()
 {
 	const FVector SpawnLoc = GetActorLocation();
-	UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup ComputeDropEndpoints spawn loc %s"), *SpawnLoc.ToString());
+	UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup ComputeDropEndpoints spawn loc %s"), *SpawnLoc.ToString());
 
 	const float RandomYaw = FMath::FRandRange(-180.f, 180.f);
 	const FVector SideDir = FRotator(0.f, RandomYaw, 0.f).Vector();
@@ -545,7 +570,7 @@ void AAeyerjiLootPickup::ComputeDropEndpoints()
 	const float TraceDownDistance = 100000.f;
 	const FVector TraceStart = DropStart + FVector(0.f, 0.f, TraceUpOffset);
 	const FVector TraceEnd = DropStart + FVector(0.f, 0.f, -TraceDownDistance);
-	UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup ComputeDropEndpoints trace Start=%s End=%s"), *TraceStart.ToString(), *TraceEnd.ToString());
+	UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup ComputeDropEndpoints trace Start=%s End=%s"), *TraceStart.ToString(), *TraceEnd.ToString());
 
 	FHitResult Hit;
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(LootDropTrace), false, this);
@@ -562,21 +587,21 @@ void AAeyerjiLootPickup::ComputeDropEndpoints()
 	if (bHit && Hit.bBlockingHit)
 	{
 		DropEnd = Hit.ImpactPoint + FVector(0.f, 0.f, 5.f);
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup ComputeDropEndpoints hit ground - Impact=%s Normal=%s"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup ComputeDropEndpoints hit ground - Impact=%s Normal=%s"),
 			*Hit.ImpactPoint.ToString(),
 			*Hit.ImpactNormal.ToString());
 	}
 	else
 	{
 		DropEnd = DropStart + FVector(0.f, 0.f, -500.f);
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup ComputeDropEndpoints no ground hit - Using fallback End=%s (TraceDown=%.0f)"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup ComputeDropEndpoints no ground hit - Using fallback End=%s (TraceDown=%.0f)"),
 			*DropEnd.ToString(),
 			TraceDownDistance);
 	}
 
 	if (DropEnd.Z > DropStart.Z + KINDA_SMALL_NUMBER)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup ComputeDropEndpoints upward path detected - StartZ=%.2f EndZ=%.2f (SpawnZ=%.2f)"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup ComputeDropEndpoints upward path detected - StartZ=%.2f EndZ=%.2f (SpawnZ=%.2f)"),
 			DropStart.Z,
 			DropEnd.Z,
 			SpawnLoc.Z);
@@ -605,16 +630,44 @@ void AAeyerjiLootPickup::FinalSnapToGround()
 	{
 		const FVector SnapLoc = Hit.ImpactPoint + FVector(0.f, 0.f, 2.f);
 		SetActorLocation(SnapLoc, false, nullptr, ETeleportType::TeleportPhysics);
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup FinalSnapToGround snapped to %s"), *SnapLoc.ToString());
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup FinalSnapToGround snapped to %s"), *SnapLoc.ToString());
 	}
 	else
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup FinalSnapToGround no hit from %s -> %s"), *TraceStart.ToString(), *TraceEnd.ToString());
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup FinalSnapToGround no hit from %s -> %s"), *TraceStart.ToString(), *TraceEnd.ToString());
 	}
 
 	UpdateLootBeamAnchor();
 }
 
+void AAeyerjiLootPickup::EnterSettledDormancy()
+{
+	if (!HasAuthority() || bIsDropping || bPhysicsHandoffStarted)
+	{
+		return;
+	}
+
+	// Nothing changes on a resting pickup until someone picks it up; stop considering it for replication.
+	if (GetNetDormancy() != DORM_DormantAll)
+	{
+		SetNetDormancy(DORM_DormantAll);
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("EnterSettledDormancy - dormant at %s"), *GetActorLocation().ToString());
+	}
+}
+
+void AAeyerjiLootPickup::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DEC_DWORD_STAT(STAT_AJ_LivePickups);
+
+	if (UAeyerjiLootRegistry* Registry = UAeyerjiLootRegistry::Get(this))
+	{
+		Registry->Unregister(this, HasAuthority() ? LootHandle : FAeyerjiLootHandle());
+	}
+	LootHandle = FAeyerjiLootHandle();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AAeyerjiLootPickup::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
@@ -635,14 +688,14 @@ void AAeyerjiLootPickup::Tick(float DeltaSeconds)
 	{
 		if (!PreviewMesh)
 		{
-			UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup Tick physics sync aborted - PreviewMesh null"));
+			UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup Tick physics sync aborted - PreviewMesh null"));
 			bPhysicsHandoffStarted = false;
 			return;
 		}
 
 		if (!PreviewMesh->IsSimulatingPhysics())
 		{
-			UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup Tick physics sync aborted - PreviewMesh not simulating physics"));
+			UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup Tick physics sync aborted - PreviewMesh not simulating physics"));
 			bPhysicsHandoffStarted = false;
 			return;
 		}
@@ -675,7 +728,8 @@ void AAeyerjiLootPickup::Tick(float DeltaSeconds)
 			UpdateLootBeamAnchor();
 
 			bPhysicsHandoffStarted = false;
-			UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup Tick physics sync finished - FinalLoc=%s"), *GetActorLocation().ToString());
+			UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup Tick physics sync finished - FinalLoc=%s"), *GetActorLocation().ToString());
+			EnterSettledDormancy();
 		}
 
 		return;
@@ -685,7 +739,7 @@ void AAeyerjiLootPickup::Tick(float DeltaSeconds)
 	{
 		if (!bLoggedDropSkip)
 		{
-			UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup Tick skip - HasAuthority=%d Enable=%d Dropping=%d"),
+			UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup Tick skip - HasAuthority=%d Enable=%d Dropping=%d"),
 				HasAuthority() ? 1 : 0,
 				bEnableDropMotion ? 1 : 0,
 				bIsDropping ? 1 : 0);
@@ -735,7 +789,7 @@ void AAeyerjiLootPickup::Tick(float DeltaSeconds)
 
 	if (!bLoggedFirstTick)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup Tick start - Alpha=%.2f Elapsed=%.2f NewZ=%.2f StartZ=%.2f EndZ=%.2f ArcAlpha=%.2f"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup Tick start - Alpha=%.2f Elapsed=%.2f NewZ=%.2f StartZ=%.2f EndZ=%.2f ArcAlpha=%.2f"),
 			Alpha,
 			ElapsedDropTime,
 			NewLoc.Z,
@@ -746,7 +800,7 @@ void AAeyerjiLootPickup::Tick(float DeltaSeconds)
 	}
 	else if (!bLoggedMidTick && Alpha >= 0.5f)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup Tick mid - Alpha=%.2f Elapsed=%.2f NewZ=%.2f StartZ=%.2f EndZ=%.2f ArcAlpha=%.2f"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup Tick mid - Alpha=%.2f Elapsed=%.2f NewZ=%.2f StartZ=%.2f EndZ=%.2f ArcAlpha=%.2f"),
 			Alpha,
 			ElapsedDropTime,
 			NewLoc.Z,
@@ -762,7 +816,8 @@ void AAeyerjiLootPickup::Tick(float DeltaSeconds)
 
 		bIsDropping = false;
 		SetActorTickEnabled(false);
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup Tick finished drop - FinalLoc=%s"), *GetActorLocation().ToString());
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup Tick finished drop - FinalLoc=%s"), *GetActorLocation().ToString());
+		EnterSettledDormancy();
 	}
 }
 
@@ -775,13 +830,13 @@ bool AAeyerjiLootPickup::StartPhysicsHandoff(bool bForceImmediate /*=false*/)
 
 	if (!PreviewMesh)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup StartPhysicsHandoff aborted - PreviewMesh null"));
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup StartPhysicsHandoff aborted - PreviewMesh null"));
 		return false;
 	}
 
 	if (!PreviewMesh->GetStaticMesh())
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup StartPhysicsHandoff aborted - PreviewMesh has no StaticMesh"));
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup StartPhysicsHandoff aborted - PreviewMesh has no StaticMesh"));
 		return false;
 	}
 
@@ -789,7 +844,7 @@ bool AAeyerjiLootPickup::StartPhysicsHandoff(bool bForceImmediate /*=false*/)
 	{
 		if (BodySetup->CollisionTraceFlag == CTF_UseComplexAsSimple)
 		{
-			UE_LOG(LogAeyerji, Warning, TEXT("AeyerjiLootPickup StartPhysicsHandoff skipped - PreviewMesh uses ComplexAsSimple collision (physics not supported)."));
+			UE_LOG(LogAeyerjiLoot, Warning, TEXT("AeyerjiLootPickup StartPhysicsHandoff skipped - PreviewMesh uses ComplexAsSimple collision (physics not supported)."));
 			if (GEngine)
 			{
 				const FString Msg = FString::Printf(
@@ -845,7 +900,7 @@ bool AAeyerjiLootPickup::StartPhysicsHandoff(bool bForceImmediate /*=false*/)
 
 	if (!PreviewMesh->IsSimulatingPhysics())
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup StartPhysicsHandoff aborted - physics could not be enabled (no body setup?)"));
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup StartPhysicsHandoff aborted - physics could not be enabled (no body setup?)"));
 		bPhysicsHandoffStarted = false;
 		bIsDropping = true;
 
@@ -881,7 +936,7 @@ bool AAeyerjiLootPickup::StartPhysicsHandoff(bool bForceImmediate /*=false*/)
 		PreviewMesh->SetPhysicsAngularVelocityInDegrees(AngularVelDeg, false, NAME_None);
 		PreviewMesh->WakeAllRigidBodies();
 
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup StartPhysicsHandoff started - LinVel=%s AngVelDeg=%s Loc=%s"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup StartPhysicsHandoff started - LinVel=%s AngVelDeg=%s Loc=%s"),
 			*LinearVel.ToString(),
 			*AngularVelDeg.ToString(),
 			*GetActorLocation().ToString());
@@ -892,7 +947,7 @@ bool AAeyerjiLootPickup::StartPhysicsHandoff(bool bForceImmediate /*=false*/)
 		PreviewMesh->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector, false, NAME_None);
 		PreviewMesh->WakeAllRigidBodies();
 
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup StartPhysicsHandoff started (simple gravity) Loc=%s"),
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup StartPhysicsHandoff started (simple gravity) Loc=%s"),
 			*GetActorLocation().ToString());
 	}
 
@@ -902,7 +957,7 @@ bool AAeyerjiLootPickup::StartPhysicsHandoff(bool bForceImmediate /*=false*/)
 void AAeyerjiLootPickup::NotifyActorEndCursorOver()
 {
 	Super::NotifyActorEndCursorOver();
-	AJ_LOG(this, TEXT("NotifyActorEndCursorOver"));
+	AJ_LOG_THROTTLED(LogAeyerjiLoot, Verbose, this, TEXT("NotifyActorEndCursorOver"));
 	SetHighlighted(false);
 }
 
@@ -935,7 +990,7 @@ void AAeyerjiLootPickup::ApplyDefinitionMesh()
 
 	if (PreviewMesh->IsSimulatingPhysics() || bPhysicsHandoffStarted)
 	{
-		UE_LOG(LogAeyerji, Display, TEXT("AeyerjiLootPickup ApplyDefinitionMesh skipped - mesh is simulating physics"));
+		UE_LOG(LogAeyerjiLoot, Verbose, TEXT("AeyerjiLootPickup ApplyDefinitionMesh skipped - mesh is simulating physics"));
 		return;
 	}
 
@@ -1006,7 +1061,7 @@ void AAeyerjiLootPickup::HandlePickupSphereOverlap(
 {
 	if (!HasAuthority() || !bAutoPickup || !ItemInstance)
 	{
-		AJ_LOG(this, TEXT("HandlePickupSphereOverlap ignored - Authority=%d Auto=%d Item=%s"),
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("HandlePickupSphereOverlap ignored - Authority=%d Auto=%d Item=%s"),
 			HasAuthority(), bAutoPickup ? 1 : 0, ItemInstance ? *ItemInstance->GetName() : TEXT("NULL"));
 		return;
 	}
@@ -1014,25 +1069,25 @@ void AAeyerjiLootPickup::HandlePickupSphereOverlap(
 	APawn* Pawn = Cast<APawn>(OtherActor);
 	if (!Pawn)
 	{
-		AJ_LOG(this, TEXT("HandlePickupSphereOverlap ignored - %s is not a pawn"), *GetNameSafe(OtherActor));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("HandlePickupSphereOverlap ignored - %s is not a pawn"), *GetNameSafe(OtherActor));
 		return;
 	}
 
 	AAeyerjiPlayerController* Controller = Cast<AAeyerjiPlayerController>(Pawn->GetController());
 	if (!Controller)
 	{
-		AJ_LOG(this, TEXT("HandlePickupSphereOverlap ignored - pawn %s lacks player controller"), *GetNameSafe(Pawn));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("HandlePickupSphereOverlap ignored - pawn %s lacks player controller"), *GetNameSafe(Pawn));
 		return;
 	}
 
 	if (CanPawnLoot(Controller))
 	{
-		AJ_LOG(this, TEXT("HandlePickupSphereOverlap auto-looting for %s"), *GetNameSafe(Controller));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("HandlePickupSphereOverlap auto-looting for %s"), *GetNameSafe(Controller));
 		ExecutePickup(Controller);
 	}
 	else
 	{
-		AJ_LOG(this, TEXT("HandlePickupSphereOverlap - %s not yet eligible (distance/volume)"), *GetNameSafe(Controller));
+		AJ_LOG_THROTTLED(LogAeyerjiLoot, Verbose, this, TEXT("HandlePickupSphereOverlap - %s not yet eligible (distance/volume)"), *GetNameSafe(Controller));
 	}
 }
 
@@ -1348,7 +1403,7 @@ bool AAeyerjiLootPickup::CanPawnLoot(const AAeyerjiPlayerController* Controller)
 	const bool bCanLoot = bWithinRadius || bInsideVolume || bAutoPickup;
 	if (!bCanLoot)
 	{
-		AJ_LOG(this, TEXT("CanPawnLoot false - Controller=%s Dist=%.1f Accept=%.1f InVolume=%d Auto=%d"),
+		AJ_LOG_THROTTLED(LogAeyerjiLoot, Verbose, this, TEXT("CanPawnLoot false - Controller=%s Dist=%.1f Accept=%.1f InVolume=%d Auto=%d"),
 			*GetNameSafe(Controller),
 			FMath::Sqrt(DistanceSq),
 			AcceptRadius,
@@ -1362,7 +1417,7 @@ UAeyerjiItemInstance* AAeyerjiLootPickup::GiveLootToInventory(AAeyerjiPlayerCont
 {
 	if (!Controller || !GrantedItem)
 	{
-		AJ_LOG(this, TEXT("GiveLootToInventory failed - Controller=%s Item=%s"),
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, this, TEXT("GiveLootToInventory failed - Controller=%s Item=%s"),
 			*GetNameSafe(Controller),
 			GrantedItem ? *GrantedItem->GetName() : TEXT("NULL"));
 		return nullptr;
@@ -1371,14 +1426,14 @@ UAeyerjiItemInstance* AAeyerjiLootPickup::GiveLootToInventory(AAeyerjiPlayerCont
 	APawn* Pawn = Controller->GetPawn();
 	if (!Pawn)
 	{
-		AJ_LOG(this, TEXT("GiveLootToInventory failed - %s has no pawn"), *GetNameSafe(Controller));
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, this, TEXT("GiveLootToInventory failed - %s has no pawn"), *GetNameSafe(Controller));
 		return nullptr;
 	}
 
 	UAeyerjiInventoryComponent* Inventory = Pawn->FindComponentByClass<UAeyerjiInventoryComponent>();
 	if (!Inventory)
 	{
-		AJ_LOG(this, TEXT("GiveLootToInventory failed - pawn %s missing inventory component"), *GetNameSafe(Pawn));
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, this, TEXT("GiveLootToInventory failed - pawn %s missing inventory component"), *GetNameSafe(Pawn));
 		return nullptr;
 	}
 
@@ -1386,13 +1441,13 @@ UAeyerjiItemInstance* AAeyerjiLootPickup::GiveLootToInventory(AAeyerjiPlayerCont
 	UAeyerjiItemInstance* TransferItem = DuplicateObject<UAeyerjiItemInstance>(GrantedItem, Inventory, UniqueName);
 	if (!TransferItem)
 	{
-		AJ_LOG(this, TEXT("GiveLootToInventory failed - duplicate of %s could not be created"), *GetNameSafe(GrantedItem));
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, this, TEXT("GiveLootToInventory failed - duplicate of %s could not be created"), *GetNameSafe(GrantedItem));
 		return nullptr;
 	}
 
 	TransferItem->SetNetAddressable();
 	TransferItem->UniqueId = FGuid::NewGuid();
-	AJ_LOG(this, TEXT("GiveLootToInventory prepared duplicate %s (UniqueId=%s) for %s"),
+	AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("GiveLootToInventory prepared duplicate %s (UniqueId=%s) for %s"),
 		*TransferItem->GetPathName(),
 		*TransferItem->UniqueId.ToString(),
 		*GetNameSafe(Inventory));
@@ -1402,7 +1457,7 @@ UAeyerjiItemInstance* AAeyerjiLootPickup::GiveLootToInventory(AAeyerjiPlayerCont
 	const FString ResultName = ResultEnum
 		? ResultEnum->GetNameStringByValue(static_cast<int64>(Result))
 		: FString::Printf(TEXT("Value_%d"), static_cast<int32>(Result));
-	AJ_LOG(this, TEXT("GiveLootToInventory result for %s -> %s"),
+	AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("GiveLootToInventory result for %s -> %s"),
 		*GetNameSafe(Controller),
 		*ResultName);
 	if (Result == EAeyerjiAddItemResult::Equipped || Result == EAeyerjiAddItemResult::Bagged)
@@ -1444,17 +1499,17 @@ FAeyerjiPickupVisualConfig AAeyerjiLootPickup::ResolvePickupVisualConfig(const U
 	{
 		if (PickupVisualOverride.HasAnyVisuals())
 		{
-			AJ_LOG(this, TEXT("ResolvePickupVisualConfig: using actor override for %s"), *GetName());
+			AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ResolvePickupVisualConfig: using actor override for %s"), *GetName());
 			return PickupVisualOverride;
 		}
 
-		AJ_LOG(this, TEXT("ResolvePickupVisualConfig: override enabled on %s but no visuals configured"), *GetName());
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ResolvePickupVisualConfig: override enabled on %s but no visuals configured"), *GetName());
 	}
 
 	if (SourceInstance)
 	{
 		const FAeyerjiPickupVisualConfig FromInstance = SourceInstance->GetPickupVisualConfig();
-		AJ_LOG(this, TEXT("ResolvePickupVisualConfig: using item instance %s (Definition=%s, System=%s)"),
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ResolvePickupVisualConfig: using item instance %s (Definition=%s, System=%s)"),
 			*GetNameSafe(SourceInstance),
 			*GetNameSafe(SourceInstance->Definition),
 			*GetNameSafe(FromInstance.PickupGrantedSystem));
@@ -1463,13 +1518,13 @@ FAeyerjiPickupVisualConfig AAeyerjiLootPickup::ResolvePickupVisualConfig(const U
 
 	if (ItemDefinition)
 	{
-		AJ_LOG(this, TEXT("ResolvePickupVisualConfig: using fallback definition %s (System=%s)"),
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ResolvePickupVisualConfig: using fallback definition %s (System=%s)"),
 			*GetNameSafe(ItemDefinition),
 			*GetNameSafe(ItemDefinition->PickupVisuals.PickupGrantedSystem));
 		return ItemDefinition->PickupVisuals;
 	}
 
-	AJ_LOG(this, TEXT("ResolvePickupVisualConfig: no visuals configured"));
+	AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("ResolvePickupVisualConfig: no visuals configured"));
 	return FAeyerjiPickupVisualConfig();
 }
 
@@ -1477,24 +1532,24 @@ void AAeyerjiLootPickup::TriggerPickupFX(AAeyerjiPlayerController* Controller, c
 {
 	if (!Controller)
 	{
-		AJ_LOG(this, TEXT("TriggerPickupFX aborted - controller null"));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("TriggerPickupFX aborted - controller null"));
 		return;
 	}
 
 	APawn* Pawn = Controller->GetPawn();
 	if (!Pawn)
 	{
-		AJ_LOG(this, TEXT("TriggerPickupFX aborted - %s lacks pawn"), *GetNameSafe(Controller));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("TriggerPickupFX aborted - %s lacks pawn"), *GetNameSafe(Controller));
 		return;
 	}
 
 	if (!VisualConfig.HasPickupVisuals())
 	{
-		AJ_LOG(this, TEXT("TriggerPickupFX skipped - no pickup visuals configured"));
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("TriggerPickupFX skipped - no pickup visuals configured"));
 		return;
 	}
 
-	AJ_LOG(this, TEXT("TriggerPickupFX -> Pawn=%s System=%s"),
+	AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("TriggerPickupFX -> Pawn=%s System=%s"),
 		*GetNameSafe(Pawn),
 		*GetNameSafe(VisualConfig.PickupGrantedSystem));
 
@@ -1507,7 +1562,7 @@ void AAeyerjiLootPickup::Multicast_PlayPickupFX_Implementation(
 {
 	if (!FXTarget || !VisualConfig.HasPickupVisuals())
 	{
-		AJ_LOG(this, TEXT("Multicast_PlayPickupFX ignored - Target=%s PickupVisuals=%d"),
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("Multicast_PlayPickupFX ignored - Target=%s PickupVisuals=%d"),
 			*GetNameSafe(FXTarget),
 			VisualConfig.HasPickupVisuals() ? 1 : 0);
 		return;
@@ -1517,7 +1572,7 @@ void AAeyerjiLootPickup::Multicast_PlayPickupFX_Implementation(
 	{
 		if (UAeyerjiPickupFXComponent* PickupFX = Character->GetPickupFXComponent())
 		{
-			AJ_LOG(this, TEXT("Multicast_PlayPickupFX -> Character %s via component %s"),
+			AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("Multicast_PlayPickupFX -> Character %s via component %s"),
 				*GetNameSafe(Character),
 				*GetNameSafe(PickupFX));
 			PickupFX->PlayPickupFX(VisualConfig);
@@ -1527,14 +1582,14 @@ void AAeyerjiLootPickup::Multicast_PlayPickupFX_Implementation(
 
 	if (UAeyerjiPickupFXComponent* PickupFX = FXTarget->FindComponentByClass<UAeyerjiPickupFXComponent>())
 	{
-		AJ_LOG(this, TEXT("Multicast_PlayPickupFX -> Generic actor %s via component %s"),
+		AJ_LOG_CAT(LogAeyerjiLoot, Verbose, this, TEXT("Multicast_PlayPickupFX -> Generic actor %s via component %s"),
 			*GetNameSafe(FXTarget),
 			*GetNameSafe(PickupFX));
 		PickupFX->PlayPickupFX(VisualConfig);
 	}
 	else
 	{
-		AJ_LOG(this, TEXT("Multicast_PlayPickupFX failed - %s lacks pickup FX component"), *GetNameSafe(FXTarget));
+		AJ_LOG_CAT(LogAeyerjiLoot, Log, this, TEXT("Multicast_PlayPickupFX failed - %s lacks pickup FX component"), *GetNameSafe(FXTarget));
 	}
 }
 
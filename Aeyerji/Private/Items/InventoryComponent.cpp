@@ -1,6 +1,7 @@
 // InventoryComponent.cpp
 
 #include "Items/InventoryComponent.h"
+#include "Aeyerji/AeyerjiSaveGame.h"
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
@@ -23,6 +24,7 @@
 #include "TimerManager.h"
 #include "Containers/Set.h"
 #include "GameFramework/PlayerState.h"
+#include "Logging/AeyerjiStats.h"
 
 namespace
 {
@@ -143,12 +145,16 @@ UAeyerjiInventoryComponent::UAeyerjiInventoryComponent()
 	SetIsReplicatedByDefault(true);
 	ItemStatsEffectClass = UGE_ItemStats::StaticClass();
 	LootPickupClass = AAeyerjiLootPickup::StaticClass();
+	SaveRevision = UAeyerjiSaveGame::MakeSectionRevision();
 }
 
 void UAeyerjiInventoryComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	OnInventoryChanged.AddUniqueDynamic(this, &UAeyerjiInventoryComponent::HandleInventoryChangedForSave);
+	OnEquippedItemChanged.AddUniqueDynamic(this, &UAeyerjiInventoryComponent::HandleEquippedItemChangedForSave);
+
 	if (GetOwnerRole() == ROLE_Authority)
 	{
 		for (UAeyerjiItemInstance* Item : Items)
@@ -182,6 +188,8 @@ UAbilitySystemComponent* UAeyerjiInventoryComponent::GetASC() const
 
 bool UAeyerjiInventoryComponent::AddItemInstance(UAeyerjiItemInstance* Item, bool bSkipAutoPlacement)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_InventoryAdd);
+
 	if (GetOwnerRole() != ROLE_Authority)
 	{
 		return false;
@@ -192,7 +200,7 @@ bool UAeyerjiInventoryComponent::AddItemInstance(UAeyerjiItemInstance* Item, boo
 		return false;
 	}
 
-	UE_LOG(LogTemp, Display, TEXT("[Inventory][Server] AddItemInstance %s Outer=%s UniqueId=%s bSkipAutoPlacement=%d"),
+	UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory][Server] AddItemInstance %s Outer=%s UniqueId=%s bSkipAutoPlacement=%d"),
 		*GetNameSafe(Item),
 		*GetNameSafe(Item->GetOuter()),
 		Item->UniqueId.IsValid() ? *Item->UniqueId.ToString() : TEXT("Invalid"),
@@ -210,7 +218,7 @@ bool UAeyerjiInventoryComponent::AddItemInstance(UAeyerjiItemInstance* Item, boo
 	{
 		if (Item->GetOuter() != this)
 		{
-			UE_LOG(LogTemp, Display, TEXT("[Inventory][Server] Renaming %s from %s to %s"),
+			UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory][Server] Renaming %s from %s to %s"),
 				*GetNameSafe(Item),
 				*GetNameSafe(Item->GetOuter()),
 				*GetNameSafe(this));
@@ -220,7 +228,7 @@ bool UAeyerjiInventoryComponent::AddItemInstance(UAeyerjiItemInstance* Item, boo
 		Item->SetNetAddressable();
 		Items.Add(Item);
 		BindItemInstanceDelegates(Item);
-		UE_LOG(LogTemp, Display, TEXT("[Inventory][Server] Added %s Outer=%s UniqueId=%s Items=%d"),
+		UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory][Server] Added %s Outer=%s UniqueId=%s Items=%d"),
 			*GetNameSafe(Item),
 			*GetNameSafe(Item->GetOuter()),
 			Item->UniqueId.IsValid() ? *Item->UniqueId.ToString() : TEXT("Invalid"),
@@ -263,6 +271,8 @@ void UAeyerjiInventoryComponent::Server_AddItem_Implementation(UAeyerjiItemInsta
 
 void UAeyerjiInventoryComponent::Server_RemoveItemById_Implementation(const FGuid& ItemId)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_InventoryRemove);
+
 	const int32 InventoryIndex = Items.IndexOfByPredicate([&ItemId](const UAeyerjiItemInstance* Instance)
 	{
 		return Instance && Instance->UniqueId == ItemId;
@@ -418,6 +428,8 @@ void UAeyerjiInventoryComponent::PruneEmptyEquippedEntries()
 
 void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& ItemId, EEquipmentSlot Slot, int32 SlotIndex)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_InventoryEquip);
+
 	PruneEmptyEquippedEntries();
 
 	UAeyerjiItemInstance* Item = FindItemById(ItemId);
@@ -425,7 +437,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 	const EEquipmentSlot ResolvedSlot = ResolveEquipmentSlot(Slot, ItemDefinition);
 	const bool bSanitizedSlot = ResolvedSlot != Slot;
 
-	AJ_LOG(this, TEXT("Server_EquipItem ItemId=%s Slot=%d Index=%d%s"),
+	AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem ItemId=%s Slot=%d Index=%d%s"),
 		ItemId.IsValid() ? *ItemId.ToString() : TEXT("Invalid"),
 		static_cast<int32>(ResolvedSlot),
 		SlotIndex,
@@ -433,7 +445,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 
 	if (bSanitizedSlot && ItemDefinition && ItemDefinition->DefaultSlot != ResolvedSlot)
 	{
-		AJ_LOG(this, TEXT("Server_EquipItem sanitized slot request (Requested=%d Default=%d Category=%d). Verify ItemCategory/DefaultSlot match."),
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem sanitized slot request (Requested=%d Default=%d Category=%d). Verify ItemCategory/DefaultSlot match."),
 			static_cast<int32>(Slot),
 			static_cast<int32>(ItemDefinition->DefaultSlot),
 			static_cast<int32>(ItemDefinition->ItemCategory));
@@ -441,7 +453,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 
 	if (!Item || !Item->Definition)
 	{
-		AJ_LOG(this, TEXT("Server_EquipItem aborted: missing item or definition"));
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem aborted: missing item or definition"));
 		return;
 	}
 
@@ -449,7 +461,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 	const int32 ItemLevel = FMath::Max(1, Item->ItemLevel);
 	if (ItemLevel > OwnerLevel)
 	{
-		AJ_LOG(this, TEXT("Server_EquipItem rejected: item level %d exceeds owner level %d (%s)"),
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem rejected: item level %d exceeds owner level %d (%s)"),
 			ItemLevel,
 			OwnerLevel,
 			*GetNameSafe(Item));
@@ -460,7 +472,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 	{
 		if (!AddItemInstance(Item, true))
 		{
-			AJ_LOG(this, TEXT("Server_EquipItem failed: AddItemInstance rejected %s"), *Item->UniqueId.ToString());
+			AJ_LOG_CAT(LogAeyerjiInventory, Log, this, TEXT("Server_EquipItem failed: AddItemInstance rejected %s"), *Item->UniqueId.ToString());
 			return;
 		}
 	}
@@ -474,7 +486,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 
 	if (SlotIndex == INDEX_NONE)
 	{
-		AJ_LOG(this, TEXT("Server_EquipItem aborted: no free slot for %s in %d"), *Item->UniqueId.ToString(), static_cast<int32>(ResolvedSlot));
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem aborted: no free slot for %s in %d"), *Item->UniqueId.ToString(), static_cast<int32>(ResolvedSlot));
 		return;
 	}
 
@@ -484,7 +496,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 	{
 		if (!AutoPlaceItem(CurrentlyEquipped))
 		{
-			AJ_LOG(this, TEXT("Server_EquipItem failed: could not auto-place previous %s"), *CurrentlyEquipped->UniqueId.ToString());
+			AJ_LOG_CAT(LogAeyerjiInventory, Log, this, TEXT("Server_EquipItem failed: could not auto-place previous %s"), *CurrentlyEquipped->UniqueId.ToString());
 			return;
 		}
 
@@ -494,7 +506,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 		CurrentlyEquipped->EquippedSlotIndex = INDEX_NONE;
 
 		RemoveItemGameplayEffect(CurrentlyEquipped->UniqueId);
-		AJ_LOG(this, TEXT("Server_EquipItem unequipped %s from slot %d index %d"),
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem unequipped %s from slot %d index %d"),
 			*CurrentlyEquipped->UniqueId.ToString(),
 			static_cast<int32>(ResolvedSlot),
 			SlotIndex);
@@ -510,7 +522,7 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 	{
 		ExistingEntry->Item = Item;
 		ExistingEntry->ItemId = Item->UniqueId;
-		AJ_LOG(this, TEXT("Server_EquipItem updated slot entry for %s (index %d)"), *Item->UniqueId.ToString(), SlotIndex);
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem updated slot entry for %s (index %d)"), *Item->UniqueId.ToString(), SlotIndex);
 	}
 	else
 	{
@@ -520,17 +532,17 @@ void UAeyerjiInventoryComponent::Server_EquipItem_Implementation(const FGuid& It
 		NewEntry.ItemId = Item->UniqueId;
 		NewEntry.Item = Item;
 		EquippedItems.Add(NewEntry);
-		AJ_LOG(this, TEXT("Server_EquipItem added new slot entry for %s (index %d)"), *Item->UniqueId.ToString(), SlotIndex);
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem added new slot entry for %s (index %d)"), *Item->UniqueId.ToString(), SlotIndex);
 	}
 	MARK_PROPERTY_DIRTY_FROM_NAME(UAeyerjiInventoryComponent, EquippedItems, this);
 
 	ClearPlacement(Item->UniqueId);
-	AJ_LOG(this, TEXT("Server_EquipItem cleared placement for %s"), *Item->UniqueId.ToString());
+	AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem cleared placement for %s"), *Item->UniqueId.ToString());
 
 	ApplyItemGameplayEffect(Item);
 	OnEquippedItemChanged.Broadcast(ResolvedSlot, SlotIndex, Item);
 	BroadcastItemStateChange(EInventoryItemStateChange::Equipped, Item, ResolvedSlot, SlotIndex);
-	AJ_LOG(this, TEXT("Server_EquipItem completed equip for %s Slot=%d Index=%d"),
+	AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_EquipItem completed equip for %s Slot=%d Index=%d"),
 		*Item->UniqueId.ToString(),
 		static_cast<int32>(ResolvedSlot),
 		SlotIndex);
@@ -551,7 +563,7 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 {
 	if (!Item || !ItemStatsEffectClass)
 	{
-		AJ_LOG(this, TEXT("[ItemStatsDebug] ApplyItemGameplayEffect skipped Item=%s ItemStatsEffectClass=%s"),
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] ApplyItemGameplayEffect skipped Item=%s ItemStatsEffectClass=%s"),
 			*GetNameSafe(Item),
 			*GetNameSafe(ItemStatsEffectClass.Get()));
 		return;
@@ -562,7 +574,7 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 		const UGameplayEffect* StatsGECDO = ItemStatsEffectClass ? ItemStatsEffectClass->GetDefaultObject<UGameplayEffect>() : nullptr;
 		const int32 ExecCount = StatsGECDO ? StatsGECDO->Executions.Num() : 0;
 		const bool bTrackHandles = Multiplier > 0.f;
-		AJ_LOG(this, TEXT("[ItemStatsDebug] ApplyItemGameplayEffect begin Item=%s Def=%s Id=%s Mods=%d ASC=%s StatsGE=%s Execs=%d Mult=%.2f"),
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] ApplyItemGameplayEffect begin Item=%s Def=%s Id=%s Mods=%d ASC=%s StatsGE=%s Execs=%d Mult=%.2f"),
 			*GetNameSafe(Item),
 			*GetNameSafe(Item->Definition.Get()),
 			Item->UniqueId.IsValid() ? *Item->UniqueId.ToString() : TEXT("Invalid"),
@@ -596,7 +608,7 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 			const bool bHasAttrSet = bAttrValid ? ASC->HasAttributeSetForAttribute(Mod.Attribute) : false;
 			const float PreValue = (bAttrValid && bHasAttrSet) ? ASC->GetNumericAttribute(Mod.Attribute) : 0.f;
 			PreValues.Add(PreValue);
-			AJ_LOG(this, TEXT("[ItemStatsDebug] Mod[%d] Attr=%s Valid=%d Op=%d Mag=%.3f"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] Mod[%d] Attr=%s Valid=%d Op=%d Mag=%.3f"),
 				Index,
 				*Mod.Attribute.GetName(),
 				bAttrValid ? 1 : 0,
@@ -604,7 +616,7 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 				Mod.Magnitude);
 			if (bAttrValid)
 			{
-				AJ_LOG(this, TEXT("[ItemStatsDebug] Mod[%d] Attr=%s HasAttrSet=%d Pre=%.3f"),
+				AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] Mod[%d] Attr=%s HasAttrSet=%d Pre=%.3f"),
 					Index,
 					*Mod.Attribute.GetName(),
 					bHasAttrSet ? 1 : 0,
@@ -640,7 +652,7 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 				const bool bHasAttrSet = ASC->HasAttributeSetForAttribute(Mod.Attribute);
 				const float PostValue = bHasAttrSet ? ASC->GetNumericAttribute(Mod.Attribute) : 0.f;
 				const float PreValue = PreValues.IsValidIndex(Index) ? PreValues[Index] : 0.f;
-				AJ_LOG(this, TEXT("[ItemStatsDebug] Mod[%d] Attr=%s HasAttrSet=%d Pre=%.3f Post=%.3f Delta=%.3f"),
+				AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] Mod[%d] Attr=%s HasAttrSet=%d Pre=%.3f Post=%.3f Delta=%.3f"),
 					Index,
 					*Mod.Attribute.GetName(),
 					bHasAttrSet ? 1 : 0,
@@ -651,7 +663,7 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 		}
 		else
 		{
-			AJ_LOG(this, TEXT("[ItemStatsDebug] No valid modifiers found for Item=%s (Definition=%s)"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] No valid modifiers found for Item=%s (Definition=%s)"),
 				*GetNameSafe(Item),
 				*GetNameSafe(Item->Definition.Get()));
 		}
@@ -737,7 +749,7 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 			|| HandleSet.bAppliedItemStats))
 		{
 			ActiveEffectHandles.Add(Item->UniqueId, MoveTemp(HandleSet));
-			AJ_LOG(this, TEXT("[ItemStatsDebug] Applied handles Stats=%d Extra=%d Abilities=%d Tags=%d"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] Applied handles Stats=%d Extra=%d Abilities=%d Tags=%d"),
 				HandleSet.StatsHandle.IsValid() ? 1 : 0,
 				HandleSet.AdditionalHandles.Num(),
 				HandleSet.GrantedAbilityHandles.Num(),
@@ -745,12 +757,12 @@ void UAeyerjiInventoryComponent::ApplyItemGameplayEffect(UAeyerjiItemInstance* I
 		}
 		else
 		{
-			AJ_LOG(this, TEXT("[ItemStatsDebug] No handles created for Item=%s"), *GetNameSafe(Item));
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] No handles created for Item=%s"), *GetNameSafe(Item));
 		}
 	}
 	else
 	{
-		AJ_LOG(this, TEXT("[ItemStatsDebug] ApplyItemGameplayEffect skipped: ASC missing for Item=%s Owner=%s"),
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] ApplyItemGameplayEffect skipped: ASC missing for Item=%s Owner=%s"),
 			*GetNameSafe(Item),
 			*GetNameSafe(GetOwner()));
 	}
@@ -776,7 +788,7 @@ void UAeyerjiInventoryComponent::RemoveItemGameplayEffect(const FGuid& ItemId)
 				}
 				else
 				{
-					AJ_LOG(this, TEXT("[ItemStatsDebug] RemoveItemGameplayEffect could not find ItemId=%s for inverse apply"),
+					AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("[ItemStatsDebug] RemoveItemGameplayEffect could not find ItemId=%s for inverse apply"),
 						*ItemId.ToString());
 				}
 			}
@@ -1079,7 +1091,7 @@ void UAeyerjiInventoryComponent::Server_DropItem_Implementation(const FGuid& Ite
 	{
 		const FVector GroundedLocation = FindGroundedDropLocation(*World, WorldLocation);
 
-		AJ_LOG(this, TEXT("Server_DropItem dropping %s at %s (grounded %s) Rot=%s Class=%s"),
+		AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("Server_DropItem dropping %s at %s (grounded %s) Rot=%s Class=%s"),
 			*GetNameSafe(Item),
 			*WorldLocation.ToString(),
 			*GroundedLocation.ToString(),
@@ -1179,14 +1191,14 @@ int32 UAeyerjiInventoryComponent::DebugRefreshItemScaling(const UAeyerjiLootTabl
 		RebuildItemSnapshots();
 	}
 
-	AJ_LOG(this, TEXT("DebugRefreshItemScaling updated %d items"), UpdatedCount);
+	AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("DebugRefreshItemScaling updated %d items"), UpdatedCount);
 	return UpdatedCount;
 }
 
 void UAeyerjiInventoryComponent::OnRep_EquippedItems(const TArray<FEquippedItemEntry>& PreviousEquipped)
 {
 	ResolveEquippedItems();
-	AJ_LOG(this, TEXT("OnRep_EquippedItems Prev=%d New=%d"), PreviousEquipped.Num(), EquippedItems.Num());
+	AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("OnRep_EquippedItems Prev=%d New=%d"), PreviousEquipped.Num(), EquippedItems.Num());
 
 	auto MakeSlotKey = [](EEquipmentSlot Slot, int32 Index)
 	{
@@ -1229,13 +1241,13 @@ void UAeyerjiInventoryComponent::OnRep_EquippedItems(const TArray<FEquippedItemE
 
 void UAeyerjiInventoryComponent::OnRep_Items()
 {
-	UE_LOG(LogTemp, Display, TEXT("[Inventory] OnRep_Items count=%d"), Items.Num());
+	UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] OnRep_Items count=%d"), Items.Num());
 
 	for (TObjectPtr<UAeyerjiItemInstance>& Item : Items)
 	{
 		if (Item)
 		{
-			UE_LOG(LogTemp, Display, TEXT("[Inventory] OnRep_Items item %s (Id=%s) Outer=%s"),
+			UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] OnRep_Items item %s (Id=%s) Outer=%s"),
 				*Item->GetName(), *Item->UniqueId.ToString(), *GetNameSafe(Item->GetOuter()));
 			Item->ForceItemChangedForUI();
 		}
@@ -1247,20 +1259,20 @@ void UAeyerjiInventoryComponent::OnRep_Items()
 	{
 		if (Entry.Item)
 		{
-			AJ_LOG(this, TEXT("OnRep_Items resolved equipped slot %d -> %s"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("OnRep_Items resolved equipped slot %d -> %s"),
 				static_cast<int32>(Entry.Slot),
 				*Entry.Item->UniqueId.ToString());
 			OnEquippedItemChanged.Broadcast(Entry.Slot, Entry.SlotIndex, Entry.Item);
 		}
 		else if (Entry.ItemId.IsValid())
 		{
-			AJ_LOG(this, TEXT("OnRep_Items still missing item for slot %d id=%s"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("OnRep_Items still missing item for slot %d id=%s"),
 				static_cast<int32>(Entry.Slot),
 				*Entry.ItemId.ToString());
 		}
 		else
 		{
-			AJ_LOG(this, TEXT("OnRep_Items slot %d has no assignment"), static_cast<int32>(Entry.Slot));
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("OnRep_Items slot %d has no assignment"), static_cast<int32>(Entry.Slot));
 		}
 	}
 
@@ -1276,7 +1288,7 @@ void UAeyerjiInventoryComponent::OnRep_Items()
 
 void UAeyerjiInventoryComponent::OnRep_GridPlacements()
 {
-	UE_LOG(LogTemp, Display, TEXT("[Inventory] OnRep_GridPlacements count=%d"), GridPlacements.Num());
+	UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] OnRep_GridPlacements count=%d"), GridPlacements.Num());
 	if (SyncGridItemInstances())
 	{
 		OnInventoryChanged.Broadcast();
@@ -1294,7 +1306,7 @@ void UAeyerjiInventoryComponent::OnRep_ItemSnapshots()
 		return;
 	}
 
-	UE_LOG(LogTemp, Display, TEXT("[Inventory] OnRep_ItemSnapshots count=%d"), ItemSnapshots.Num());
+	UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] OnRep_ItemSnapshots count=%d"), ItemSnapshots.Num());
 	RefreshClientItemsFromSnapshots();
 	OnRep_Items();
 }
@@ -1459,17 +1471,17 @@ bool UAeyerjiInventoryComponent::SyncGridItemInstances()
 			if (!Placement.ItemInstance)
 			{
 				bAllResolved = false;
-				UE_LOG(LogTemp, Warning, TEXT("[Inventory] SyncGridItemInstances unresolved %s"), *Placement.ItemId.ToString());
+				UE_LOG(LogAeyerjiInventory, Warning, TEXT("[Inventory] SyncGridItemInstances unresolved %s"), *Placement.ItemId.ToString());
 			}
 			else
 			{
-				UE_LOG(LogTemp, Display, TEXT("[Inventory] SyncGridItemInstances resolved %s -> %s"),
+				UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] SyncGridItemInstances resolved %s -> %s"),
 					*Placement.ItemId.ToString(), *Placement.ItemInstance->GetName());
 			}
 		}
 	}
 
-	UE_LOG(LogTemp, Display, TEXT("[Inventory] SyncGridItemInstances %s (%d placements)"),
+	UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] SyncGridItemInstances %s (%d placements)"),
 		bAllResolved ? TEXT("complete") : TEXT("pending"), GridPlacements.Num());
 	return bAllResolved;
 }
@@ -1478,7 +1490,7 @@ bool UAeyerjiInventoryComponent::TryAutoPlaceItem(UAeyerjiItemInstance* Item)
 {
 	if (!Item || !Item->UniqueId.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[Inventory] TryAutoPlaceItem invalid item"));
+		UE_LOG(LogAeyerjiInventory, Warning, TEXT("[Inventory] TryAutoPlaceItem invalid item"));
 		return false;
 	}
 
@@ -1511,7 +1523,7 @@ bool UAeyerjiInventoryComponent::TryAutoPlaceItem(UAeyerjiItemInstance* Item)
 
 			if (CanPlaceAt(Candidate))
 			{
-				UE_LOG(LogTemp, Display, TEXT("[Inventory] Placing %s at (%d,%d) size (%d,%d)"),
+				UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] Placing %s at (%d,%d) size (%d,%d)"),
 					*Item->UniqueId.ToString(), X, Y, Size.X, Size.Y);
 				GridPlacements.Add(Candidate);
 				MARK_PROPERTY_DIRTY_FROM_NAME(UAeyerjiInventoryComponent, GridPlacements, this);
@@ -1562,7 +1574,7 @@ bool UAeyerjiInventoryComponent::CanPlaceAt(const FInventoryItemGridData& Placem
 
 		if (!(bSeparateX || bSeparateY))
 		{
-			UE_LOG(LogTemp, Display, TEXT("[Inventory] CanPlaceAt blocked by %s at (%d,%d) size (%d,%d)"),
+			UE_LOG(LogAeyerjiInventory, Verbose, TEXT("[Inventory] CanPlaceAt blocked by %s at (%d,%d) size (%d,%d)"),
 				*Existing.ItemId.ToString(), Existing.TopLeft.X, Existing.TopLeft.Y, Existing.Size.X, Existing.Size.Y);
 			return false;
 		}
@@ -1597,11 +1609,16 @@ void UAeyerjiInventoryComponent::HandleDeferredGridSync()
 
 void UAeyerjiInventoryComponent::RebuildItemSnapshots()
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_InventoryRebuildSnapshots);
+
 	if (GetOwnerRole() != ROLE_Authority)
 	{
 		return;
 	}
 
+	// Item stat refreshes land here without an inventory broadcast.
+	MarkSaveDirty();
+
 	ItemSnapshots.Reset();
 	ItemSnapshots.Reserve(Items.Num());
 
@@ -1641,7 +1658,7 @@ void UAeyerjiInventoryComponent::ResolveEquippedItems()
 		UAeyerjiItemInstance* const ResolvedItem = Entry.ItemId.IsValid() ? FindItemById(Entry.ItemId) : nullptr;
 		if (!ResolvedItem && Entry.ItemId.IsValid())
 		{
-			AJ_LOG(this, TEXT("ResolveEquippedItems unresolved ItemId=%s Slot=%d"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("ResolveEquippedItems unresolved ItemId=%s Slot=%d"),
 				*Entry.ItemId.ToString(),
 				static_cast<int32>(Entry.Slot));
 		}
@@ -1650,7 +1667,7 @@ void UAeyerjiInventoryComponent::ResolveEquippedItems()
 		const EEquipmentSlot SanitizedSlot = ResolveEquipmentSlot(Entry.Slot, Entry.Item ? Entry.Item->Definition.Get() : nullptr);
 		if (SanitizedSlot != Entry.Slot)
 		{
-			AJ_LOG(this, TEXT("ResolveEquippedItems sanitized slot %d -> %d for %s"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("ResolveEquippedItems sanitized slot %d -> %d for %s"),
 				static_cast<int32>(Entry.Slot),
 				static_cast<int32>(SanitizedSlot),
 				Entry.Item ? *Entry.Item->UniqueId.ToString() : TEXT("None"));
@@ -1660,7 +1677,7 @@ void UAeyerjiInventoryComponent::ResolveEquippedItems()
 		const int32 SanitizedIndex = SanitizeSlotIndex(Entry.SlotIndex);
 		if (SanitizedIndex != Entry.SlotIndex)
 		{
-			AJ_LOG(this, TEXT("ResolveEquippedItems sanitized slot index %d -> %d for %s"),
+			AJ_LOG_CAT(LogAeyerjiInventory, Verbose, this, TEXT("ResolveEquippedItems sanitized slot index %d -> %d for %s"),
 				Entry.SlotIndex,
 				SanitizedIndex,
 				Entry.Item ? *Entry.Item->UniqueId.ToString() : TEXT("None"));
@@ -1705,6 +1722,21 @@ void UAeyerjiInventoryComponent::UnbindItemInstanceDelegates(UAeyerjiItemInstanc
 	}
 }
 
+void UAeyerjiInventoryComponent::HandleInventoryChangedForSave()
+{
+	MarkSaveDirty();
+}
+
+void UAeyerjiInventoryComponent::HandleEquippedItemChangedForSave(EEquipmentSlot /*Slot*/, int32 /*SlotIndex*/, UAeyerjiItemInstance* /*Item*/)
+{
+	MarkSaveDirty();
+}
+
+void UAeyerjiInventoryComponent::MarkSaveDirty()
+{
+	SaveRevision = UAeyerjiSaveGame::MakeSectionRevision();
+}
+
 void UAeyerjiInventoryComponent::HandleServerItemStateChanged()
 {
 	RebuildItemSnapshots();
@@ -1883,6 +1915,8 @@ bool UAeyerjiInventoryComponent::TryPlaceItemAt(UAeyerjiItemInstance* Item, cons
 
 bool UAeyerjiInventoryComponent::UnequipSlotInternal(EEquipmentSlot Slot, int32 SlotIndex, const FIntPoint* PreferredTopLeft)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_InventoryUnequip);
+
 	SlotIndex = SanitizeSlotIndex(SlotIndex);
 	const int32 EntryIndex = EquippedItems.IndexOfByPredicate(
 		[Slot, SlotIndex](const FEquippedItemEntry& Entry)
@@ -1918,7 +1952,7 @@ bool UAeyerjiInventoryComponent::UnequipSlotInternal(EEquipmentSlot Slot, int32
 
 	if (!bPlaced)
 	{
-		AJ_LOG(this, TEXT("UnequipSlotInternal failed to place %s back into bag"), *EquippedItem->UniqueId.ToString());
+		AJ_LOG_CAT(LogAeyerjiInventory, Log, this, TEXT("UnequipSlotInternal failed to place %s back into bag"), *EquippedItem->UniqueId.ToString());
 		return false;
 	}
 
@@ -8,6 +8,7 @@
 #include "Systems/LootService.h"
 #include "Systems/LootTable.h"
 #include "UObject/Package.h"
+#include "Logging/AeyerjiStats.h"
 
 UAeyerjiItemInstance* UItemGenerator::RollItemInstance(
 	UObject* WorldContext,
@@ -17,6 +18,8 @@ UAeyerjiItemInstance* UItemGenerator::RollItemInstance(
 	int32 SeedOverride,
 	EEquipmentSlot SlotOverride)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_LootRollItemInstance);
+
 	if (!Definition)
 	{
 		return nullptr;
@@ -107,6 +110,8 @@ void UItemGenerator::ChooseAffixes(
 	TArray<UItemAffixDefinition*>& OutAffixes,
 	TArray<const FAffixTier*>& OutTiers)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_LootChooseAffixes);
+
 	OutAffixes.Reset();
 	OutTiers.Reset();
 
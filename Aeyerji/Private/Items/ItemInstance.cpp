@@ -5,6 +5,7 @@
 #include "Items/ItemAffixDefinition.h"
 #include "Items/ItemDefinition.h"
 #include "Items/InventoryComponent.h"
+#include "Logging/AeyerjiStats.h"
 #include "Net/UnrealNetwork.h"
 #include "Systems/LootService.h"
 #include "Systems/LootTable.h"
@@ -13,6 +14,23 @@
 UAeyerjiItemInstance::UAeyerjiItemInstance()
 {
 	SetFlags(RF_Transactional);
+
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		bCountedAsLive = true;
+		INC_DWORD_STAT(STAT_AJ_LiveItemInstances);
+	}
+}
+
+void UAeyerjiItemInstance::BeginDestroy()
+{
+	if (bCountedAsLive)
+	{
+		bCountedAsLive = false;
+		DEC_DWORD_STAT(STAT_AJ_LiveItemInstances);
+	}
+
+	Super::BeginDestroy();
 }
 
 void UAeyerjiItemInstance::NotifyItemChanged()
@@ -2,6 +2,7 @@
 
 #include "LevelDesign/CorridorSplineBuilder.h"   // <<— note the subfolder
 #include "Engine/StaticMesh.h"
+#include "Engine/World.h"
 
 ACorridorSplineBuilder::ACorridorSplineBuilder()
 {
@@ -15,9 +16,40 @@ ACorridorSplineBuilder::ACorridorSplineBuilder()
 
 void ACorridorSplineBuilder::OnConstruction(const FTransform& Transform)
 {
-	BuildCorridor(); // auto-update while editing
+#if WITH_EDITOR
+	// Construction reruns every frame while dragging; coalesce them and cut the spline off the game thread
+	const UWorld* World = GetWorld();
+	if (World && !World->IsGameWorld())
+	{
+		SegmentBuild.RequestBuild(this, MakeBuildInput(), [this](TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32> Changed)
+		{
+			CommitSegments(Segments, Changed);
+		});
+		return;
+	}
+#endif
+
+	BuildCorridor();
 }
 
+#if WITH_EDITOR
+void ACorridorSplineBuilder::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	// Mesh/axis/width/collision are not part of the segment diff, so re-apply every segment on the next commit.
+	// Must happen before Super, which reruns the construction script.
+	const FName MemberName = PropertyChangedEvent.GetMemberPropertyName();
+	if (MemberName == GET_MEMBER_NAME_CHECKED(ACorridorSplineBuilder, SegmentMesh)
+		|| MemberName == GET_MEMBER_NAME_CHECKED(ACorridorSplineBuilder, ForwardAxis)
+		|| MemberName == GET_MEMBER_NAME_CHECKED(ACorridorSplineBuilder, WidthScale)
+		|| MemberName == GET_MEMBER_NAME_CHECKED(ACorridorSplineBuilder, bCreateCollision))
+	{
+		SegmentBuild.ResetCommitted();
+	}
+
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+#endif
+
 void ACorridorSplineBuilder::ClearCorridor()
 {
 	for (USplineMeshComponent* C : GeneratedSegments)
@@ -25,6 +57,8 @@ void ACorridorSplineBuilder::ClearCorridor()
 		if (C) { C->DestroyComponent(); }
 	}
 	GeneratedSegments.Empty();
+	SegmentBuild.Cancel();
+	SegmentBuild.ResetCommitted();
 }
 
 void ACorridorSplineBuilder::GatherOrCreateSegments(int32 NumNeeded)
@@ -52,35 +86,46 @@ void ACorridorSplineBuilder::HideExtraSegments(int32 StartIndex)
 	}
 }
 
+FSplineSegmentBuildInput ACorridorSplineBuilder::MakeBuildInput() const
+{
+	FSplineSegmentBuildInput Input = FSplineSegmentBuildInput::FromSpline(*Spline);
+	Input.SegmentLength = FMath::Max(5.f, SegmentLength);
+	Input.bDistributeEvenly = true;
+	return Input;
+}
+
 void ACorridorSplineBuilder::BuildCorridor()
 {
-	if (!SegmentMesh || Spline->GetNumberOfSplinePoints() < 2)
+	// Explicit rebuilds re-apply every segment, not just the ones that moved
+	SegmentBuild.ResetCommitted();
+	SegmentBuild.BuildNow(MakeBuildInput(), [this](TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32> Changed)
+	{
+		CommitSegments(Segments, Changed);
+	});
+}
+
+void ACorridorSplineBuilder::CommitSegments(TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32> Changed)
+{
+	if (!SegmentMesh || Segments.Num() == 0)
 	{
 		HideExtraSegments(0);
+		SegmentBuild.ResetCommitted(); // nothing is shown, so the next commit must set everything up again
 		return;
 	}
 
-	const float TotalLen = Spline->GetSplineLength();
-	const int32 NumSegments = FMath::Max(1, FMath::CeilToInt(TotalLen / FMath::Max(5.f, SegmentLength)));
-	GatherOrCreateSegments(NumSegments);
+	GatherOrCreateSegments(Segments.Num());
 
-	int32 Built = 0;
-	for (int32 n = 0; n < NumSegments; ++n)
+	// Indices past the previous commit are always in Changed, so reused hidden pool entries get fully set up
+	for (const int32 n : Changed)
 	{
-		const float D0 = n * TotalLen / NumSegments;
-		const float D1 = (n + 1) * TotalLen / NumSegments;
-
-		const FVector P0 = Spline->GetLocationAtDistanceAlongSpline(D0, ESplineCoordinateSpace::Local);
-		const FVector P1 = Spline->GetLocationAtDistanceAlongSpline(D1, ESplineCoordinateSpace::Local);
-		const FVector T0 = Spline->GetTangentAtDistanceAlongSpline(D0, ESplineCoordinateSpace::Local);
-		const FVector T1 = Spline->GetTangentAtDistanceAlongSpline(D1, ESplineCoordinateSpace::Local);
+		const FSplineSegmentParams& Seg = Segments[n];
 
-		USplineMeshComponent* C = GeneratedSegments[Built++];
+		USplineMeshComponent* C = GeneratedSegments[n];
 		C->SetHiddenInGame(false);
 		C->SetVisibility(true, true);
 		C->SetStaticMesh(SegmentMesh);
 		C->SetForwardAxis(ForwardAxis, true);
-		C->SetStartAndEnd(P0, T0, P1, T1, true);
+		C->SetStartAndEnd(Seg.StartPos, Seg.StartTangent, Seg.EndPos, Seg.EndTangent, true);
 		C->SetStartScale(FVector2D(WidthScale, WidthScale));
 		C->SetEndScale  (FVector2D(WidthScale, WidthScale));
 		C->SetCollisionEnabled(bCreateCollision ? ECollisionEnabled::QueryAndPhysics
@@ -88,5 +133,5 @@ void ACorridorSplineBuilder::BuildCorridor()
 		C->SetGenerateOverlapEvents(bCreateCollision);
 	}
 
-	HideExtraSegments(Built);
+	HideExtraSegments(Segments.Num());
 }
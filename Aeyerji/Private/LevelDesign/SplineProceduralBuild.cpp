@@ -0,0 +1,330 @@
+// SplineProceduralBuild.cpp
+
+#include "LevelDesign/SplineProceduralBuild.h"
+
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Logging/AeyerjiLog.h"
+#include "Logging/AeyerjiStats.h"
+#include "Misc/AutomationTest.h"
+
+bool FSplineSegmentParams::Equals(const FSplineSegmentParams& Other, const float Tolerance) const
+{
+	return StartPos.Equals(Other.StartPos, Tolerance)
+		&& EndPos.Equals(Other.EndPos, Tolerance)
+		&& StartTangent.Equals(Other.StartTangent, Tolerance)
+		&& EndTangent.Equals(Other.EndTangent, Tolerance);
+}
+
+FSplineSegmentBuildInput FSplineSegmentBuildInput::FromSpline(const USplineComponent& Spline)
+{
+	check(IsInGameThread());
+
+	FSplineSegmentBuildInput Input;
+	Input.Curves = Spline.SplineCurves;
+	return Input;
+}
+
+void AeyerjiSplineBuild::ComputeSegments(const FSplineSegmentBuildInput& Input, TArray<FSplineSegmentParams>& OutSegments)
+{
+	OutSegments.Reset();
+
+	const FSplineCurves& Curves = Input.Curves;
+	if (Curves.Position.Points.Num() < 2 || Curves.ReparamTable.Points.Num() == 0 || Input.SegmentLength <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	const float SplineLength = Curves.GetSplineLength();
+	if (SplineLength <= KINDA_SMALL_NUMBER)
+	{
+		return;
+	}
+
+	// Same evaluation USplineComponent does for local-space location/tangent at a distance.
+	auto Sample = [&Curves, &Input](const float Distance, FVector& OutPos, FVector& OutTangent)
+	{
+		const float Param = Curves.ReparamTable.Eval(Distance, 0.f);
+		OutPos = Curves.Position.Eval(Param, FVector::ZeroVector) + Input.Offset;
+		OutTangent = Curves.Position.EvalDerivative(Param, FVector::ZeroVector);
+		if (!FMath::IsNearlyEqual(Input.TangentScale, 1.f))
+		{
+			OutTangent *= Input.TangentScale;
+		}
+	};
+
+	const int32 NumSteps = Input.bDistributeEvenly
+		? FMath::Max(1, FMath::CeilToInt(SplineLength / Input.SegmentLength))
+		: FMath::CeilToInt(SplineLength / Input.SegmentLength);
+	const float Step = Input.bDistributeEvenly ? SplineLength / NumSteps : Input.SegmentLength;
+
+	OutSegments.Reserve(NumSteps);
+	for (int32 Index = 0; Index < NumSteps; ++Index)
+	{
+		const float StartDistance = Index * Step;
+		const float EndDistance = FMath::Min(StartDistance + Step, SplineLength);
+
+		if (EndDistance <= StartDistance + KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		FSplineSegmentParams& Segment = OutSegments.AddDefaulted_GetRef();
+		Sample(StartDistance, Segment.StartPos, Segment.StartTangent);
+		Sample(EndDistance, Segment.EndPos, Segment.EndTangent);
+	}
+}
+
+void AeyerjiSplineBuild::DiffSegments(TConstArrayView<FSplineSegmentParams> Previous, TConstArrayView<FSplineSegmentParams> Next, TArray<int32>& OutChanged)
+{
+	OutChanged.Reset();
+
+	for (int32 Index = 0; Index < Next.Num(); ++Index)
+	{
+		if (!Previous.IsValidIndex(Index) || !Previous[Index].Equals(Next[Index]))
+		{
+			OutChanged.Add(Index);
+		}
+	}
+}
+
+FSplineProceduralBuild::~FSplineProceduralBuild()
+{
+	Cancel();
+}
+
+void FSplineProceduralBuild::RequestBuild(const UObject* Owner, FSplineSegmentBuildInput&& Input, FCommitFn&& Commit, const float DebounceSeconds)
+{
+	check(IsInGameThread());
+
+	WeakOwner = Owner;
+	PendingInput = MoveTemp(Input);
+	PendingCommit = MoveTemp(Commit);
+
+	if (DebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DebounceHandle);
+	}
+
+	// Editor worlds do not tick their timer managers, so debounce on the core ticker instead.
+	DebounceHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Owner = WeakOwner](float)
+	{
+		if (Owner.IsValid())
+		{
+			DebounceHandle.Reset();
+			LaunchPending();
+		}
+		return false;
+	}), FMath::Max(0.f, DebounceSeconds));
+}
+
+void FSplineProceduralBuild::LaunchPending()
+{
+	if (!PendingInput.IsSet() || !PendingCommit)
+	{
+		return;
+	}
+
+	const uint32 Generation = ++BuildGeneration;
+	bInFlight = true;
+
+	Async(EAsyncExecution::ThreadPool,
+		[this, Owner = WeakOwner, Generation, Input = MoveTemp(PendingInput.GetValue()), Commit = MoveTemp(PendingCommit)]() mutable
+		{
+			TArray<FSplineSegmentParams> Segments;
+			AeyerjiSplineBuild::ComputeSegments(Input, Segments);
+
+			AsyncTask(ENamedThreads::GameThread,
+				[this, Owner, Generation, Segments = MoveTemp(Segments), Commit = MoveTemp(Commit)]() mutable
+				{
+					// The builder lives inside Owner, so a live owner means a live builder.
+					if (IsValid(Owner.Get()))
+					{
+						CommitResult(Generation, MoveTemp(Segments), Commit);
+					}
+				});
+		});
+
+	PendingInput.Reset();
+	PendingCommit = nullptr;
+}
+
+void FSplineProceduralBuild::BuildNow(FSplineSegmentBuildInput&& Input, const FCommitFn& Commit)
+{
+	check(IsInGameThread());
+
+	Cancel();
+
+	TArray<FSplineSegmentParams> Segments;
+	AeyerjiSplineBuild::ComputeSegments(Input, Segments);
+	CommitResult(BuildGeneration, MoveTemp(Segments), Commit);
+}
+
+void FSplineProceduralBuild::Cancel()
+{
+	if (DebounceHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DebounceHandle);
+		DebounceHandle.Reset();
+	}
+
+	PendingInput.Reset();
+	PendingCommit = nullptr;
+	++BuildGeneration;
+	bInFlight = false;
+}
+
+void FSplineProceduralBuild::CommitResult(const uint32 Generation, TArray<FSplineSegmentParams>&& Segments, const FCommitFn& Commit)
+{
+	if (Generation != BuildGeneration)
+	{
+		return; // superseded by a newer request or cancelled
+	}
+
+	AJ_SCOPE_CYCLE(STAT_AJ_SplineBuildCommit);
+
+	bInFlight = false;
+
+	TArray<int32> Changed;
+	AeyerjiSplineBuild::DiffSegments(Committed, Segments, Changed);
+
+	Committed = MoveTemp(Segments);
+
+	if (Commit)
+	{
+		Commit(Committed, Changed);
+	}
+}
+
+namespace
+{
+	/** Wavy test spline with NumPoints points, 500 uu apart. */
+	void MakeBenchCurves(const int32 NumPoints, FSplineCurves& OutCurves)
+	{
+		OutCurves = FSplineCurves();
+		for (int32 Index = 0; Index < NumPoints; ++Index)
+		{
+			const float InVal = static_cast<float>(Index);
+			const FVector Location(Index * 500.f, FMath::Sin(Index * 0.35f) * 800.f, FMath::Cos(Index * 0.2f) * 150.f);
+			OutCurves.Position.Points.Emplace(InVal, Location, FVector::ZeroVector, FVector::ZeroVector, CIM_CurveAuto);
+			OutCurves.Rotation.Points.Emplace(InVal, FQuat::Identity, FQuat::Identity, FQuat::Identity, CIM_CurveAuto);
+			OutCurves.Scale.Points.Emplace(InVal, FVector::OneVector, FVector::ZeroVector, FVector::ZeroVector, CIM_CurveAuto);
+		}
+		OutCurves.UpdateSpline();
+	}
+
+	void RunSplineBuildBenchmark(const TArray<FString>& Args)
+	{
+		const int32 NumPoints = FMath::Max(2, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 2000);
+		const float SegmentLength = FMath::Max(1.f, Args.Num() > 1 ? FCString::Atof(*Args[1]) : 100.f);
+
+		FSplineSegmentBuildInput Input;
+		Input.SegmentLength = SegmentLength;
+
+		double Start = FPlatformTime::Seconds();
+		MakeBenchCurves(NumPoints, Input.Curves);
+		const double CurveSeconds = FPlatformTime::Seconds() - Start;
+
+		TArray<FSplineSegmentParams> Full;
+		Start = FPlatformTime::Seconds();
+		AeyerjiSplineBuild::ComputeSegments(Input, Full);
+		const double FullSeconds = FPlatformTime::Seconds() - Start;
+
+		// Nudge one point three quarters along, as an editor drag would, then rebuild and diff against the first pass.
+		const int32 MovedPoint = (NumPoints * 3) / 4;
+		Input.Curves.Position.Points[MovedPoint].OutVal.Z += 200.f;
+		Input.Curves.UpdateSpline();
+
+		TArray<FSplineSegmentParams> Edited;
+		TArray<int32> Changed;
+		Start = FPlatformTime::Seconds();
+		AeyerjiSplineBuild::ComputeSegments(Input, Edited);
+		AeyerjiSplineBuild::DiffSegments(Full, Edited, Changed);
+		const double EditSeconds = FPlatformTime::Seconds() - Start;
+
+		UE_LOG(LogAeyerji, Display,
+			TEXT("SplineBuild bench: %d points, %.0f uu pieces | curves %.3f ms | full cut %d segments %.3f ms | edit+diff %.3f ms, %d/%d segments to commit (first %d)"),
+			NumPoints, SegmentLength,
+			CurveSeconds * 1000.0,
+			Full.Num(), FullSeconds * 1000.0,
+			EditSeconds * 1000.0, Changed.Num(), Edited.Num(), Changed.Num() > 0 ? Changed[0] : INDEX_NONE);
+	}
+
+	FAutoConsoleCommand GSplineBuildBenchCommand(
+		TEXT("aeyerji.LevelDesign.BenchSplineBuild"),
+		TEXT("Times cutting a large synthetic spline into segments and an incremental re-cut after moving one point. Args: [NumPoints=2000] [SegmentLength=100]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunSplineBuildBenchmark));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeyerjiSplineBuildTest, "Aeyerji.LevelDesign.SplineBuild",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAeyerjiSplineBuildTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumPoints = 2000;
+
+	FSplineSegmentBuildInput Input;
+	Input.SegmentLength = 100.f;
+	MakeBenchCurves(NumPoints, Input.Curves);
+	const float SplineLength = Input.Curves.GetSplineLength();
+
+	// Fixed-length pieces: every full piece plus a shorter last one, end to end.
+	TArray<FSplineSegmentParams> Full;
+	const double Start = FPlatformTime::Seconds();
+	AeyerjiSplineBuild::ComputeSegments(Input, Full);
+	const double FullSeconds = FPlatformTime::Seconds() - Start;
+
+	TestEqual(TEXT("Fixed-length segment count"), Full.Num(), FMath::CeilToInt(SplineLength / Input.SegmentLength));
+	// Reported only; wall-clock time depends on the agent's load. aeyerji.LevelDesign.BenchSplineBuild is the benchmark.
+	AddInfo(FString::Printf(TEXT("Full cut of %d points into %d segments took %.3f ms"), NumPoints, Full.Num(), FullSeconds * 1000.0));
+	for (int32 Index = 1; Index < Full.Num(); ++Index)
+	{
+		if (!Full[Index - 1].EndPos.Equals(Full[Index].StartPos, 0.01f))
+		{
+			AddError(FString::Printf(TEXT("Segment %d does not start where %d ends"), Index, Index - 1));
+			break;
+		}
+	}
+
+	// Identical input diffs to nothing; a shorter previous build reports every index it lacks.
+	TArray<int32> Changed;
+	AeyerjiSplineBuild::DiffSegments(Full, Full, Changed);
+	TestEqual(TEXT("Unchanged rebuild reports no segments"), Changed.Num(), 0);
+
+	AeyerjiSplineBuild::DiffSegments(TConstArrayView<FSplineSegmentParams>(Full).Left(Full.Num() - 3), Full, Changed);
+	TestTrue(TEXT("Appended segments are reported"), Changed == TArray<int32>{Full.Num() - 3, Full.Num() - 2, Full.Num() - 1});
+
+	// Moving a point three quarters along leaves the pieces before it alone and shifts everything after it.
+	Input.Curves.Position.Points[(NumPoints * 3) / 4].OutVal.Z += 200.f;
+	Input.Curves.UpdateSpline();
+
+	TArray<FSplineSegmentParams> Edited;
+	AeyerjiSplineBuild::ComputeSegments(Input, Edited);
+	AeyerjiSplineBuild::DiffSegments(Full, Edited, Changed);
+
+	if (TestTrue(TEXT("Edit reports changed segments"), Changed.Num() > 0))
+	{
+		TestTrue(TEXT("Segments before the edit are kept"), Changed[0] >= Edited.Num() / 2);
+		TestEqual(TEXT("Changed segments form the tail"), Changed.Num(), Edited.Num() - Changed[0]);
+	}
+
+	// Even distribution: rounded-up count sharing the length, last piece ending on the spline end.
+	Input.bDistributeEvenly = true;
+	TArray<FSplineSegmentParams> Even;
+	AeyerjiSplineBuild::ComputeSegments(Input, Even);
+
+	const float EditedLength = Input.Curves.GetSplineLength();
+	TestEqual(TEXT("Even segment count"), Even.Num(), FMath::CeilToInt(EditedLength / Input.SegmentLength));
+	if (Even.Num() > 0)
+	{
+		const FVector SplineEnd = Input.Curves.Position.Points.Last().OutVal;
+		TestTrue(TEXT("Last even segment ends on the spline end"), Even.Last().EndPos.Equals(SplineEnd, 1.f));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,4 +4,58 @@
 #include "Logging/AeyerjiLog.h"
 // ───────────────────────────────── AeyerjiLog.cpp ──────────────────────────────
 
+#include "HAL/IConsoleManager.h"
+#include "CoreGlobals.h"
+
 DEFINE_LOG_CATEGORY(LogAeyerji);
+DEFINE_LOG_CATEGORY(LogAeyerjiLoot);
+DEFINE_LOG_CATEGORY(LogAeyerjiInventory);
+DEFINE_LOG_CATEGORY(LogAeyerjiUI);
+
+namespace
+{
+	static TAutoConsoleVariable<int32>& GetLogFrameBudgetCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Log.FrameBudgetPerSite"),
+			3,
+			TEXT("Max messages per frame from one AJ_LOG_THROTTLED call site; the rest are collapsed into a counter. 0 = unlimited."),
+			ECVF_Default);
+		return *CVar;
+	}
+}
+
+bool Aeyerji::Detail::ConsumeLogBudget(FLogThrottle& Throttle, int32& OutCollapsed)
+{
+	OutCollapsed = 0;
+
+	// Call-site state is only safe to touch from one thread; worker-thread logs pass straight through.
+	if (!IsInGameThread())
+	{
+		return true;
+	}
+
+	const int32 Budget = GetLogFrameBudgetCVar().GetValueOnGameThread();
+	if (Budget <= 0)
+	{
+		return true;
+	}
+
+	if (Throttle.Frame != GFrameCounter)
+	{
+		Throttle.Frame = GFrameCounter;
+		Throttle.EmittedThisFrame = 0;
+	}
+
+	if (Throttle.EmittedThisFrame >= Budget)
+	{
+		++Throttle.Collapsed;
+		return false;
+	}
+
+	++Throttle.EmittedThisFrame;
+	OutCollapsed = Throttle.Collapsed;
+	Throttle.Collapsed = 0;
+	return true;
+}
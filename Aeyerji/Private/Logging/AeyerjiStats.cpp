@@ -0,0 +1,37 @@
+#include "Logging/AeyerjiStats.h"
+// ───────────────────────────────── AeyerjiStats.cpp ──────────────────────────────
+
+DEFINE_STAT(STAT_AJ_DirectorTick);
+DEFINE_STAT(STAT_AJ_ProcessSpawnQueue);
+DEFINE_STAT(STAT_AJ_UpdateEnemyLOD);
+DEFINE_STAT(STAT_AJ_CleanupInactiveEnemies);
+DEFINE_STAT(STAT_AJ_ApplyArchetype);
+
+DEFINE_STAT(STAT_AJ_LootRoll);
+DEFINE_STAT(STAT_AJ_LootRollMultiDrop);
+DEFINE_STAT(STAT_AJ_LootRollItemInstance);
+DEFINE_STAT(STAT_AJ_LootChooseAffixes);
+
+DEFINE_STAT(STAT_AJ_InventoryAdd);
+DEFINE_STAT(STAT_AJ_InventoryRemove);
+DEFINE_STAT(STAT_AJ_InventoryEquip);
+DEFINE_STAT(STAT_AJ_InventoryUnequip);
+DEFINE_STAT(STAT_AJ_InventoryRebuildSnapshots);
+
+DEFINE_STAT(STAT_AJ_CursorTrace);
+DEFINE_STAT(STAT_AJ_MouseNavContext);
+
+DEFINE_STAT(STAT_AJ_MeleeSweep);
+DEFINE_STAT(STAT_AJ_DeathPresentation);
+DEFINE_STAT(STAT_AJ_ElitePresentation);
+DEFINE_STAT(STAT_AJ_OcclusionSweep);
+
+DEFINE_STAT(STAT_AJ_StateTreeTask);
+DEFINE_STAT(STAT_AJ_StateTreeCondition);
+
+DEFINE_STAT(STAT_AJ_NeonFlicker);
+DEFINE_STAT(STAT_AJ_SplineBuildCommit);
+
+DEFINE_STAT(STAT_AJ_LivePickups);
+DEFINE_STAT(STAT_AJ_LiveProjectiles);
+DEFINE_STAT(STAT_AJ_LiveItemInstances);
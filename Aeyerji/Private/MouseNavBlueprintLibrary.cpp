@@ -11,6 +11,8 @@
 #include "CollisionShape.h"
 #include "CollisionQueryParams.h"
 #include "NavigationPath.h"
+#include "Systems/AeyerjiNavProjectionCache.h"
+#include "Logging/AeyerjiStats.h"
 
 EMouseNavResult UMouseNavBlueprintLibrary::GetMouseNavContext(
 		const UObject*      WorldContextObject,
@@ -19,6 +21,8 @@ EMouseNavResult UMouseNavBlueprintLibrary::GetMouseNavContext(
 		FVector&            OutCursorLocation,
 		APawn*&             OutPawn)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_MouseNavContext);
+
 	OutNavLocation = FVector::ZeroVector;
 	OutCursorLocation = FVector::ZeroVector;
 	OutPawn = nullptr;
@@ -157,14 +161,14 @@ EMouseNavResult UMouseNavBlueprintLibrary::GetMouseNavContext(
 		return EMouseNavResult::None;
 	}
 
-	FNavLocation Projected;
+	FVector Projected;
 	constexpr float ExtentXY = 50.f;
 	constexpr float ExtentZ = 200.f;
 
-	if (NavSys->ProjectPointToNavigation(
-			DesiredPoint, Projected, FVector(ExtentXY, ExtentXY, ExtentZ)))
+	if (UAeyerjiNavProjectionCache::ProjectPoint(
+			PlayerController, DesiredPoint, FVector(ExtentXY, ExtentXY, ExtentZ), Projected))
 	{
-		OutNavLocation = Projected.Location;
+		OutNavLocation = Projected;
 
 #if WITH_EDITOR
 		DrawDebugSphere(PlayerController->GetWorld(), OutNavLocation,
@@ -223,7 +227,7 @@ bool UMouseNavBlueprintLibrary::GetClosestNavigableLocationInRange(
 		TargetPoint = OriginLocation + Direction.GetSafeNormal() * ClampedRange;
 	}
 
-	FNavLocation Projected;
+	FVector Projected;
 	bool bHasCandidate = false;
 
 	if (bStraightLine)
@@ -235,9 +239,9 @@ bool UMouseNavBlueprintLibrary::GetClosestNavigableLocationInRange(
 
 		if (StepDirection.IsNearlyZero() || TravelDistance <= KINDA_SMALL_NUMBER)
 		{
-			if (NavSys->ProjectPointToNavigation(OriginLocation, Projected, NavProjectionExtent))
+			if (UAeyerjiNavProjectionCache::ProjectPoint(World, OriginLocation, NavProjectionExtent, Projected))
 			{
-				OutNavLocation = Projected.Location;
+				OutNavLocation = Projected;
 				bHasCandidate = true;
 			}
 		}
@@ -250,22 +254,22 @@ bool UMouseNavBlueprintLibrary::GetClosestNavigableLocationInRange(
 			while (Traversed <= TravelDistance)
 			{
 				const FVector Sample = OriginLocation + StepDirection * Traversed;
-				if (NavSys->ProjectPointToNavigation(Sample, Projected, NavProjectionExtent))
+				if (UAeyerjiNavProjectionCache::ProjectPoint(World, Sample, NavProjectionExtent, Projected))
 				{
-					FurthestValid = Projected.Location;
+					FurthestValid = Projected;
 					bHasCandidate = true;
 				}
 
 				Traversed += StepSize;
 			}
 
-			if (NavSys->ProjectPointToNavigation(TargetPoint, Projected, NavProjectionExtent))
+			if (UAeyerjiNavProjectionCache::ProjectPoint(World, TargetPoint, NavProjectionExtent, Projected))
 			{
 				if (!bHasCandidate ||
-				    FVector::DistSquared(OriginLocation, Projected.Location) >
+				    FVector::DistSquared(OriginLocation, Projected) >
 				    FVector::DistSquared(OriginLocation, FurthestValid))
 				{
-					FurthestValid = Projected.Location;
+					FurthestValid = Projected;
 					bHasCandidate = true;
 				}
 			}
@@ -307,9 +311,9 @@ bool UMouseNavBlueprintLibrary::GetClosestNavigableLocationInRange(
 				Last = Next;
 			}
 
-			if (NavSys->ProjectPointToNavigation(OutNavLocation, Projected, NavProjectionExtent))
+			if (UAeyerjiNavProjectionCache::ProjectPoint(World, OutNavLocation, NavProjectionExtent, Projected))
 			{
-				OutNavLocation = Projected.Location;
+				OutNavLocation = Projected;
 			}
 			else
 			{
@@ -320,12 +324,12 @@ bool UMouseNavBlueprintLibrary::GetClosestNavigableLocationInRange(
 
 	if (!bHasCandidate)
 	{
-		if (!NavSys->ProjectPointToNavigation(TargetPoint, Projected, NavProjectionExtent))
+		if (!UAeyerjiNavProjectionCache::ProjectPoint(World, TargetPoint, NavProjectionExtent, Projected))
 		{
 			return false;
 		}
 
-		OutNavLocation = Projected.Location;
+		OutNavLocation = Projected;
 	}
 
 	if (ClampedRange > 0.f)
@@ -335,9 +339,9 @@ bool UMouseNavBlueprintLibrary::GetClosestNavigableLocationInRange(
 		if (Dist > ClampedRange && FromOrigin.GetSafeNormal().IsNearlyZero() == false)
 		{
 			const FVector Adjusted = OriginLocation + FromOrigin.GetSafeNormal() * ClampedRange;
-			if (NavSys->ProjectPointToNavigation(Adjusted, Projected, NavProjectionExtent))
+			if (UAeyerjiNavProjectionCache::ProjectPoint(World, Adjusted, NavProjectionExtent, Projected))
 			{
-				OutNavLocation = Projected.Location;
+				OutNavLocation = Projected;
 			}
 			else
 			{
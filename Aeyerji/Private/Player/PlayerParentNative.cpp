@@ -31,6 +31,10 @@
 
 #include "Player/PlayerPathAIController.h"
 
+#include "Systems/AeyerjiSaveService.h"
+
+#include "Systems/AeyerjiServerTelemetry.h"
+
 static const FName RHandSocket(TEXT("WeaponRHandSocket"));
 
 APlayerParentNative::APlayerParentNative()
@@ -493,6 +497,10 @@ void APlayerParentNative::InitAbilityActorInfo()
 
   AbilitySystemAeyerji->InitAbilityActorInfo(this, this);
 
+  if (UAeyerjiServerTelemetry *Telemetry = UAeyerjiServerTelemetry::Get(this)) {
+    Telemetry->RegisterAbilitySystem(AbilitySystemAeyerji);
+  }
+
   // Ensure the AttributeSet instance exists so downstream code (load/leveling)
 
   // can read/write attributes immediately.
@@ -692,68 +700,94 @@ void APlayerParentNative::Server_RequestLoadCharacter_Implementation()
     return;
   }
 
+  if (bServerSaveLoadInFlight)
+  {
+    return;
+  }
+
   const FString Slot =
 
       UCharacterStatsLibrary::MakeStableCharSlotName(GetPlayerState());
 
-  bool bLoadedOK = false;
+  UAeyerjiSaveService *SaveService = UAeyerjiSaveService::Get();
 
-  if (AAeyerjiPlayerState *PS = GetPlayerState<AAeyerjiPlayerState>())
+  if (!SaveService || Slot.IsEmpty())
 
   {
 
     bool bLoadedExisting = false;
-    if (UAeyerjiSaveGame *Data = UCharacterStatsLibrary::LoadOrCreateAeyerjiSave(Slot, bLoadedExisting))
+    ApplyLoadedCharacter(Slot, UCharacterStatsLibrary::LoadOrCreateAeyerjiSave(Slot, bLoadedExisting), bLoadedExisting);
+    return;
+  }
 
-    {
+  // Reading and decompressing the slot happens off the game thread; the character is applied once it arrives.
+  bServerSaveLoadInFlight = true;
+  SaveService->RequestLoad(Slot, UAeyerjiSaveService::FOnSaveLoadedNative::CreateWeakLambda(this,
+      [this, Slot](UAeyerjiSaveGame *Loaded)
+      {
+        bServerSaveLoadInFlight = false;
+        const bool bLoadedExisting = Loaded != nullptr;
+        ApplyLoadedCharacter(Slot, bLoadedExisting ? Loaded : UCharacterStatsLibrary::CreateAeyerjiSave(Slot), bLoadedExisting);
+      }));
+}
 
-      if (AbilitySystemAeyerji)
+void APlayerParentNative::ApplyLoadedCharacter(const FString &Slot, UAeyerjiSaveGame *Data, bool bLoadedExisting)
 
-      {
-        UE_LOG(LogTemp, Display,
-               TEXT("Server_RequestLoadCharacter: Slot=%s Existing=%d PreResetXP=%f PreResetLevel=%d"),
-               *Slot, bLoadedExisting, Data->Attributes.XP, Data->Attributes.Level);
+{
 
-        if (!bLoadedExisting)
-        {
-          // Brand-new slot: ensure the save data starts from clean defaults
-          Data->ActionBar.Reset();
-          Data->Attributes = FAttrSnapshot();
-          Data->Attributes.Level = FMath::Max(1, StartLevelOnBeginPlay);
-
-          UE_LOG(LogTemp, Display,
-                 TEXT("Server_RequestLoadCharacter: Slot=%s newly created -> initializing XP=0 Level=%d"),
-                 *Slot, Data->Attributes.Level);
-        }
+  bool bLoadedOK = false;
 
-        // Always load from the save object so fresh slots use their defaults
-        UCharacterStatsLibrary::LoadAeyerjiChar(Data, PS, AbilitySystemAeyerji);
+  AAeyerjiPlayerState *PS = GetPlayerState<AAeyerjiPlayerState>();
 
-        if (const UAeyerjiAttributeSet *AttrSet = AbilitySystemAeyerji->GetSet<UAeyerjiAttributeSet>())
-        {
-          UE_LOG(LogTemp, Display,
-                 TEXT("Server_RequestLoadCharacter: Slot=%s post-load ASC XP=%f Level=%f"),
-                 *Slot, AttrSet->GetXP(), AttrSet->GetLevel());
-        }
+  if (PS && Data)
 
-        if (!bLoadedExisting)
-        {
-          // Persist the freshly initialized defaults to disk for brand new slots
-          UCharacterStatsLibrary::SaveAeyerjiChar(Data, PS, Slot);
-        }
+  {
+
+    if (AbilitySystemAeyerji)
 
-        bLoadedOK = true;
+    {
+      UE_LOG(LogTemp, Display,
+             TEXT("Server_RequestLoadCharacter: Slot=%s Existing=%d PreResetXP=%f PreResetLevel=%d"),
+             *Slot, bLoadedExisting, Data->Attributes.XP, Data->Attributes.Level);
 
+      if (!bLoadedExisting)
+      {
+        // Brand-new slot: ensure the save data starts from clean defaults
+        Data->ActionBar.Reset();
+        Data->Attributes = FAttrSnapshot();
+        Data->Attributes.Level = FMath::Max(1, StartLevelOnBeginPlay);
+
+        UE_LOG(LogTemp, Display,
+               TEXT("Server_RequestLoadCharacter: Slot=%s newly created -> initializing XP=0 Level=%d"),
+               *Slot, Data->Attributes.Level);
       }
 
-      else
+      // Always load from the save object so fresh slots use their defaults
+      UCharacterStatsLibrary::LoadAeyerjiChar(Data, PS, AbilitySystemAeyerji);
 
+      if (const UAeyerjiAttributeSet *AttrSet = AbilitySystemAeyerji->GetSet<UAeyerjiAttributeSet>())
       {
+        UE_LOG(LogTemp, Display,
+               TEXT("Server_RequestLoadCharacter: Slot=%s post-load ASC XP=%f Level=%f"),
+               *Slot, AttrSet->GetXP(), AttrSet->GetLevel());
+      }
 
-        UE_LOG(LogTemp, Warning, TEXT("Server_RequestLoadCharacter: AbilitySystemAeyerji is null for slot %s"), *Slot);
-
+      if (!bLoadedExisting)
+      {
+        // Persist the freshly initialized defaults to disk for brand new slots
+        UCharacterStatsLibrary::SaveAeyerjiChar(Data, PS, Slot);
       }
 
+      bLoadedOK = true;
+
+    }
+
+    else
+
+    {
+
+      UE_LOG(LogTemp, Warning, TEXT("Server_RequestLoadCharacter: AbilitySystemAeyerji is null for slot %s"), *Slot);
+
     }
 
   }
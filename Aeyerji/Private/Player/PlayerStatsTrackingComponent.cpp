@@ -2,12 +2,14 @@
 
 #include "Player/PlayerStatsTrackingComponent.h"
 
+#include "Aeyerji/AeyerjiSaveGame.h"
 #include "Items/ItemDefinition.h"
 #include "Items/LootTypes.h"
 
 UPlayerStatsTrackingComponent::UPlayerStatsTrackingComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
+	SaveRevision = UAeyerjiSaveGame::MakeSectionRevision();
 }
 
 void UPlayerStatsTrackingComponent::BeginPlay()
@@ -18,6 +20,7 @@ void UPlayerStatsTrackingComponent::BeginPlay()
 void UPlayerStatsTrackingComponent::LoadLootStats(const FPlayerLootStats& InStats)
 {
 	LootStats = InStats;
+	MarkSaveDirty();
 }
 
 void UPlayerStatsTrackingComponent::ExtractLootStats(FPlayerLootStats& OutStats) const
@@ -38,6 +41,7 @@ bool UPlayerStatsTrackingComponent::HasPickedUpItemId(FName ItemId) const
 
 void UPlayerStatsTrackingComponent::RecordItemDropped(const FLootDropResult& Result)
 {
+	MarkSaveDirty();
 	TrackDropRarity(Result.Rarity);
 
 	if (FPlayerLootStats::IsLegendaryRarity(Result.Rarity))
@@ -55,6 +59,7 @@ void UPlayerStatsTrackingComponent::RecordItemDropped(const FLootDropResult& Res
 
 void UPlayerStatsTrackingComponent::RecordItemPickedUp(const UItemDefinition* ItemDef, EItemRarity Rarity)
 {
+	MarkSaveDirty();
 	TrackPickupRarity(Rarity);
 
 	if (FPlayerLootStats::IsLegendaryRarity(Rarity))
@@ -91,3 +96,8 @@ void UPlayerStatsTrackingComponent::UpdateLegendaryRollingWindow(bool bLegendary
 {
 	LootStats.AppendRollingEntry(bLegendaryDrop);
 }
+
+void UPlayerStatsTrackingComponent::MarkSaveDirty()
+{
+	SaveRevision = UAeyerjiSaveGame::MakeSectionRevision();
+}
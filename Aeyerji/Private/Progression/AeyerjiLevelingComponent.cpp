@@ -7,6 +7,7 @@
 
 #include "Engine/CurveTable.h"           // FCurveTableRowHandle (5.6)
 #include "GameFramework/Actor.h"
+#include "TimerManager.h"
 
 #include "Attributes/AeyerjiAttributeSet.h"
 
@@ -84,8 +85,7 @@ void UAeyerjiLevelingComponent::AddXP(float DeltaXP)
 
     if (bLeveled)
     {
-        RefreshOwnedAbilities();
-        ReapplyInfiniteEffects();
+        QueueLevelRefresh();
         OnLevelUp.Broadcast(OldLevel, Level);
     }
 }
@@ -114,8 +114,7 @@ void UAeyerjiLevelingComponent::SetLevel(int32 NewLevel)
         }
     }
 
-    RefreshOwnedAbilities();
-    ReapplyInfiniteEffects();
+    QueueLevelRefresh();
 
     OnLevelUp.Broadcast(OldLevel, NewLevel);
 }
@@ -209,13 +208,37 @@ void UAeyerjiLevelingComponent::TryProcessLevelUps()
         ServerSetXPMax(XPMax);
         ServerSetXP(FMath::Clamp(XP, 0.f, XPMax));
 
-        RefreshOwnedAbilities();
-        ReapplyInfiniteEffects();
+        QueueLevelRefresh();
 
         OnLevelUp.Broadcast(OldLevel, Level);
     }
 }
 
+void UAeyerjiLevelingComponent::QueueLevelRefresh()
+{
+    if (bLevelRefreshQueued)
+    {
+        return;
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        bLevelRefreshQueued = true;
+        World->GetTimerManager().SetTimerForNextTick(this, &UAeyerjiLevelingComponent::FlushLevelRefresh);
+    }
+    else
+    {
+        FlushLevelRefresh();
+    }
+}
+
+void UAeyerjiLevelingComponent::FlushLevelRefresh()
+{
+    bLevelRefreshQueued = false;
+    RefreshOwnedAbilities();
+    ReapplyInfiniteEffects();
+}
+
 void UAeyerjiLevelingComponent::RefreshOwnedAbilities() const
 {
     UAbilitySystemComponent* ASC         = GetASC();
@@ -224,28 +247,59 @@ void UAeyerjiLevelingComponent::RefreshOwnedAbilities() const
 
     const int32 CurrentLevel = FMath::RoundToInt(Attr->GetLevel());
 
+    // One pass over the granted specs; keep the first spec per class and drop accidental duplicates.
+    TMap<UClass*, FGameplayAbilitySpecHandle> ExistingByClass;
+    TArray<FGameplayAbilitySpecHandle> Duplicates;
+    for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+    {
+        if (!Spec.Ability) continue;
+
+        UClass* AbilityClass = Spec.Ability->GetClass();
+        if (ExistingByClass.Contains(AbilityClass))
+        {
+            Duplicates.Add(Spec.Handle);
+        }
+        else
+        {
+            ExistingByClass.Add(AbilityClass, Spec.Handle);
+        }
+    }
+
     for (const FLevelScaledAbility& Def : AbilitiesToOwn)
     {
         if (!Def.Ability) continue;
 
-        // Remove existing specs for that class.
-        TArray<FGameplayAbilitySpecHandle> ToClear;
-        for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+        const int32 SpecLevel = Def.bScaleWithLevel ? CurrentLevel : 1;
+
+        const FGameplayAbilitySpecHandle* ExistingHandle = ExistingByClass.Find(Def.Ability.Get());
+        if (FGameplayAbilitySpec* Spec = ExistingHandle ? ASC->FindAbilitySpecFromHandle(*ExistingHandle) : nullptr)
         {
-            if (Spec.Ability && Spec.Ability->GetClass() == Def.Ability)
+            // Re-level in place: active instances keep running and only the dirty spec replicates.
+            if (Spec->Level != SpecLevel || Spec->InputID != Def.InputID)
             {
-                ToClear.Add(Spec.Handle);
+                Spec->Level   = SpecLevel;
+                Spec->InputID = Def.InputID;
+                ASC->MarkAbilitySpecDirty(*Spec);
             }
-        }
-        for (const FGameplayAbilitySpecHandle& H : ToClear)
-        {
-            ASC->ClearAbility(H);
+            continue;
         }
 
-        const int32 SpecLevel = Def.bScaleWithLevel ? CurrentLevel : 1;
         FGameplayAbilitySpec NewSpec(Def.Ability, SpecLevel, Def.InputID, GetOwner());
         ASC->GiveAbility(NewSpec);
     }
+
+    for (const FGameplayAbilitySpecHandle& Handle : Duplicates)
+    {
+        const FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromHandle(Handle);
+        const bool bOwned = Spec && Spec->Ability && AbilitiesToOwn.ContainsByPredicate([Spec](const FLevelScaledAbility& Def)
+        {
+            return Def.Ability == Spec->Ability->GetClass();
+        });
+        if (bOwned)
+        {
+            ASC->ClearAbility(Handle);
+        }
+    }
 }
 
 void UAeyerjiLevelingComponent::ReapplyInfiniteEffects() const
@@ -260,17 +314,28 @@ void UAeyerjiLevelingComponent::ReapplyInfiniteEffects() const
     {
         if (!GEClass) continue;
 
-        // Remove any existing instance(s) of this GE on self so we do not stack duplicates.
+        FGameplayEffectQuery Query;
+        Query.EffectDefinition = GEClass;
+        const TArray<FActiveGameplayEffectHandle> ActiveHandles = ASC->GetActiveEffects(Query);
+
+        if (ActiveHandles.Num() > 0)
         {
-            FGameplayEffectQuery Query;
-            Query.CustomMatchDelegate.BindLambda([GEClass](const FActiveGameplayEffect& Active)
+            // Re-level the existing instance; GAS recalculates its modifiers and replicates one dirty item.
+            const FActiveGameplayEffect* Active = ASC->GetActiveGameplayEffect(ActiveHandles[0]);
+            if (Active && !FMath::IsNearlyEqual(Active->Spec.GetLevel(), static_cast<float>(CurrentLevel)))
             {
-                return Active.Spec.Def && Active.Spec.Def->GetClass() == GEClass;
-            });
-            ASC->RemoveActiveEffects(Query);
+                ASC->SetActiveGameplayEffectLevel(ActiveHandles[0], CurrentLevel);
+            }
+
+            // Never stack duplicates of a level-scaled passive.
+            for (int32 Index = 1; Index < ActiveHandles.Num(); ++Index)
+            {
+                ASC->RemoveActiveGameplayEffect(ActiveHandles[Index]);
+            }
+            continue;
         }
 
-        // Apply fresh at current level; include source object for clearer auditing
+        // Not applied yet: apply fresh at current level; include source object for clearer auditing
         FGameplayEffectContextHandle Ctx = ASC->MakeEffectContext();
         Ctx.AddSourceObject(GetOwner());
         FGameplayEffectSpecHandle    SH  = ASC->MakeOutgoingSpec(GEClass, CurrentLevel, Ctx);
@@ -278,7 +343,8 @@ void UAeyerjiLevelingComponent::ReapplyInfiniteEffects() const
         {
             ASC->ApplyGameplayEffectSpecToSelf(*SH.Data.Get());
         }
-    }}
+    }
+}
 
 /* ---------- Numeric writes ---------- */
 
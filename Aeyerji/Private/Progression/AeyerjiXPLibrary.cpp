@@ -10,6 +10,7 @@
 #include "Progression/AeyerjiRewardTuning.h"
 #include "Progression/AeyerjiRewardConfigComponent.h"
 #include "GameFramework/GameStateBase.h"
+#include "AeyerjiGameState.h"
 #include "GameFramework/PlayerState.h"
 #include "Kismet/GameplayStatics.h"
 #include "Enemy/EnemyParentNative.h"
@@ -95,6 +96,15 @@ int32 UAeyerjiXPLibrary::GetHighestPlayerLevel(const UObject* WorldContextObject
     AGameStateBase* GS = World->GetGameState();
     if (!GS) return 1;
 
+    // The game state keeps the party aggregate current from Level change events; only walk players without it.
+    if (const AAeyerjiGameState* AeyerjiGS = Cast<AAeyerjiGameState>(GS))
+    {
+        if (AeyerjiGS->HasPartyStats())
+        {
+            return AeyerjiGS->GetPartyStats().HighestLevel;
+        }
+    }
+
     int32 Highest = 1;
     for (APlayerState* PS : GS->PlayerArray)
     {
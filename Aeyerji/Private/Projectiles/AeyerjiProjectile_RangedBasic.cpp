@@ -7,6 +7,7 @@
 #include "Components/SphereComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "ProjectileAimLibrary.h"
+#include "Logging/AeyerjiStats.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogRangedProjectile, Log, All);
 
@@ -153,6 +154,8 @@ void AAeyerjiProjectile_RangedBasic::BeginPlay()
 {
 	Super::BeginPlay();
 
+	INC_DWORD_STAT(STAT_AJ_LiveProjectiles);
+
 	// Ensure locally replicated instances still know their source so self-grace checks work.
 	SpawnLocation = GetActorLocation();
 	if (SpawnTimeSeconds <= 0.0)
@@ -215,6 +218,13 @@ void AAeyerjiProjectile_RangedBasic::BeginPlay()
 	SuppressWorldCollisionForGrace();
 }
 
+void AAeyerjiProjectile_RangedBasic::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DEC_DWORD_STAT(STAT_AJ_LiveProjectiles);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AAeyerjiProjectile_RangedBasic::Destroyed()
 {
 	Super::Destroyed();
@@ -0,0 +1,44 @@
+#include "Systems/AeyerjiCorpseActor.h"
+
+#include "Components/PoseableMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+
+AAeyerjiCorpseActor::AAeyerjiCorpseActor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = false;
+	SetActorEnableCollision(false);
+
+	PoseableMesh = CreateDefaultSubobject<UPoseableMeshComponent>(TEXT("PoseableMesh"));
+	PoseableMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	PoseableMesh->SetGenerateOverlapEvents(false);
+	PoseableMesh->SetCanEverAffectNavigation(false);
+	PoseableMesh->SetMobility(EComponentMobility::Movable);
+	SetRootComponent(PoseableMesh);
+
+	SetActorHiddenInGame(true);
+}
+
+void AAeyerjiCorpseActor::ShowPoseOf(USkeletalMeshComponent& Source)
+{
+	PoseableMesh->SetSkinnedAssetAndUpdate(Source.GetSkinnedAsset(), /*bReinitPose=*/true);
+
+	const int32 NumMaterials = Source.GetNumMaterials();
+	for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+	{
+		PoseableMesh->SetMaterial(MaterialIndex, Source.GetMaterial(MaterialIndex));
+	}
+
+	// The poseable pose is component-relative, so take the (physics-driven) component transform as the actor transform.
+	SetActorTransform(Source.GetComponentTransform(), /*bSweep=*/false, nullptr, ETeleportType::TeleportPhysics);
+	PoseableMesh->CopyPoseFromSkeletalComponent(&Source);
+
+	SetActorHiddenInGame(false);
+}
+
+void AAeyerjiCorpseActor::Release()
+{
+	SetActorHiddenInGame(true);
+	PoseableMesh->EmptyOverrideMaterials();
+	PoseableMesh->SetSkinnedAssetAndUpdate(nullptr);
+}
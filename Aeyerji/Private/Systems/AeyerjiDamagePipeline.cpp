@@ -0,0 +1,278 @@
+#include "Systems/AeyerjiDamagePipeline.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "AeyerjiGameplayTags.h"
+#include "Attributes/AeyerjiAttributeSet.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GAS/ExecCalc_DamagePhysical.h"
+#include "GAS/GE_DamagePhysical.h"
+#include "GameplayEffect.h"
+#include "Systems/AeyerjiGameplayEventSubsystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAeyerjiDamagePipeline, Log, All);
+
+namespace
+{
+	using FSeenASCSet = TSet<UAbilitySystemComponent*, DefaultKeyFuncs<UAbilitySystemComponent*>, TInlineSetAllocator<32>>;
+
+	/** Applies Spec to one target and folds the outcome into Result. Dead, ASC-less and repeated targets are skipped. */
+	void ApplySpecToTarget(UAbilitySystemComponent& SourceASC, const FGameplayEffectSpec& Spec, AActor* Target,
+	                       const FPredictionKey& PredictionKey, FSeenASCSet& SeenASCs, FAeyerjiDamageBatchResult& Result)
+	{
+		UAbilitySystemComponent* TargetASC = IsValid(Target) ? UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Target) : nullptr;
+		bool bAlreadySeen = false;
+		if (TargetASC)
+		{
+			SeenASCs.Add(TargetASC, &bAlreadySeen);
+		}
+
+		if (!TargetASC || bAlreadySeen || TargetASC->HasMatchingGameplayTag(AeyerjiTags::State_Dead))
+		{
+			++Result.TargetsSkipped;
+			return;
+		}
+
+		const FGameplayAttribute HPAttr = UAeyerjiAttributeSet::GetHPAttribute();
+		const bool bHasHP = TargetASC->HasAttributeSetForAttribute(HPAttr);
+		const float HPBefore = bHasHP ? TargetASC->GetNumericAttribute(HPAttr) : 0.f;
+
+		SourceASC.ApplyGameplayEffectSpecToTarget(Spec, TargetASC, PredictionKey);
+		Result.HitActors.Add(Target);
+
+		if (bHasHP)
+		{
+			const float HPAfter = TargetASC->GetNumericAttribute(HPAttr);
+			Result.TotalDamage += FMath::Max(0.f, HPBefore - HPAfter);
+			if (HPBefore > 0.f && HPAfter <= 0.f)
+			{
+				++Result.Kills;
+			}
+		}
+	}
+}
+
+UAeyerjiDamagePipeline* UAeyerjiDamagePipeline::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (UGameInstance* GameInstance = World->GetGameInstance())
+	{
+		return GameInstance->GetSubsystem<UAeyerjiDamagePipeline>();
+	}
+
+	return nullptr;
+}
+
+TSubclassOf<UGameplayEffect> UAeyerjiDamagePipeline::ResolveEffectClass(const TSoftClassPtr<UGameplayEffect>& SoftClass)
+{
+	const FSoftObjectPath Path = SoftClass.ToSoftObjectPath();
+	if (!Path.IsValid())
+	{
+		return UGE_DamagePhysical::StaticClass();
+	}
+
+	if (const TSubclassOf<UGameplayEffect>* Cached = ResolvedEffectClasses.Find(Path))
+	{
+		if (*Cached)
+		{
+			return *Cached;
+		}
+	}
+
+	TSubclassOf<UGameplayEffect> Resolved = SoftClass.IsValid() ? SoftClass.Get() : SoftClass.LoadSynchronous();
+	if (!Resolved)
+	{
+		UE_LOG(LogAeyerjiDamagePipeline, Warning, TEXT("ResolveEffectClass: %s failed to load; using UGE_DamagePhysical."), *Path.ToString());
+		Resolved = UGE_DamagePhysical::StaticClass();
+	}
+
+	ResolvedEffectClasses.Add(Path, Resolved);
+	return Resolved;
+}
+
+FGameplayEffectSpecHandle UAeyerjiDamagePipeline::MakeSpecTemplate(UAbilitySystemComponent* SourceASC,
+                                                                   const FAeyerjiDamageSpecTemplate& Template,
+                                                                   FGameplayEffectContextHandle Context)
+{
+	if (!SourceASC)
+	{
+		return FGameplayEffectSpecHandle();
+	}
+
+	const TSubclassOf<UGameplayEffect> EffectClass = ResolveEffectClass(Template.EffectClass);
+
+	if (!Context.IsValid())
+	{
+		Context = SourceASC->MakeEffectContext();
+	}
+	if (Template.SourceObject)
+	{
+		Context.AddSourceObject(Template.SourceObject);
+	}
+
+	FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(EffectClass, Template.Level, Context);
+	if (!SpecHandle.IsValid() || !SpecHandle.Data.IsValid())
+	{
+		return FGameplayEffectSpecHandle();
+	}
+
+	static const FGameplayTag DefaultDamageTag = FGameplayTag::RequestGameplayTag(TEXT("SetByCaller.Damage.Instant"), /*ErrorIfNotFound=*/false);
+	const FGameplayTag MagnitudeTag = Template.SetByCallerTag.IsValid() ? Template.SetByCallerTag : DefaultDamageTag;
+	if (MagnitudeTag.IsValid())
+	{
+		SpecHandle.Data->SetSetByCallerMagnitude(MagnitudeTag, Template.Magnitude);
+	}
+
+	if (Template.DamageTypeTag.IsValid())
+	{
+		SpecHandle.Data->AddDynamicAssetTag(Template.DamageTypeTag);
+	}
+
+	return SpecHandle;
+}
+
+FAeyerjiDamageBatchResult UAeyerjiDamagePipeline::ApplySpecToTargets(UAbilitySystemComponent* SourceASC,
+                                                                     const FGameplayEffectSpecHandle& SpecHandle,
+                                                                     TConstArrayView<AActor*> Targets,
+                                                                     FPredictionKey PredictionKey)
+{
+	FAeyerjiDamageBatchResult Result;
+	if (!SourceASC || !SpecHandle.IsValid() || !SpecHandle.Data.IsValid())
+	{
+		Result.TargetsSkipped = Targets.Num();
+		return Result;
+	}
+
+	Result.Instigator = SourceASC->GetAvatarActor();
+	if (!Result.Instigator)
+	{
+		Result.Instigator = SourceASC->GetOwnerActor();
+	}
+
+	const FGameplayEffectSpec& Spec = *SpecHandle.Data.Get();
+
+	// One tuning lookup for every execution in the batch
+	UExecCalc_DamagePhysical::FScopedArmorTuningBatch ArmorTuningScope;
+
+	FSeenASCSet SeenASCs;
+	Result.HitActors.Reserve(Targets.Num());
+
+	for (AActor* Target : Targets)
+	{
+		ApplySpecToTarget(*SourceASC, Spec, Target, PredictionKey, SeenASCs, Result);
+	}
+
+	UE_LOG(LogAeyerjiDamagePipeline, Verbose, TEXT("Batch %s: Hit=%d Skipped=%d Damage=%.1f Kills=%d"),
+		*GetNameSafe(Spec.Def), Result.HitActors.Num(), Result.TargetsSkipped, Result.TotalDamage, Result.Kills);
+
+	if (Result.HitActors.Num() > 0)
+	{
+		BroadcastBatch(Result);
+	}
+	return Result;
+}
+
+FAeyerjiDamageBatchResult UAeyerjiDamagePipeline::ApplySpecToTargetData(UAbilitySystemComponent* SourceASC,
+                                                                        const FGameplayEffectSpecHandle& SpecHandle,
+                                                                        const FGameplayAbilityTargetDataHandle& TargetData,
+                                                                        FPredictionKey PredictionKey)
+{
+	FAeyerjiDamageBatchResult Result;
+	if (!SourceASC || !SpecHandle.IsValid() || !SpecHandle.Data.IsValid())
+	{
+		for (const TSharedPtr<FGameplayAbilityTargetData>& Data : TargetData.Data)
+		{
+			Result.TargetsSkipped += Data.IsValid() ? Data->GetActors().Num() : 0;
+		}
+		return Result;
+	}
+
+	Result.Instigator = SourceASC->GetAvatarActor();
+	if (!Result.Instigator)
+	{
+		Result.Instigator = SourceASC->GetOwnerActor();
+	}
+
+	UExecCalc_DamagePhysical::FScopedArmorTuningBatch ArmorTuningScope;
+
+	FSeenASCSet SeenASCs;
+	for (const TSharedPtr<FGameplayAbilityTargetData>& Data : TargetData.Data)
+	{
+		if (!Data.IsValid())
+		{
+			continue;
+		}
+
+		// Per-entry copy so the hit result (impact point, normal, bone) reaches cues and executions for this target.
+		FGameplayEffectSpec EntrySpec(*SpecHandle.Data.Get());
+		FGameplayEffectContextHandle EntryContext = EntrySpec.GetContext().Duplicate();
+		Data->AddTargetDataToContext(EntryContext, /*bIncludeActorArray=*/false);
+		EntrySpec.SetContext(EntryContext);
+
+		for (const TWeakObjectPtr<AActor>& ActorPtr : Data->GetActors())
+		{
+			ApplySpecToTarget(*SourceASC, EntrySpec, ActorPtr.Get(), PredictionKey, SeenASCs, Result);
+		}
+	}
+
+	UE_LOG(LogAeyerjiDamagePipeline, Verbose, TEXT("Batch %s: Hit=%d Skipped=%d Damage=%.1f Kills=%d"),
+		*GetNameSafe(SpecHandle.Data->Def), Result.HitActors.Num(), Result.TargetsSkipped, Result.TotalDamage, Result.Kills);
+
+	if (Result.HitActors.Num() > 0)
+	{
+		BroadcastBatch(Result);
+	}
+	return Result;
+}
+
+FAeyerjiDamageBatchResult UAeyerjiDamagePipeline::ApplyDamageBatch(UAbilitySystemComponent* SourceASC,
+                                                                   const FAeyerjiDamageSpecTemplate& Template,
+                                                                   const TArray<AActor*>& Targets)
+{
+	if (!SourceASC || !SourceASC->IsOwnerActorAuthoritative())
+	{
+		FAeyerjiDamageBatchResult Skipped;
+		Skipped.TargetsSkipped = Targets.Num();
+		return Skipped;
+	}
+
+	return ApplySpecToTargets(SourceASC, MakeSpecTemplate(SourceASC, Template), Targets);
+}
+
+void UAeyerjiDamagePipeline::BroadcastBatch(const FAeyerjiDamageBatchResult& Result) const
+{
+	OnDamageBatchApplied.Broadcast(Result);
+
+	if (UAeyerjiGameplayEventSubsystem* Events = UAeyerjiGameplayEventSubsystem::Get(this))
+	{
+		FGameplayEventData Payload;
+		Payload.EventTag = AeyerjiTags::Event_Damage_BatchApplied;
+		Payload.Instigator = Result.Instigator;
+		Payload.EventMagnitude = Result.TotalDamage;
+
+		TArray<TWeakObjectPtr<AActor>> HitActors;
+		HitActors.Reserve(Result.HitActors.Num());
+		for (AActor* Actor : Result.HitActors)
+		{
+			HitActors.Add(Actor);
+		}
+
+		FGameplayAbilityTargetData_ActorArray* ActorData = new FGameplayAbilityTargetData_ActorArray();
+		ActorData->SetActors(HitActors);
+		Payload.TargetData.Add(ActorData);
+
+		Events->BroadcastEvent(AeyerjiTags::Event_Damage_BatchApplied, Payload);
+	}
+}
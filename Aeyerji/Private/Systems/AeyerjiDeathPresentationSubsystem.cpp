@@ -0,0 +1,378 @@
+#include "Systems/AeyerjiDeathPresentationSubsystem.h"
+
+#include "Abilities/AeyerjiRagdollHelpers.h"
+#include "AeyerjiGameState.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/AeyerjiStats.h"
+#include "Systems/AeyerjiCorpseActor.h"
+#include "TimerManager.h"
+
+namespace
+{
+	static TAutoConsoleVariable<int32>& GetMaxRagdollsCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Death.MaxRagdolls"),
+			8,
+			TEXT("Ragdolls simulating at once on this machine; the oldest is frozen into a static corpse to make room."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetRagdollSecondsCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Death.RagdollSeconds"),
+			4.f,
+			TEXT("Seconds a ragdoll simulates before it is frozen into a static corpse."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<int32>& GetMaxCorpsesCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Death.MaxCorpses"),
+			24,
+			TEXT("Frozen corpses shown at once; the oldest is recycled first. 0 disables corpses (bodies vanish with the actor)."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetCorpseSecondsCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Death.CorpseSeconds"),
+			12.f,
+			TEXT("Seconds a frozen corpse stays before sinking out."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	constexpr float CorpseSinkSeconds = 1.5f;
+	constexpr float CorpseSinkDepth = 120.f;
+
+	/** Unreliable RPCs should fit a packet; a mass kill beyond this is split over several calls in the same flush. */
+	constexpr int32 MaxEventsPerBatch = 24;
+}
+
+UAeyerjiDeathPresentationSubsystem* UAeyerjiDeathPresentationSubsystem::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UAeyerjiDeathPresentationSubsystem>() : nullptr;
+}
+
+bool UAeyerjiDeathPresentationSubsystem::RequestRagdollFor(ACharacter* Char, const FVector& Impulse, const FVector& ImpulseWorldLocation, FName BoneName)
+{
+	if (UAeyerjiDeathPresentationSubsystem* Presentation = Get(Char))
+	{
+		return Presentation->RequestRagdoll(Char, Impulse, ImpulseWorldLocation, BoneName);
+	}
+
+	FAeyerjiRagdollHelpers::StartRagdoll(Char, Impulse, ImpulseWorldLocation, BoneName);
+	return Char != nullptr;
+}
+
+bool UAeyerjiDeathPresentationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAeyerjiDeathPresentationSubsystem::Deinitialize()
+{
+	PendingEvents.Reset();
+	ActiveRagdolls.Reset();
+	ActiveCorpses.Reset();
+	RagdolledCharacters.Reset();
+	FreeCorpses.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UAeyerjiDeathPresentationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAeyerjiDeathPresentationSubsystem, STATGROUP_Tickables);
+}
+
+bool UAeyerjiDeathPresentationSubsystem::IsPresentationWorld() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UAeyerjiDeathPresentationSubsystem::QueueDeathEvent(const FAeyerjiDeathEvent& Event)
+{
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Standalone || World->GetNetMode() == NM_Client || !Event.Victim)
+	{
+		return;
+	}
+
+	PendingEvents.Add(Event);
+
+	if (!bFlushQueued)
+	{
+		bFlushQueued = true;
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UAeyerjiDeathPresentationSubsystem::FlushDeathEvents));
+	}
+}
+
+void UAeyerjiDeathPresentationSubsystem::FlushDeathEvents()
+{
+	bFlushQueued = false;
+
+	const UWorld* World = GetWorld();
+	AAeyerjiGameState* GameState = World ? World->GetGameState<AAeyerjiGameState>() : nullptr;
+	if (!GameState)
+	{
+		PendingEvents.Reset(); // bIsDead still replicates
+		return;
+	}
+
+	// Victims destroyed since they were queued have nothing left to present.
+	PendingEvents.RemoveAllSwap([](const FAeyerjiDeathEvent& Event) { return !IsValid(Event.Victim); });
+
+	for (int32 First = 0; First < PendingEvents.Num(); First += MaxEventsPerBatch)
+	{
+		const int32 Count = FMath::Min(MaxEventsPerBatch, PendingEvents.Num() - First);
+		if (First == 0 && Count == PendingEvents.Num())
+		{
+			GameState->MulticastDeathBatch(PendingEvents);
+		}
+		else
+		{
+			GameState->MulticastDeathBatch(TArray<FAeyerjiDeathEvent>(PendingEvents.GetData() + First, Count));
+		}
+	}
+
+	PendingEvents.Reset();
+}
+
+void UAeyerjiDeathPresentationSubsystem::HandleDeathBatch(const TArray<FAeyerjiDeathEvent>& Events)
+{
+	AJ_SCOPE_CYCLE(STAT_AJ_DeathPresentation);
+
+	for (const FAeyerjiDeathEvent& Event : Events)
+	{
+		if (AAeyerjiCharacter* Victim = Event.Victim)
+		{
+			Victim->ApplyDeathEvent(Event);
+		}
+	}
+}
+
+bool UAeyerjiDeathPresentationSubsystem::RequestRagdoll(ACharacter* Char, const FVector& Impulse, const FVector& ImpulseWorldLocation, FName BoneName)
+{
+	if (!Char)
+	{
+		return false;
+	}
+
+	USkeletalMeshComponent* Mesh = Char->GetMesh();
+	if (!Mesh)
+	{
+		return false;
+	}
+
+	if (!IsPresentationWorld())
+	{
+		// Nobody sees it: stop the body and skip physics entirely.
+		if (UCharacterMovementComponent* Move = Char->GetCharacterMovement())
+		{
+			Move->StopMovementImmediately();
+			Move->DisableMovement();
+		}
+		Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Mesh->bPauseAnims = true;
+		return false;
+	}
+
+	bool bAlreadyRagdolled = false;
+	RagdolledCharacters.Add(Char, &bAlreadyRagdolled);
+	if (bAlreadyRagdolled)
+	{
+		return Mesh->IsSimulatingPhysics();
+	}
+
+	AJ_SCOPE_CYCLE(STAT_AJ_DeathPresentation);
+
+	const int32 MaxRagdolls = FMath::Max(0, GetMaxRagdollsCVar().GetValueOnGameThread());
+	while (ActiveRagdolls.Num() > 0 && ActiveRagdolls.Num() >= MaxRagdolls)
+	{
+		FreezeRagdoll(0);
+	}
+
+	FAeyerjiRagdollHelpers::StartRagdoll(Char, Impulse, ImpulseWorldLocation, BoneName);
+
+	FActiveRagdoll& Entry = ActiveRagdolls.AddDefaulted_GetRef();
+	Entry.Character = Char;
+	Entry.StartTime = GetWorld()->GetTimeSeconds();
+
+	if (MaxRagdolls == 0)
+	{
+		// Cap of zero: straight to a static corpse on the death pose.
+		FreezeRagdoll(ActiveRagdolls.Num() - 1);
+		return false;
+	}
+
+	return true;
+}
+
+void UAeyerjiDeathPresentationSubsystem::HandleCharacterRemoved(ACharacter* Char)
+{
+	if (!Char)
+	{
+		return;
+	}
+
+	for (int32 Index = ActiveRagdolls.Num() - 1; Index >= 0; --Index)
+	{
+		if (ActiveRagdolls[Index].Character.Get() == Char)
+		{
+			FreezeRagdoll(Index);
+		}
+	}
+
+	RagdolledCharacters.Remove(Char);
+}
+
+void UAeyerjiDeathPresentationSubsystem::FreezeRagdoll(const int32 Index)
+{
+	const FActiveRagdoll Entry = ActiveRagdolls[Index];
+	ActiveRagdolls.RemoveAt(Index);
+
+	ACharacter* Char = Entry.Character.Get();
+	USkeletalMeshComponent* Mesh = Char ? Char->GetMesh() : nullptr;
+	if (!Mesh)
+	{
+		return;
+	}
+
+	if (Mesh->GetSkinnedAsset() && Mesh->IsVisible())
+	{
+		if (AAeyerjiCorpseActor* Corpse = AcquireCorpse())
+		{
+			Corpse->ShowPoseOf(*Mesh);
+
+			FActiveCorpse& Shown = ActiveCorpses.AddDefaulted_GetRef();
+			Shown.Corpse = Corpse;
+			Shown.ShownTime = GetWorld()->GetTimeSeconds();
+			Shown.RestLocation = Corpse->GetActorLocation();
+		}
+	}
+
+	// The corpse (if any) carries the pose from here; the character's mesh stops costing physics, anim and draws.
+	Mesh->SetAllBodiesSimulatePhysics(false);
+	Mesh->SetSimulatePhysics(false);
+	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Mesh->SetHiddenInGame(true, /*bPropagateToChildren=*/true);
+	Mesh->SetComponentTickEnabled(false);
+}
+
+AAeyerjiCorpseActor* UAeyerjiDeathPresentationSubsystem::AcquireCorpse()
+{
+	const int32 MaxCorpses = GetMaxCorpsesCVar().GetValueOnGameThread();
+	if (MaxCorpses <= 0)
+	{
+		return nullptr;
+	}
+
+	while (ActiveCorpses.Num() >= MaxCorpses)
+	{
+		ReleaseCorpse(0);
+	}
+
+	while (FreeCorpses.Num() > 0)
+	{
+		if (AAeyerjiCorpseActor* Pooled = FreeCorpses.Pop())
+		{
+			if (IsValid(Pooled))
+			{
+				return Pooled;
+			}
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.ObjectFlags |= RF_Transient;
+	return World->SpawnActor<AAeyerjiCorpseActor>(AAeyerjiCorpseActor::StaticClass(), FTransform::Identity, Params);
+}
+
+void UAeyerjiDeathPresentationSubsystem::ReleaseCorpse(const int32 Index)
+{
+	if (AAeyerjiCorpseActor* Corpse = ActiveCorpses[Index].Corpse.Get())
+	{
+		Corpse->Release();
+		FreeCorpses.Add(Corpse);
+	}
+
+	ActiveCorpses.RemoveAt(Index);
+}
+
+void UAeyerjiDeathPresentationSubsystem::Tick(float DeltaTime)
+{
+	if (ActiveRagdolls.Num() == 0 && ActiveCorpses.Num() == 0)
+	{
+		return;
+	}
+
+	AJ_SCOPE_CYCLE(STAT_AJ_DeathPresentation);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	const double RagdollSeconds = FMath::Max(0.f, GetRagdollSecondsCVar().GetValueOnGameThread());
+	for (int32 Index = ActiveRagdolls.Num() - 1; Index >= 0; --Index)
+	{
+		if (!ActiveRagdolls[Index].Character.IsValid())
+		{
+			ActiveRagdolls.RemoveAt(Index);
+		}
+		else if (Now - ActiveRagdolls[Index].StartTime >= RagdollSeconds)
+		{
+			FreezeRagdoll(Index);
+		}
+	}
+
+	const double CorpseSeconds = FMath::Max(0.f, GetCorpseSecondsCVar().GetValueOnGameThread());
+	for (int32 Index = ActiveCorpses.Num() - 1; Index >= 0; --Index)
+	{
+		const FActiveCorpse& Entry = ActiveCorpses[Index];
+		AAeyerjiCorpseActor* Corpse = Entry.Corpse.Get();
+		if (!Corpse)
+		{
+			ActiveCorpses.RemoveAt(Index);
+			continue;
+		}
+
+		const double Age = Now - Entry.ShownTime;
+		if (Age >= CorpseSeconds + CorpseSinkSeconds)
+		{
+			ReleaseCorpse(Index);
+		}
+		else if (Age > CorpseSeconds)
+		{
+			const float Alpha = static_cast<float>((Age - CorpseSeconds) / CorpseSinkSeconds);
+			Corpse->SetActorLocation(Entry.RestLocation - FVector(0.f, 0.f, CorpseSinkDepth * Alpha));
+		}
+	}
+}
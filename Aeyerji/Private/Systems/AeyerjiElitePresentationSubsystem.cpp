@@ -0,0 +1,376 @@
+// Copyright (c) 2025 Aeyerji.
+#include "Systems/AeyerjiElitePresentationSubsystem.h"
+
+#include "Director/AeyerjiEliteAffixComponent.h"
+#include "Director/AeyerjiSpawnerGroup.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Logging/AeyerjiStats.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+
+namespace
+{
+	static TAutoConsoleVariable<int32>& GetMaxEliteComponentsCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Elite.MaxNiagaraComponents"),
+			24,
+			TEXT("Elite aura + affix Niagara components active at once on this machine; lower-priority elites degrade first."),
+			ECVF_Scalability);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetFullDetailDistanceCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Elite.FullDetailDistance"),
+			2500.f,
+			TEXT("Elites closer than this (cm, scaled by threat) may show every affix FX; further ones get a single aura."),
+			ECVF_Scalability);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetAuraCullDistanceCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Elite.AuraCullDistance"),
+			6000.f,
+			TEXT("Elites further than this (cm, scaled by threat) show no elite FX at all."),
+			ECVF_Scalability);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetPresentationIntervalCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Elite.PresentationInterval"),
+			0.25f,
+			TEXT("Seconds between elite FX budget passes."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	bool GetLocalViewLocation(const UWorld& World, FVector& OutLocation)
+	{
+		const APlayerController* PC = World.GetFirstPlayerController();
+		if (!PC || !PC->IsLocalController())
+		{
+			return false;
+		}
+
+		FRotator ViewRotation;
+		PC->GetPlayerViewPoint(OutLocation, ViewRotation);
+
+		// Top-down camera: rank by distance to the hero rather than to a camera hovering far above.
+		if (const APawn* Pawn = PC->GetPawn())
+		{
+			OutLocation = Pawn->GetActorLocation();
+		}
+		return true;
+	}
+}
+
+UAeyerjiElitePresentationSubsystem* UAeyerjiElitePresentationSubsystem::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UAeyerjiElitePresentationSubsystem>() : nullptr;
+}
+
+void UAeyerjiElitePresentationSubsystem::RegisterElite(UAeyerjiEliteAffixComponent* Elite)
+{
+	if (!Elite)
+	{
+		return;
+	}
+
+	for (FEliteFX& Entry : Elites)
+	{
+		if (Entry.Elite.Get() == Elite)
+		{
+			// Affix state changed: rebuild its FX on the next pass.
+			ReleaseAll(Entry);
+			TimeUntilUpdate = 0.f;
+			return;
+		}
+	}
+
+	FEliteFX& Entry = Elites.AddDefaulted_GetRef();
+	Entry.Elite = Elite;
+	TimeUntilUpdate = 0.f;
+}
+
+void UAeyerjiElitePresentationSubsystem::UnregisterElite(UAeyerjiEliteAffixComponent* Elite)
+{
+	for (int32 Index = 0; Index < Elites.Num(); ++Index)
+	{
+		if (Elites[Index].Elite.Get() == Elite)
+		{
+			ReleaseAll(Elites[Index]);
+			Elites.RemoveAtSwap(Index);
+			TimeUntilUpdate = 0.f;
+			return;
+		}
+	}
+}
+
+int32 UAeyerjiElitePresentationSubsystem::GetNumActiveComponents() const
+{
+	int32 Count = 0;
+	for (const FEliteFX& Entry : Elites)
+	{
+		Count += Entry.Aura.IsValid() ? 1 : 0;
+		for (const TWeakObjectPtr<UNiagaraComponent>& Component : Entry.AffixFX)
+		{
+			Count += Component.IsValid() ? 1 : 0;
+		}
+	}
+	return Count;
+}
+
+bool UAeyerjiElitePresentationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UAeyerjiElitePresentationSubsystem::Deinitialize()
+{
+	for (FEliteFX& Entry : Elites)
+	{
+		ReleaseAll(Entry);
+	}
+	Elites.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAeyerjiElitePresentationSubsystem::Tick(float DeltaTime)
+{
+	if (Elites.Num() == 0)
+	{
+		return;
+	}
+
+	TimeUntilUpdate -= DeltaTime;
+	if (TimeUntilUpdate > 0.f)
+	{
+		return;
+	}
+	TimeUntilUpdate = FMath::Max(0.f, GetPresentationIntervalCVar().GetValueOnGameThread());
+
+	AJ_SCOPE_CYCLE(STAT_AJ_ElitePresentation);
+	UpdateBudget();
+}
+
+TStatId UAeyerjiElitePresentationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAeyerjiElitePresentationSubsystem, STATGROUP_Tickables);
+}
+
+bool UAeyerjiElitePresentationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAeyerjiElitePresentationSubsystem::UpdateBudget()
+{
+	const UWorld* World = GetWorld();
+	FVector ViewLocation;
+	if (!World || !GetLocalViewLocation(*World, ViewLocation))
+	{
+		return;
+	}
+
+	struct FRanked
+	{
+		int32 Index = INDEX_NONE;
+		float Priority = 0.f;
+	};
+
+	for (int32 Index = Elites.Num() - 1; Index >= 0; --Index)
+	{
+		const UAeyerjiEliteAffixComponent* Elite = Elites[Index].Elite.Get();
+		if (!Elite || !Elite->GetOwner())
+		{
+			ReleaseAll(Elites[Index]);
+			Elites.RemoveAtSwap(Index);
+		}
+	}
+
+	TArray<FRanked, TInlineAllocator<32>> Ranked;
+	for (int32 Index = 0; Index < Elites.Num(); ++Index)
+	{
+		const UAeyerjiEliteAffixComponent* Elite = Elites[Index].Elite.Get();
+		const AActor* Owner = Elite->GetOwner();
+
+		// Threat stretches distance: a boss at 4x threat ranks like a plain elite a quarter as far away.
+		const float Distance = FVector::Dist(ViewLocation, Owner->GetActorLocation());
+		Ranked.Add({Index, Distance / FMath::Max(Elite->GetThreat(), KINDA_SMALL_NUMBER)});
+	}
+
+	Ranked.Sort([](const FRanked& A, const FRanked& B) { return A.Priority < B.Priority; });
+
+	const float FullDistance = GetFullDetailDistanceCVar().GetValueOnGameThread();
+	const float CullDistance = GetAuraCullDistanceCVar().GetValueOnGameThread();
+	int32 Budget = FMath::Max(0, GetMaxEliteComponentsCVar().GetValueOnGameThread());
+
+	TArray<ETier, TInlineAllocator<32>> Tiers;
+	Tiers.Init(ETier::None, Elites.Num());
+	for (const FRanked& Rank : Ranked)
+	{
+		const UAeyerjiEliteAffixComponent* Elite = Elites[Rank.Index].Elite.Get();
+		const int32 FullCost = 1 + Elite->GetNumAffixes();
+
+		ETier Tier = ETier::None;
+		if (Rank.Priority <= FullDistance && Budget >= FullCost)
+		{
+			Tier = ETier::Full;
+			Budget -= FullCost;
+		}
+		else if (Rank.Priority <= CullDistance && Budget >= 1)
+		{
+			Tier = ETier::Aura;
+			Budget -= 1;
+		}
+		Tiers[Rank.Index] = Tier;
+	}
+
+	// Demotions first so the components they free are back in the pool before promotions spawn.
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		for (const FRanked& Rank : Ranked)
+		{
+			FEliteFX& Entry = Elites[Rank.Index];
+			const bool bDemotion = Tiers[Rank.Index] < Entry.Tier;
+			if ((Pass == 0) == bDemotion)
+			{
+				ApplyTier(Entry, Tiers[Rank.Index]);
+			}
+		}
+	}
+}
+
+void UAeyerjiElitePresentationSubsystem::ApplyTier(FEliteFX& Entry, ETier NewTier)
+{
+	UAeyerjiEliteAffixComponent* Elite = Entry.Elite.Get();
+	const AAeyerjiSpawnerGroup* Source = Elite ? Elite->GetPresentation().Source.Get() : nullptr;
+	if (!Source || NewTier == ETier::None)
+	{
+		ReleaseAll(Entry);
+		return;
+	}
+
+	// Full keeps the authored aura; Aura swaps to the cheap one when the spawner provides it.
+	UNiagaraSystem* AuraSystem = Source->EliteVFXSystem;
+	if (NewTier == ETier::Aura && Source->EliteReducedVFXSystem)
+	{
+		AuraSystem = Source->EliteReducedVFXSystem;
+	}
+
+	if (Entry.AuraSystem.Get() != AuraSystem || !Entry.Aura.IsValid())
+	{
+		Release(Entry.Aura);
+		Entry.AuraSystem = AuraSystem;
+		if (AuraSystem)
+		{
+			Entry.Aura = Acquire(*Elite, AuraSystem, Source->EliteVFXSocket, Source->EliteVFXOffset);
+		}
+	}
+
+	if (NewTier == ETier::Full)
+	{
+		if (Entry.Tier != ETier::Full)
+		{
+			TArray<const FEliteAffixDefinition*> Affixes;
+			Elite->GetAffixes(Affixes);
+			for (const FEliteAffixDefinition* Affix : Affixes)
+			{
+				if (Affix->VFXSystem)
+				{
+					Entry.AffixFX.Add(Acquire(*Elite, Affix->VFXSystem, Affix->VFXSocket, Affix->VFXOffset));
+				}
+			}
+		}
+	}
+	else
+	{
+		for (TWeakObjectPtr<UNiagaraComponent>& Component : Entry.AffixFX)
+		{
+			Release(Component);
+		}
+		Entry.AffixFX.Reset();
+	}
+
+	Entry.Tier = NewTier;
+}
+
+void UAeyerjiElitePresentationSubsystem::ReleaseAll(FEliteFX& Entry)
+{
+	Release(Entry.Aura);
+	Entry.AuraSystem.Reset();
+	for (TWeakObjectPtr<UNiagaraComponent>& Component : Entry.AffixFX)
+	{
+		Release(Component);
+	}
+	Entry.AffixFX.Reset();
+	Entry.Tier = ETier::None;
+}
+
+void UAeyerjiElitePresentationSubsystem::Release(TWeakObjectPtr<UNiagaraComponent>& Component)
+{
+	if (UNiagaraComponent* Comp = Component.Get())
+	{
+		Comp->ReleaseToPool();
+	}
+	Component.Reset();
+}
+
+UNiagaraComponent* UAeyerjiElitePresentationSubsystem::Acquire(const UAeyerjiEliteAffixComponent& Elite, UNiagaraSystem* System, FName Socket, const FVector& Offset)
+{
+	AActor* Owner = Elite.GetOwner();
+	USceneComponent* AttachParent = nullptr;
+	if (const ACharacter* Character = Cast<ACharacter>(Owner))
+	{
+		AttachParent = Character->GetMesh();
+	}
+	if (!AttachParent && Owner)
+	{
+		AttachParent = Owner->GetRootComponent();
+	}
+
+	if (!System || !AttachParent || !AttachParent->IsRegistered())
+	{
+		return nullptr;
+	}
+
+	UNiagaraComponent* Component = UNiagaraFunctionLibrary::SpawnSystemAttached(
+		System,
+		AttachParent,
+		Socket,
+		Offset,
+		FRotator::ZeroRotator,
+		EAttachLocation::KeepRelativeOffset,
+		/*bAutoDestroy=*/false,
+		/*bAutoActivate=*/true,
+		ENCPoolMethod::ManualRelease);
+
+	if (!Component)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Elite FX %s failed to spawn on %s"), *GetNameSafe(System), *GetNameSafe(Owner));
+		return nullptr;
+	}
+
+	Component->SetUsingAbsoluteScale(false);
+	return Component;
+}
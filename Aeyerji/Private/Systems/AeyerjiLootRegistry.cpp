@@ -0,0 +1,101 @@
+#include "Systems/AeyerjiLootRegistry.h"
+
+#include "Engine/World.h"
+#include "Inventory/AeyerjiLootPickup.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAeyerjiLootRegistry, Log, All);
+
+UAeyerjiLootRegistry* UAeyerjiLootRegistry::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UAeyerjiLootRegistry>() : nullptr;
+}
+
+bool UAeyerjiLootRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FAeyerjiLootHandle UAeyerjiLootRegistry::Register(AAeyerjiLootPickup* Pickup)
+{
+	if (!Pickup)
+	{
+		return FAeyerjiLootHandle();
+	}
+
+	Pickups.AddUnique(Pickup);
+
+	if (!Pickup->HasAuthority())
+	{
+		return FAeyerjiLootHandle();
+	}
+
+	uint16 Index = 0;
+	if (FreeSlots.Num() > 0)
+	{
+		Index = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		if (Slots.Num() > MAX_uint16)
+		{
+			UE_LOG(LogAeyerjiLootRegistry, Error, TEXT("Register: Out of loot handles; %s will only be reachable by actor reference."), *GetNameSafe(Pickup));
+			return FAeyerjiLootHandle();
+		}
+		Index = static_cast<uint16>(Slots.AddDefaulted());
+	}
+
+	FSlot& Slot = Slots[Index];
+	Slot.Pickup = Pickup;
+	Slot.bInUse = true;
+
+	FAeyerjiLootHandle Handle;
+	Handle.Index = Index;
+	Handle.Serial = Slot.Serial;
+	return Handle;
+}
+
+void UAeyerjiLootRegistry::Unregister(AAeyerjiLootPickup* Pickup, const FAeyerjiLootHandle& Handle)
+{
+	Pickups.RemoveSwap(Pickup, EAllowShrinking::No);
+
+	if (!Handle.IsValid() || !Slots.IsValidIndex(Handle.Index))
+	{
+		return;
+	}
+
+	FSlot& Slot = Slots[Handle.Index];
+	if (!Slot.bInUse || Slot.Serial != Handle.Serial)
+	{
+		return;
+	}
+
+	Slot.Pickup.Reset();
+	Slot.bInUse = false;
+
+	// Advance the generation so any handle still in flight for this slot is rejected; skip 0 (invalid).
+	Slot.Serial = Slot.Serial == MAX_uint16 ? 1 : Slot.Serial + 1;
+	FreeSlots.Add(Handle.Index);
+}
+
+AAeyerjiLootPickup* UAeyerjiLootRegistry::Resolve(const FAeyerjiLootHandle& Handle) const
+{
+	if (!Handle.IsValid() || !Slots.IsValidIndex(Handle.Index))
+	{
+		return nullptr;
+	}
+
+	const FSlot& Slot = Slots[Handle.Index];
+	if (!Slot.bInUse || Slot.Serial != Handle.Serial)
+	{
+		return nullptr;
+	}
+
+	AAeyerjiLootPickup* Pickup = Slot.Pickup.Get();
+	return IsValid(Pickup) ? Pickup : nullptr;
+}
@@ -0,0 +1,234 @@
+#include "Systems/AeyerjiNavProjectionCache.h"
+
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "NavigationSystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAeyerjiNavCache, Log, All);
+
+namespace
+{
+	/** Vertical band size; coarse enough that one band never straddles two walkable floors in practice. */
+	constexpr float CacheZBandSize = 50.f;
+
+	/** Query extents within this step share a bucket (and therefore cached answers). */
+	constexpr float CacheExtentStep = 25.f;
+
+	static TAutoConsoleVariable<int32>& GetNavProjectionCacheEnabledCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Nav.ProjectionCache"),
+			1,
+			TEXT("1 = memoize click-to-move nav projections per world. 0 = always query the navmesh."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetNavProjectionCacheCellSizeCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Nav.ProjectionCacheCellSize"),
+			16.f,
+			TEXT("XY cell size (uu) of the nav projection cache. Cached goals can be off by up to half a cell."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<int32>& GetNavProjectionCacheMaxEntriesCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Nav.ProjectionCacheMaxEntries"),
+			4096,
+			TEXT("Nav projection cache is cleared once it grows past this many cells."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	int32 QuantizeAxis(double Value, float Step)
+	{
+		return FMath::FloorToInt32(Value / Step);
+	}
+
+	int32 BucketExtentAxis(double Value)
+	{
+		return FMath::RoundToInt32(Value / CacheExtentStep);
+	}
+}
+
+UAeyerjiNavProjectionCache* UAeyerjiNavProjectionCache::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UAeyerjiNavProjectionCache>() : nullptr;
+}
+
+bool UAeyerjiNavProjectionCache::ProjectPoint(const UObject* WorldContext, const FVector& Point, const FVector& Extent, FVector& OutLocation, bool* bOutQueriedNavMesh)
+{
+	if (UAeyerjiNavProjectionCache* Cache = Get(WorldContext))
+	{
+		return Cache->Project(Point, Extent, OutLocation, bOutQueriedNavMesh);
+	}
+
+	if (bOutQueriedNavMesh)
+	{
+		*bOutQueriedNavMesh = true;
+	}
+
+	const UNavigationSystemV1* NavSys = WorldContext ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(WorldContext->GetWorld()) : nullptr;
+	FNavLocation Projected;
+	if (NavSys && NavSys->ProjectPointToNavigation(Point, Projected, Extent))
+	{
+		OutLocation = Projected.Location;
+		return true;
+	}
+	return false;
+}
+
+bool UAeyerjiNavProjectionCache::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAeyerjiNavProjectionCache::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	BindNavigationEvents();
+
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UAeyerjiNavProjectionCache::HandleLevelStreamingChanged);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UAeyerjiNavProjectionCache::HandleLevelStreamingChanged);
+}
+
+void UAeyerjiNavProjectionCache::Deinitialize()
+{
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UAeyerjiNavProjectionCache::HandleNavDataChanged);
+		NavSys->OnNavDataRegisteredEvent.RemoveDynamic(this, &UAeyerjiNavProjectionCache::HandleNavDataChanged);
+	}
+
+	Entries.Reset();
+	bNavigationEventsBound = false;
+
+	Super::Deinitialize();
+}
+
+void UAeyerjiNavProjectionCache::BindNavigationEvents()
+{
+	if (bNavigationEventsBound)
+	{
+		return;
+	}
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UAeyerjiNavProjectionCache::HandleNavDataChanged);
+		NavSys->OnNavDataRegisteredEvent.AddUniqueDynamic(this, &UAeyerjiNavProjectionCache::HandleNavDataChanged);
+		bNavigationEventsBound = true;
+	}
+}
+
+void UAeyerjiNavProjectionCache::HandleNavDataChanged(ANavigationData* NavData)
+{
+	Invalidate();
+}
+
+void UAeyerjiNavProjectionCache::HandleLevelStreamingChanged(ULevel* Level, UWorld* InWorld)
+{
+	if (InWorld == GetWorld())
+	{
+		Invalidate();
+	}
+}
+
+void UAeyerjiNavProjectionCache::Invalidate()
+{
+	if (Entries.Num() > 0)
+	{
+		UE_LOG(LogAeyerjiNavCache, Verbose, TEXT("Invalidate: dropping %d cells (hits=%u misses=%u since last flush)"),
+			Entries.Num(), NumHits, NumMisses);
+	}
+
+	Entries.Reset();
+	NumHits = 0;
+	NumMisses = 0;
+}
+
+bool UAeyerjiNavProjectionCache::Project(const FVector& Point, const FVector& Extent, FVector& OutLocation, bool* bOutQueriedNavMesh)
+{
+	if (bOutQueriedNavMesh)
+	{
+		*bOutQueriedNavMesh = false;
+	}
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys)
+	{
+		return false;
+	}
+
+	// Nav system can come up after OnWorldBeginPlay (e.g. when spawned lazily); bind on first use instead.
+	BindNavigationEvents();
+
+	auto QueryNavMesh = [&](FVector& OutProjected)
+	{
+		if (bOutQueriedNavMesh)
+		{
+			*bOutQueriedNavMesh = true;
+		}
+
+		FNavLocation Projected;
+		if (NavSys->ProjectPointToNavigation(Point, Projected, Extent))
+		{
+			OutProjected = Projected.Location;
+			return true;
+		}
+		return false;
+	};
+
+	if (GetNavProjectionCacheEnabledCVar().GetValueOnGameThread() == 0)
+	{
+		return QueryNavMesh(OutLocation);
+	}
+
+	const float CellSize = FMath::Max(1.f, GetNavProjectionCacheCellSizeCVar().GetValueOnGameThread());
+
+	FCacheKey Key;
+	Key.Cell = FIntVector(QuantizeAxis(Point.X, CellSize), QuantizeAxis(Point.Y, CellSize), QuantizeAxis(Point.Z, CacheZBandSize));
+	Key.ExtentBucket = FIntVector(BucketExtentAxis(Extent.X), BucketExtentAxis(Extent.Y), BucketExtentAxis(Extent.Z));
+
+	if (const FCacheEntry* Cached = Entries.Find(Key))
+	{
+		++NumHits;
+		if (Cached->bOnNavMesh)
+		{
+			OutLocation = Cached->Location;
+		}
+		return Cached->bOnNavMesh;
+	}
+
+	if (Entries.Num() >= FMath::Max(1, GetNavProjectionCacheMaxEntriesCVar().GetValueOnGameThread()))
+	{
+		Invalidate();
+	}
+
+	++NumMisses;
+
+	FCacheEntry& Entry = Entries.Add(Key);
+	Entry.bOnNavMesh = QueryNavMesh(Entry.Location);
+	if (Entry.bOnNavMesh)
+	{
+		OutLocation = Entry.Location;
+	}
+	return Entry.bOnNavMesh;
+}
@@ -0,0 +1,329 @@
+#include "Systems/AeyerjiReplicationGraph.h"
+
+#include "Abilities/EliteBurningTrail/EliteBurningTrailPatch.h"
+#include "Enemy/EnemyParentNative.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Inventory/AeyerjiLootPickup.h"
+#include "Player/PlayerParentNative.h"
+#include "Projectiles/AeyerjiProjectile_RangedBasic.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+#include "World/ItemPickup.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAeyerjiRepGraph, Log, All);
+
+namespace
+{
+	static TAutoConsoleVariable<int32>& GetReplicationGraphEnabledCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Net.ReplicationGraph"),
+			1,
+			TEXT("1 = game net drivers use UAeyerjiReplicationGraph. 0 = default per-actor relevancy. Read when the net driver is created."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetGridCellSizeCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Net.GridCellSize"),
+			10000.f,
+			TEXT("Cell size (uu) of the replication graph spatial grid. Read when the graph is created."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<float>& GetGridSpatialBiasCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Net.GridSpatialBias"),
+			-200000.f,
+			TEXT("X/Y origin (uu) of the replication graph spatial grid; should sit below the smallest map coordinate."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	bool IsSpatialized(EAeyerjiClassRepNodeMapping Mapping)
+	{
+		return Mapping >= EAeyerjiClassRepNodeMapping::Spatialize_Static;
+	}
+
+	/** Handle of the binding RegisterCreateDriverDelegate made; invalid when another module owns the delegate. */
+	FDelegateHandle CreateDriverDelegateHandle;
+
+	UReplicationDriver* ConditionalCreateReplicationGraph(UNetDriver* ForNetDriver, UWorld* World)
+	{
+		if (GetReplicationGraphEnabledCVar().GetValueOnGameThread() == 0)
+		{
+			return nullptr;
+		}
+
+		// Only the game net driver; beacons and demo drivers keep their own relevancy.
+		if (!ForNetDriver || ForNetDriver->NetDriverName != NAME_GameNetDriver)
+		{
+			return nullptr;
+		}
+
+		if (!World || (World->WorldType != EWorldType::Game && World->WorldType != EWorldType::PIE))
+		{
+			return nullptr;
+		}
+
+		UE_LOG(LogAeyerjiRepGraph, Log, TEXT("Creating replication graph for %s"), *World->GetName());
+		return NewObject<UAeyerjiReplicationGraph>(GetTransientPackage());
+	}
+}
+
+void UAeyerjiReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	Super::GatherActorListsForConnection(Params);
+
+	OwnerActorList.Reset();
+
+	UNetConnection* Connection = Params.ConnectionManager.NetConnection;
+	if (const APlayerController* PC = Connection ? Connection->PlayerController.Get() : nullptr)
+	{
+		// The view target is usually the pawn already; keep it (and its inventory component) even when the camera
+		// is looking elsewhere.
+		if (APawn* Pawn = PC->GetPawn())
+		{
+			OwnerActorList.Add(Pawn);
+		}
+	}
+
+	if (OwnerOnlyActors)
+	{
+		for (const TWeakObjectPtr<AActor>& ActorPtr : *OwnerOnlyActors)
+		{
+			AActor* Actor = ActorPtr.Get();
+			if (Actor && Actor->GetNetConnection() == Connection)
+			{
+				OwnerActorList.Add(Actor);
+			}
+		}
+	}
+
+	if (OwnerActorList.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(OwnerActorList);
+	}
+}
+
+void UAeyerjiReplicationGraph::RegisterCreateDriverDelegate()
+{
+	// The delegate decides per net driver whether a graph is used.
+	if (!UReplicationDriver::CreateReplicationDriverDelegate().IsBound())
+	{
+		UReplicationDriver::CreateReplicationDriverDelegate().BindLambda(
+			[](UNetDriver* ForNetDriver, const FURL& URL, UWorld* World) -> UReplicationDriver*
+			{
+				return ConditionalCreateReplicationGraph(ForNetDriver, World);
+			});
+		CreateDriverDelegateHandle = UReplicationDriver::CreateReplicationDriverDelegate().GetHandle();
+	}
+}
+
+void UAeyerjiReplicationGraph::UnregisterCreateDriverDelegate()
+{
+	// Leave a binding made by another module or plugin alone.
+	auto& Delegate = UReplicationDriver::CreateReplicationDriverDelegate();
+	if (CreateDriverDelegateHandle.IsValid() && Delegate.GetHandle() == CreateDriverDelegateHandle)
+	{
+		Delegate.Unbind();
+	}
+	CreateDriverDelegateHandle.Reset();
+}
+
+void UAeyerjiReplicationGraph::ResetGameWorldState()
+{
+	Super::ResetGameWorldState();
+
+	OwnerOnlyActors.Reset();
+}
+
+void UAeyerjiReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// Game classes with a known lifetime; everything else falls back to ComputeDefaultMappingPolicy.
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), EAeyerjiClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), EAeyerjiClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerParentNative::StaticClass(), EAeyerjiClassRepNodeMapping::Spatialize_Dynamic);
+	ClassRepNodePolicies.Set(AAeyerjiProjectile_RangedBasic::StaticClass(), EAeyerjiClassRepNodeMapping::Spatialize_Dynamic);
+	ClassRepNodePolicies.Set(AEliteBurningTrailPatch::StaticClass(), EAeyerjiClassRepNodeMapping::Spatialize_Static);
+	ClassRepNodePolicies.Set(AEnemyParentNative::StaticClass(), EAeyerjiClassRepNodeMapping::Spatialize_Dormancy);
+	ClassRepNodePolicies.Set(AAeyerjiLootPickup::StaticClass(), EAeyerjiClassRepNodeMapping::Spatialize_Dormancy);
+	ClassRepNodePolicies.Set(AItemPickup::StaticClass(), EAeyerjiClassRepNodeMapping::Spatialize_Dormancy);
+
+	// Blueprint classes loaded later inherit the class info of their nearest configured parent.
+	int32 NumConfigured = 0;
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (!Class->IsChildOf(AActor::StaticClass()) || Class->HasAnyClassFlags(CLASS_NewerVersionExists | CLASS_Deprecated))
+		{
+			continue;
+		}
+
+		const FString ClassName = Class->GetName();
+		if (ClassName.StartsWith(TEXT("SKEL_")) || ClassName.StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const AActor* CDO = Class->GetDefaultObject<AActor>();
+		if (!CDO || !CDO->GetIsReplicated())
+		{
+			continue;
+		}
+
+		FClassReplicationInfo Info;
+		InitClassReplicationInfo(Info, Class, IsSpatialized(GetMappingPolicy(Class)));
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, Info);
+		++NumConfigured;
+	}
+
+	UE_LOG(LogAeyerjiRepGraph, Verbose, TEXT("InitGlobalActorClassSettings: configured %d replicated actor classes"), NumConfigured);
+}
+
+void UAeyerjiReplicationGraph::InitGlobalGraphNodes()
+{
+	const float SpatialBias = GetGridSpatialBiasCVar().GetValueOnGameThread();
+
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = FMath::Max(1000.f, GetGridCellSizeCVar().GetValueOnGameThread());
+	GridNode->SpatialBias = FVector2D(SpatialBias, SpatialBias);
+
+	// Actors outside the biased grid are clamped into the edge cells instead of rebuilding the whole grid.
+	GridNode->AddToClassRebuildDenyList(AActor::StaticClass());
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void UAeyerjiReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UAeyerjiReplicationGraphNode_AlwaysRelevant_ForConnection* ConnectionNode = CreateNewNode<UAeyerjiReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	ConnectionNode->OwnerOnlyActors = &OwnerOnlyActors;
+	AddConnectionGraphNode(ConnectionNode, RepGraphConnection);
+}
+
+void UAeyerjiReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EAeyerjiClassRepNodeMapping::RelevantAllConnections:
+		// The actor list filters streaming-level actors by client level visibility on its own.
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::OwnerOnly:
+		OwnerOnlyActors.AddUnique(ActorInfo.Actor);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::Spatialize_Static:
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::Spatialize_Dynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::Spatialize_Dormancy:
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UAeyerjiReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EAeyerjiClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::OwnerOnly:
+		OwnerOnlyActors.RemoveSwap(ActorInfo.Actor);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::Spatialize_Static:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::Spatialize_Dynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+
+	case EAeyerjiClassRepNodeMapping::Spatialize_Dormancy:
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+		break;
+
+	default:
+		break;
+	}
+}
+
+EAeyerjiClassRepNodeMapping UAeyerjiReplicationGraph::GetMappingPolicy(const UClass* Class)
+{
+	if (const EAeyerjiClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class))
+	{
+		return *Policy;
+	}
+
+	const EAeyerjiClassRepNodeMapping Policy = ComputeDefaultMappingPolicy(Class);
+	ClassRepNodePolicies.Set(Class, Policy);
+	return Policy;
+}
+
+EAeyerjiClassRepNodeMapping UAeyerjiReplicationGraph::ComputeDefaultMappingPolicy(const UClass* Class) const
+{
+	const AActor* CDO = Class ? Class->GetDefaultObject<AActor>() : nullptr;
+	if (!CDO || !CDO->GetIsReplicated())
+	{
+		return EAeyerjiClassRepNodeMapping::NotRouted;
+	}
+
+	if (CDO->bOnlyRelevantToOwner)
+	{
+		return EAeyerjiClassRepNodeMapping::OwnerOnly;
+	}
+
+	// Rootless actors (infos, managers) have no meaningful location to spatialize on.
+	if (CDO->bAlwaysRelevant || !CDO->GetRootComponent())
+	{
+		return EAeyerjiClassRepNodeMapping::RelevantAllConnections;
+	}
+
+	const USceneComponent* Root = CDO->GetRootComponent();
+	return Root->Mobility == EComponentMobility::Static
+		? EAeyerjiClassRepNodeMapping::Spatialize_Static
+		: EAeyerjiClassRepNodeMapping::Spatialize_Dynamic;
+}
+
+void UAeyerjiReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const
+{
+	const AActor* CDO = Class->GetDefaultObject<AActor>();
+	if (bSpatialize)
+	{
+		Info.SetCullDistanceSquared(CDO->GetNetCullDistanceSquared());
+	}
+
+	Info.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(CDO->GetNetUpdateFrequency());
+}
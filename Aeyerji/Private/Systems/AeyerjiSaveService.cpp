@@ -0,0 +1,796 @@
+#include "Systems/AeyerjiSaveService.h"
+#include "Systems/AeyerjiSaveSectionVersion.h"
+
+#include "Aeyerji/AeyerjiSaveGame.h"
+#include "Async/Async.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+#include "Serialization/StructuredArchiveAdapters.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "Attributes/AeyerjiAttributeSet.h"
+#include "Misc/AutomationTest.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogAeyerjiSave, Log, All);
+
+const FGuid FAeyerjiSaveSectionVersion::GUID(0x5A3C91E4, 0x2B7D4F08, 0x9E61A3C5, 0x47D0B812);
+
+int32 FAeyerjiSaveSectionVersion::Get(const FArchive& Ar)
+{
+	const FCustomVersion* Version = Ar.GetCustomVersions().GetVersion(GUID);
+	return Version ? Version->Version : INDEX_NONE;
+}
+
+namespace
+{
+	constexpr int32 SaveUserIndex = 0;
+
+	/** 'AJSV'. Legacy SaveGameToSlot files start with the FSaveGameHeader tag instead. */
+	constexpr uint32 SectionedSaveMagic = 0x56534A41;
+	constexpr int32 SectionedSaveFormatVersion = 1;
+	constexpr int32 NumSaveSections = static_cast<int32>(EAeyerjiSaveSection::Count);
+
+	/** Upper bound on properties per section; guards against reading garbage counts from a damaged file. */
+	constexpr int32 MaxPropertiesPerSection = 64;
+
+	TConstArrayView<FName> GetSectionProperties(EAeyerjiSaveSection Section)
+	{
+		static const FName InventoryProps[] = { GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, Inventory) };
+		static const FName AttributeProps[] = { GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, Attributes) };
+		static const FName ActionBarProps[] = {
+			GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, ActionBar),
+			GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, SelectedPassiveId) };
+		static const FName LootStatsProps[] = { GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, LootStats) };
+		static const FName RunRecordProps[] = {
+			GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, DifficultySlider),
+			GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, bHasDifficultySelection),
+			GET_MEMBER_NAME_CHECKED(UAeyerjiSaveGame, BestRunTimeSecondsByDifficulty) };
+
+		switch (Section)
+		{
+		case EAeyerjiSaveSection::Inventory:	return InventoryProps;
+		case EAeyerjiSaveSection::Attributes:	return AttributeProps;
+		case EAeyerjiSaveSection::ActionBar:	return ActionBarProps;
+		case EAeyerjiSaveSection::LootStats:	return LootStatsProps;
+		case EAeyerjiSaveSection::RunRecords:	return RunRecordProps;
+		default:								return {};
+		}
+	}
+
+	/**
+	 * Section payload: per property its name, C++ type and value bytes. Values go through FProperty::SerializeItem,
+	 * so nested structs use tagged serialization and tolerate added/removed fields; a renamed or retyped top-level
+	 * property is skipped on load instead of corrupting its neighbours.
+	 */
+	bool SerializeSection(const UAeyerjiSaveGame& Save, EAeyerjiSaveSection Section, int32 Version, TArray<uint8>& OutPayload)
+	{
+		const TConstArrayView<FName> PropertyNames = GetSectionProperties(Section);
+
+		FMemoryWriter Writer(OutPayload, /*bIsPersistent=*/true);
+		int32 NumProperties = PropertyNames.Num();
+		Writer << NumProperties;
+
+		for (const FName PropertyName : PropertyNames)
+		{
+			FProperty* Property = FindFProperty<FProperty>(UAeyerjiSaveGame::StaticClass(), PropertyName);
+			if (!ensureMsgf(Property, TEXT("Save section property %s not found"), *PropertyName.ToString()))
+			{
+				return false;
+			}
+
+			TArray<uint8> Value;
+			{
+				FMemoryWriter ValueWriter(Value, /*bIsPersistent=*/true);
+				ValueWriter.SetCustomVersion(FAeyerjiSaveSectionVersion::GUID, Version, TEXT("AeyerjiSaveSection"));
+				FObjectAndNameAsStringProxyArchive ValueAr(ValueWriter, /*bInLoadIfFindFails=*/false);
+				// Only SaveGame-flagged fields of nested structs are written, as the UPROPERTY(SaveGame) markup intends.
+				ValueAr.ArIsSaveGame = Version >= FAeyerjiSaveSectionVersion::SaveGameArchive;
+				FStructuredArchiveFromArchive Adapter(ValueAr);
+				Property->SerializeItem(Adapter.GetSlot(), Property->ContainerPtrToValuePtr<void>(const_cast<UAeyerjiSaveGame*>(&Save)), nullptr);
+			}
+
+			FString Name = PropertyName.ToString();
+			FString Type = Property->GetCPPType();
+			Writer << Name << Type << Value;
+		}
+
+		return !Writer.IsError();
+	}
+
+	void ResetSectionToDefaults(UAeyerjiSaveGame& Save, EAeyerjiSaveSection Section)
+	{
+		const UAeyerjiSaveGame* Defaults = GetDefault<UAeyerjiSaveGame>();
+		for (const FName PropertyName : GetSectionProperties(Section))
+		{
+			if (const FProperty* Property = FindFProperty<FProperty>(UAeyerjiSaveGame::StaticClass(), PropertyName))
+			{
+				Property->CopyCompleteValue_InContainer(&Save, Defaults);
+			}
+		}
+	}
+
+	bool DeserializeSection(UAeyerjiSaveGame& Save, EAeyerjiSaveSection Section, int32 Version, const TArray<uint8>& Payload, const FString& Slot)
+	{
+		FMemoryReader Reader(Payload, /*bIsPersistent=*/true);
+		int32 NumProperties = 0;
+		Reader << NumProperties;
+		if (Reader.IsError() || NumProperties < 0 || NumProperties > MaxPropertiesPerSection)
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < NumProperties; ++Index)
+		{
+			FString Name;
+			FString Type;
+			TArray<uint8> Value;
+			Reader << Name << Type << Value;
+			if (Reader.IsError())
+			{
+				return false;
+			}
+
+			FProperty* Property = FindFProperty<FProperty>(UAeyerjiSaveGame::StaticClass(), FName(*Name));
+			if (!Property || Property->GetCPPType() != Type)
+			{
+				UE_LOG(LogAeyerjiSave, Warning, TEXT("DeserializeSection: Slot %s section %d dropped property %s (%s); no longer matches the save class."),
+					*Slot, static_cast<int32>(Section), *Name, *Type);
+				continue;
+			}
+
+			FMemoryReader ValueReader(Value, /*bIsPersistent=*/true);
+			ValueReader.SetCustomVersion(FAeyerjiSaveSectionVersion::GUID, Version, TEXT("AeyerjiSaveSection"));
+			FObjectAndNameAsStringProxyArchive ValueAr(ValueReader, /*bInLoadIfFindFails=*/true);
+			ValueAr.ArIsSaveGame = Version >= FAeyerjiSaveSectionVersion::SaveGameArchive;
+			FStructuredArchiveFromArchive Adapter(ValueAr);
+			Property->SerializeItem(Adapter.GetSlot(), Property->ContainerPtrToValuePtr<void>(&Save), nullptr);
+			if (ValueAr.IsError())
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static TAutoConsoleVariable<float>& GetSaveCoalesceSecondsCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<float>* CVar = new TAutoConsoleVariable<float>(
+			TEXT("aeyerji.Save.CoalesceSeconds"),
+			1.0f,
+			TEXT("Seconds a save request waits for further requests to the same slot before it is written."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<int32>& GetSaveAsyncCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Save.Async"),
+			1,
+			TEXT("1 = serialize and write character saves on a background task. 0 = write immediately on the game thread."),
+			ECVF_Default);
+		return *CVar;
+	}
+}
+
+UAeyerjiSaveService* UAeyerjiSaveService::Get()
+{
+	return GEngine ? GEngine->GetEngineSubsystem<UAeyerjiSaveService>() : nullptr;
+}
+
+void UAeyerjiSaveService::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Register the cvars up front so they show up in the console before the first save.
+	GetSaveCoalesceSecondsCVar();
+	GetSaveAsyncCVar();
+}
+
+void UAeyerjiSaveService::Deinitialize()
+{
+	FlushPendingSaves(/*bBlock=*/true);
+
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	LatestSnapshots.Reset();
+	InFlightSnapshots.Reset();
+	SectionCaches.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAeyerjiSaveService::RequestSave(const UAeyerjiSaveGame* Data, const FString& Slot)
+{
+	check(IsInGameThread());
+
+	if (!Data || Slot.IsEmpty())
+	{
+		return false;
+	}
+
+	// The snapshot is owned by the service and never mutated again, so the background task can read it freely.
+	UAeyerjiSaveGame* Snapshot = DuplicateObject<UAeyerjiSaveGame>(Data, this);
+	if (!Snapshot)
+	{
+		return false;
+	}
+	Snapshot->CopySectionRevisionsFrom(*Data);
+
+	LatestSnapshots.Add(Slot, Snapshot);
+
+	if (GetSaveAsyncCVar().GetValueOnGameThread() == 0)
+	{
+		DirtySlots.Remove(Slot);
+		WaitForWrite(Slot);
+		return WriteSynchronously(Slot, Snapshot);
+	}
+
+	// Keep the first deadline: a steady stream of requests must not postpone the write forever.
+	const double DueTime = FPlatformTime::Seconds() + FMath::Max(0.f, GetSaveCoalesceSecondsCVar().GetValueOnGameThread());
+	DirtySlots.FindOrAdd(Slot, DueTime);
+
+	EnsureFlushTicker();
+	return true;
+}
+
+UAeyerjiSaveGame* UAeyerjiSaveService::CopyLatestSave(const FString& Slot, UObject* Outer) const
+{
+	const UAeyerjiSaveGame* Latest = PeekLatestSave(Slot);
+	if (!Latest)
+	{
+		return nullptr;
+	}
+
+	UAeyerjiSaveGame* Copy = DuplicateObject<UAeyerjiSaveGame>(Latest, Outer ? Outer : GetTransientPackage());
+	if (Copy)
+	{
+		// Keeps unchanged sections matching the cached bytes when the copy is saved again.
+		Copy->CopySectionRevisionsFrom(*Latest);
+	}
+	return Copy;
+}
+
+const UAeyerjiSaveGame* UAeyerjiSaveService::PeekLatestSave(const FString& Slot) const
+{
+	const TObjectPtr<UAeyerjiSaveGame>* Found = LatestSnapshots.Find(Slot);
+	return Found ? Found->Get() : nullptr;
+}
+
+UAeyerjiSaveGame* UAeyerjiSaveService::LoadSave(const FString& Slot)
+{
+	if (UAeyerjiSaveGame* Cached = CopyLatestSave(Slot))
+	{
+		return Cached;
+	}
+
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (!SaveSystem || Slot.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	TArray<uint8> Bytes;
+	if (!SaveSystem->LoadGame(false, *Slot, SaveUserIndex, Bytes))
+	{
+		return nullptr;
+	}
+
+	return DecodeLoadedBytes(Slot, Bytes);
+}
+
+void UAeyerjiSaveService::RequestLoad(const FString& Slot, FOnSaveLoadedNative OnLoaded)
+{
+	if (UAeyerjiSaveGame* Cached = CopyLatestSave(Slot))
+	{
+		OnLoaded.ExecuteIfBound(Cached);
+		return;
+	}
+
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (!SaveSystem || Slot.IsEmpty())
+	{
+		OnLoaded.ExecuteIfBound(nullptr);
+		return;
+	}
+
+	TWeakObjectPtr<UAeyerjiSaveService> WeakThis(this);
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Slot, SaveSystem, OnLoaded]()
+	{
+		TArray<uint8> Bytes;
+		const bool bRead = SaveSystem->LoadGame(false, *Slot, SaveUserIndex, Bytes);
+
+		// Decoding resolves object paths and creates UObjects, so it has to happen on the game thread.
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Slot, OnLoaded, bRead, Bytes = MoveTemp(Bytes)]()
+		{
+			UAeyerjiSaveService* Service = WeakThis.Get();
+			if (!Service)
+			{
+				OnLoaded.ExecuteIfBound(nullptr);
+				return;
+			}
+
+			// A save requested while the read was in flight is newer than what came off disk.
+			if (UAeyerjiSaveGame* Newer = Service->CopyLatestSave(Slot))
+			{
+				OnLoaded.ExecuteIfBound(Newer);
+				return;
+			}
+
+			OnLoaded.ExecuteIfBound(bRead ? Service->DecodeLoadedBytes(Slot, Bytes) : nullptr);
+		});
+	});
+}
+
+UAeyerjiSaveGame* UAeyerjiSaveService::DecodeLoadedBytes(const FString& Slot, const TArray<uint8>& Bytes)
+{
+	FSlotSectionCache Decoded;
+	Decoded.Sections.SetNum(NumSaveSections);
+
+	UAeyerjiSaveGame* Save = DecodeSave(Bytes, Slot, Decoded);
+
+	// Seed the byte cache so the first save after a load only re-serializes what actually changed.
+	if (Save && !InFlight.Contains(Slot))
+	{
+		*FindOrAddSectionCache(Slot) = MoveTemp(Decoded);
+	}
+
+	return Save;
+}
+
+UAeyerjiSaveService::FSlotSectionCacheRef UAeyerjiSaveService::FindOrAddSectionCache(const FString& Slot)
+{
+	TSharedPtr<FSlotSectionCache, ESPMode::ThreadSafe>& Cache = SectionCaches.FindOrAdd(Slot);
+	if (!Cache.IsValid())
+	{
+		Cache = MakeShared<FSlotSectionCache, ESPMode::ThreadSafe>();
+		Cache->Sections.SetNum(NumSaveSections);
+	}
+	return Cache.ToSharedRef();
+}
+
+int32 UAeyerjiSaveService::GetSectionVersion(EAeyerjiSaveSection Section)
+{
+	switch (Section)
+	{
+	case EAeyerjiSaveSection::Inventory:	return FAeyerjiSaveSectionVersion::SaveGameArchive;
+	case EAeyerjiSaveSection::Attributes:	return FAeyerjiSaveSectionVersion::SaveGameArchive;
+	case EAeyerjiSaveSection::ActionBar:	return FAeyerjiSaveSectionVersion::SaveGameArchive;
+	case EAeyerjiSaveSection::LootStats:	return FAeyerjiSaveSectionVersion::SaveGameArchive;
+	case EAeyerjiSaveSection::RunRecords:	return FAeyerjiSaveSectionVersion::SaveGameArchive;
+	default:								return 0;
+	}
+}
+
+bool UAeyerjiSaveService::EncodeSave(const UAeyerjiSaveGame& Save, FSlotSectionCache& Cache, TArray<uint8>& OutBytes, int32& OutSectionsSerialized)
+{
+	OutSectionsSerialized = 0;
+	Cache.Sections.SetNum(NumSaveSections);
+
+	for (const EAeyerjiSaveSection Section : TEnumRange<EAeyerjiSaveSection>())
+	{
+		FSectionBlob& Blob = Cache.Sections[static_cast<int32>(Section)];
+		const uint64 Revision = Save.GetSectionRevision(Section);
+		const int32 Version = GetSectionVersion(Section);
+
+		if (Revision != 0 && Blob.Revision == Revision && Blob.Version == Version)
+		{
+			continue;
+		}
+
+		TArray<uint8> Payload;
+		if (!SerializeSection(Save, Section, Version, Payload))
+		{
+			return false;
+		}
+
+		Blob.Revision = Revision;
+		Blob.Version = Version;
+		Blob.Crc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+		Blob.Payload = MoveTemp(Payload);
+		++OutSectionsSerialized;
+	}
+
+	FMemoryWriter Writer(OutBytes, /*bIsPersistent=*/true);
+
+	uint32 Magic = SectionedSaveMagic;
+	int32 FormatVersion = SectionedSaveFormatVersion;
+	int32 NumSections = NumSaveSections;
+	Writer << Magic << FormatVersion << NumSections;
+
+	for (int32 Index = 0; Index < NumSections; ++Index)
+	{
+		FSectionBlob& Blob = Cache.Sections[Index];
+		uint8 SectionId = static_cast<uint8>(Index);
+		int32 PayloadSize = Blob.Payload.Num();
+		Writer << SectionId << Blob.Version << Blob.Crc << PayloadSize;
+		Writer.Serialize(Blob.Payload.GetData(), PayloadSize);
+	}
+
+	return !Writer.IsError();
+}
+
+UAeyerjiSaveGame* UAeyerjiSaveService::DecodeSave(const TArray<uint8>& Bytes, const FString& Slot, FSlotSectionCache& OutCache)
+{
+	FMemoryReader Reader(Bytes, /*bIsPersistent=*/true);
+
+	uint32 Magic = 0;
+	if (Bytes.Num() >= static_cast<int32>(sizeof(Magic)))
+	{
+		Reader << Magic;
+	}
+
+	if (Magic != SectionedSaveMagic)
+	{
+		// Written by SaveGameToSlot before sections existed; every section gets captured fresh on the next save.
+		UAeyerjiSaveGame* Legacy = Cast<UAeyerjiSaveGame>(UGameplayStatics::LoadGameFromMemory(Bytes));
+		if (!Legacy)
+		{
+			UE_LOG(LogAeyerjiSave, Error, TEXT("DecodeSave: Slot %s is neither a sectioned nor a legacy Aeyerji save."), *Slot);
+		}
+		return Legacy;
+	}
+
+	int32 FormatVersion = 0;
+	int32 NumSections = 0;
+	Reader << FormatVersion << NumSections;
+	if (Reader.IsError() || FormatVersion > SectionedSaveFormatVersion || NumSections < 0)
+	{
+		UE_LOG(LogAeyerjiSave, Error, TEXT("DecodeSave: Slot %s has unsupported format %d."), *Slot, FormatVersion);
+		return nullptr;
+	}
+
+	UAeyerjiSaveGame* Save = NewObject<UAeyerjiSaveGame>(GetTransientPackage());
+
+	for (int32 Index = 0; Index < NumSections; ++Index)
+	{
+		uint8 SectionId = 0;
+		int32 Version = 0;
+		uint32 Crc = 0;
+		int32 PayloadSize = 0;
+		Reader << SectionId << Version << Crc << PayloadSize;
+
+		if (Reader.IsError() || PayloadSize < 0 || PayloadSize > Reader.TotalSize() - Reader.Tell())
+		{
+			UE_LOG(LogAeyerjiSave, Warning, TEXT("DecodeSave: Slot %s is truncated after %d sections; remaining sections use defaults."), *Slot, Index);
+			break;
+		}
+
+		TArray<uint8> Payload;
+		Payload.SetNumUninitialized(PayloadSize);
+		Reader.Serialize(Payload.GetData(), PayloadSize);
+
+		if (SectionId >= NumSaveSections)
+		{
+			continue; // Written by a newer build.
+		}
+
+		const EAeyerjiSaveSection Section = static_cast<EAeyerjiSaveSection>(SectionId);
+		if (Version > GetSectionVersion(Section))
+		{
+			UE_LOG(LogAeyerjiSave, Warning, TEXT("DecodeSave: Slot %s section %d has version %d (supported %d); using defaults."),
+				*Slot, SectionId, Version, GetSectionVersion(Section));
+			continue;
+		}
+
+		if (FCrc::MemCrc32(Payload.GetData(), Payload.Num()) != Crc)
+		{
+			UE_LOG(LogAeyerjiSave, Warning, TEXT("DecodeSave: Slot %s section %d failed its checksum; using defaults."), *Slot, SectionId);
+			continue;
+		}
+
+		if (!DeserializeSection(*Save, Section, Version, Payload, Slot))
+		{
+			UE_LOG(LogAeyerjiSave, Warning, TEXT("DecodeSave: Slot %s section %d could not be decoded; using defaults."), *Slot, SectionId);
+			ResetSectionToDefaults(*Save, Section);
+			continue;
+		}
+
+		const uint64 Revision = UAeyerjiSaveGame::MakeSectionRevision();
+		Save->SetSectionRevision(Section, Revision);
+
+		// Older section versions are re-serialized (upgraded) on the next write instead of being copied through.
+		if (Version == GetSectionVersion(Section))
+		{
+			FSectionBlob& Blob = OutCache.Sections[SectionId];
+			Blob.Revision = Revision;
+			Blob.Version = Version;
+			Blob.Crc = Crc;
+			Blob.Payload = MoveTemp(Payload);
+		}
+	}
+
+	return Save;
+}
+
+void UAeyerjiSaveService::FlushPendingSaves(bool bBlock)
+{
+	TArray<FString> Pending;
+	DirtySlots.GetKeys(Pending);
+
+	for (const FString& Slot : Pending)
+	{
+		if (InFlight.Contains(Slot))
+		{
+			if (!bBlock)
+			{
+				continue; // Picked up by the ticker once the current write lands.
+			}
+			WaitForWrite(Slot);
+		}
+		StartWrite(Slot);
+	}
+
+	if (bBlock)
+	{
+		TArray<FString> Writing;
+		InFlight.GetKeys(Writing);
+		for (const FString& Slot : Writing)
+		{
+			WaitForWrite(Slot);
+		}
+	}
+}
+
+void UAeyerjiSaveService::EnsureFlushTicker()
+{
+	if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UAeyerjiSaveService::TickFlush));
+	}
+}
+
+bool UAeyerjiSaveService::TickFlush(float /*DeltaTime*/)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<FString, TInlineAllocator<4>> Ready;
+	for (const TPair<FString, double>& Pair : DirtySlots)
+	{
+		if (Pair.Value <= Now && !InFlight.Contains(Pair.Key))
+		{
+			Ready.Add(Pair.Key);
+		}
+	}
+
+	for (const FString& Slot : Ready)
+	{
+		StartWrite(Slot);
+	}
+
+	if (DirtySlots.IsEmpty())
+	{
+		FlushTickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void UAeyerjiSaveService::StartWrite(const FString& Slot)
+{
+	check(!InFlight.Contains(Slot));
+
+	DirtySlots.Remove(Slot);
+
+	UAeyerjiSaveGame* Snapshot = LatestSnapshots.FindRef(Slot);
+	if (!Snapshot)
+	{
+		return;
+	}
+
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+	if (!SaveSystem)
+	{
+		UE_LOG(LogAeyerjiSave, Error, TEXT("StartWrite: No save game system available; slot %s not written."), *Slot);
+		OnSaveCompleted.Broadcast(Slot, false);
+		return;
+	}
+
+	InFlightSnapshots.Add(Snapshot);
+
+	FInFlightWrite& Write = InFlight.Add(Slot);
+	Write.Snapshot = Snapshot;
+	Write.Serial = NextWriteSerial++;
+
+	const uint32 Serial = Write.Serial;
+	const FSlotSectionCacheRef SectionCache = FindOrAddSectionCache(Slot);
+	TWeakObjectPtr<UAeyerjiSaveService> WeakThis(this);
+
+	Write.Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakThis, Slot, Serial, Snapshot, SaveSystem, SectionCache]()
+	{
+		TArray<uint8> Bytes;
+		bool bSerialized = false;
+		int32 SectionsSerialized = 0;
+		{
+			// Block GC while the archive walks the snapshot's references (item definitions, ability classes).
+			FGCScopeGuard GCGuard;
+			bSerialized = EncodeSave(*Snapshot, *SectionCache, Bytes, SectionsSerialized);
+		}
+
+		const bool bSuccess = bSerialized && SaveSystem->SaveGame(false, *Slot, SaveUserIndex, Bytes);
+
+		UE_LOG(LogAeyerjiSave, Verbose, TEXT("StartWrite: Slot %s re-serialized %d/%d sections (%d bytes)."),
+			*Slot, SectionsSerialized, NumSaveSections, Bytes.Num());
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Slot, Serial, bSuccess]()
+		{
+			if (UAeyerjiSaveService* Service = WeakThis.Get())
+			{
+				Service->HandleWriteFinished(Slot, Serial, bSuccess);
+			}
+		});
+
+		return bSuccess;
+	});
+}
+
+void UAeyerjiSaveService::WaitForWrite(const FString& Slot)
+{
+	if (FInFlightWrite* Write = InFlight.Find(Slot))
+	{
+		Write->Task.Wait();
+		// The queued game-thread completion sees a stale serial and becomes a no-op.
+		HandleWriteFinished(Slot, Write->Serial, Write->Task.GetResult());
+	}
+}
+
+void UAeyerjiSaveService::HandleWriteFinished(const FString& Slot, uint32 Serial, bool bSuccess)
+{
+	const FInFlightWrite* Write = InFlight.Find(Slot);
+	if (!Write || Write->Serial != Serial)
+	{
+		return;
+	}
+
+	InFlightSnapshots.RemoveSingleSwap(Write->Snapshot);
+	InFlight.Remove(Slot);
+
+	if (bSuccess)
+	{
+		UE_LOG(LogAeyerjiSave, Verbose, TEXT("HandleWriteFinished: Slot %s written."), *Slot);
+	}
+	else
+	{
+		UE_LOG(LogAeyerjiSave, Error, TEXT("HandleWriteFinished: Save failed for slot %s"), *Slot);
+	}
+
+	OnSaveCompleted.Broadcast(Slot, bSuccess);
+
+	if (DirtySlots.Contains(Slot))
+	{
+		EnsureFlushTicker();
+	}
+}
+
+bool UAeyerjiSaveService::WriteSynchronously(const FString& Slot, UAeyerjiSaveGame* Snapshot)
+{
+	ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+
+	TArray<uint8> Bytes;
+	int32 SectionsSerialized = 0;
+	const bool bSuccess = SaveSystem
+		&& EncodeSave(*Snapshot, *FindOrAddSectionCache(Slot), Bytes, SectionsSerialized)
+		&& SaveSystem->SaveGame(false, *Slot, SaveUserIndex, Bytes);
+	if (!bSuccess)
+	{
+		UE_LOG(LogAeyerjiSave, Error, TEXT("WriteSynchronously: Save failed for slot %s"), *Slot);
+	}
+
+	OnSaveCompleted.Broadcast(Slot, bSuccess);
+	return bSuccess;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAeyerjiSaveSectionRoundTripTest, "Aeyerji.Save.SectionRoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAeyerjiSaveSectionRoundTripTest::RunTest(const FString& Parameters)
+{
+	FItemStatModifier Modifier;
+	Modifier.Attribute = UAeyerjiAttributeSet::GetArmorAttribute();
+	Modifier.Op = EItemModOp::Multiplicative;
+	Modifier.Magnitude = 7.5f;
+
+	constexpr int32 Sentinel = 0x5E171E1;
+
+	// Legacy SaveGameToSlot blob: a tagged save-game stream with no section version, where FGameplayAttribute's fields
+	// are skipped. The native serializer must stay out of it, or the sentinel behind the struct is misread.
+	{
+		TArray<uint8> Bytes;
+		{
+			FMemoryWriter Writer(Bytes, /*bIsPersistent=*/true);
+			FObjectAndNameAsStringProxyArchive Ar(Writer, /*bInLoadIfFindFails=*/false);
+			Ar.ArIsSaveGame = true;
+			FItemStatModifier Defaults;
+			FStructuredArchiveFromArchive Adapter(Ar);
+			FItemStatModifier::StaticStruct()->SerializeTaggedProperties(Adapter.GetSlot(), reinterpret_cast<uint8*>(&Modifier),
+				FItemStatModifier::StaticStruct(), reinterpret_cast<uint8*>(&Defaults));
+		}
+		{
+			FMemoryWriter Writer(Bytes, /*bIsPersistent=*/true);
+			Writer.Seek(Bytes.Num());
+			int32 Tail = Sentinel;
+			Writer << Tail;
+		}
+
+		FItemStatModifier Loaded;
+		int32 Tail = 0;
+		FMemoryReader Reader(Bytes, /*bIsPersistent=*/true);
+		{
+			FObjectAndNameAsStringProxyArchive Ar(Reader, /*bInLoadIfFindFails=*/true);
+			Ar.ArIsSaveGame = true;
+			FStructuredArchiveFromArchive Adapter(Ar);
+			FItemStatModifier::StaticStruct()->SerializeItem(Adapter.GetSlot(), &Loaded, nullptr);
+		}
+		Reader << Tail;
+
+		TestFalse(TEXT("Legacy blob reads without error"), Reader.IsError());
+		TestEqual(TEXT("Legacy blob keeps the stream in sync"), Tail, Sentinel);
+		TestTrue(TEXT("Legacy blob op"), Loaded.Op == Modifier.Op);
+		TestEqual(TEXT("Legacy blob magnitude"), Loaded.Magnitude, Modifier.Magnitude);
+	}
+
+	// Section payloads: version 1 (tagged, no ArIsSaveGame) and the current version (attribute as property path).
+	for (const int32 Version : { static_cast<int32>(FAeyerjiSaveSectionVersion::Initial), static_cast<int32>(FAeyerjiSaveSectionVersion::LatestVersion) })
+	{
+		UAeyerjiSaveGame* Source = NewObject<UAeyerjiSaveGame>();
+		FInventoryItemSnapshot& Snapshot = Source->Inventory.ItemSnapshots.AddDefaulted_GetRef();
+		Snapshot.ItemId = FGuid::NewGuid();
+		Snapshot.FinalAggregatedModifiers.Add(Modifier);
+		Snapshot.FinalAggregatedModifiers.Add(Modifier);
+
+		TArray<uint8> Payload;
+		if (!TestTrue(FString::Printf(TEXT("v%d: serialize inventory section"), Version),
+			SerializeSection(*Source, EAeyerjiSaveSection::Inventory, Version, Payload)))
+		{
+			continue;
+		}
+
+		UAeyerjiSaveGame* Loaded = NewObject<UAeyerjiSaveGame>();
+		if (!TestTrue(FString::Printf(TEXT("v%d: deserialize inventory section"), Version),
+			DeserializeSection(*Loaded, EAeyerjiSaveSection::Inventory, Version, Payload, TEXT("AutomationTest"))))
+		{
+			continue;
+		}
+
+		if (!TestEqual(FString::Printf(TEXT("v%d: snapshot count"), Version), Loaded->Inventory.ItemSnapshots.Num(), 1))
+		{
+			continue;
+		}
+
+		const FInventoryItemSnapshot& LoadedSnapshot = Loaded->Inventory.ItemSnapshots[0];
+		TestEqual(FString::Printf(TEXT("v%d: item id"), Version), LoadedSnapshot.ItemId, Snapshot.ItemId);
+		TestEqual(FString::Printf(TEXT("v%d: modifier count"), Version), LoadedSnapshot.FinalAggregatedModifiers.Num(), 2);
+		for (const FItemStatModifier& LoadedModifier : LoadedSnapshot.FinalAggregatedModifiers)
+		{
+			TestTrue(FString::Printf(TEXT("v%d: attribute"), Version), LoadedModifier.Attribute == Modifier.Attribute);
+			TestTrue(FString::Printf(TEXT("v%d: op"), Version), LoadedModifier.Op == Modifier.Op);
+			TestEqual(FString::Printf(TEXT("v%d: magnitude"), Version), LoadedModifier.Magnitude, Modifier.Magnitude);
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
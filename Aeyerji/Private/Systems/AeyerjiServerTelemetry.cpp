@@ -0,0 +1,472 @@
+#include "Systems/AeyerjiServerTelemetry.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Director/AeyerjiEncounterDirector.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Inventory/AeyerjiLootPickup.h"
+#include "Items/InventoryComponent.h"
+#include "Items/ItemInstance.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Systems/AeyerjiLootRegistry.h"
+#include "Systems/LootService.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAeyerjiTelemetry, Log, All);
+
+namespace
+{
+	constexpr double TelemetrySampleIntervalSeconds = 1.0;
+	constexpr int32 TelemetryFlushEveryRows = 10;
+
+	static TAutoConsoleVariable<int32>& GetTelemetryEnableCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Telemetry.Enable"),
+			0,
+			TEXT("1 = servers start recording telemetry CSVs on world begin play (same as -AeyerjiTelemetry)."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<int32>& GetTelemetryRowsPerFileCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Telemetry.RowsPerFile"),
+			3600,
+			TEXT("Telemetry rows (seconds) written to one CSV before rotating to a new file."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	static TAutoConsoleVariable<int32>& GetTelemetryMaxFilesCVar()
+	{
+		// Intentionally leaked to avoid shutdown-order crashes when the console manager is destroyed.
+		static TAutoConsoleVariable<int32>* CVar = new TAutoConsoleVariable<int32>(
+			TEXT("aeyerji.Telemetry.MaxFiles"),
+			8,
+			TEXT("Number of telemetry CSVs kept on disk; older files are deleted on rotation."),
+			ECVF_Default);
+		return *CVar;
+	}
+
+	FString GetTelemetryDirectory()
+	{
+		return FPaths::ProfilingDir() / TEXT("Telemetry");
+	}
+
+	/** Nearest-rank percentile over an already sorted array. */
+	float SortedPercentile(const TArray<float>& Sorted, float Percentile)
+	{
+		if (Sorted.IsEmpty())
+		{
+			return 0.f;
+		}
+
+		const int32 Rank = FMath::CeilToInt32(Percentile * Sorted.Num()) - 1;
+		return Sorted[FMath::Clamp(Rank, 0, Sorted.Num() - 1)];
+	}
+
+	float ReadFloatCVar(const TCHAR* Name)
+	{
+		const IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name);
+		return CVar ? CVar->GetFloat() : 0.f;
+	}
+
+	int32 ReadIntCVar(const TCHAR* Name)
+	{
+		const IConsoleVariable* CVar = IConsoleManager::Get().FindConsoleVariable(Name);
+		return CVar ? CVar->GetInt() : 0;
+	}
+
+	void HandleTelemetryStartCommand(UWorld* World)
+	{
+		UAeyerjiServerTelemetry* Telemetry = UAeyerjiServerTelemetry::Get(World);
+		if (!Telemetry)
+		{
+			UE_LOG(LogAeyerjiTelemetry, Warning, TEXT("aeyerji.Telemetry.Start: no game world."));
+			return;
+		}
+
+		if (Telemetry->StartRecording())
+		{
+			UE_LOG(LogAeyerjiTelemetry, Display, TEXT("Telemetry recording to %s"), *Telemetry->GetCurrentFilePath());
+		}
+	}
+
+	void HandleTelemetryStopCommand(UWorld* World)
+	{
+		if (UAeyerjiServerTelemetry* Telemetry = UAeyerjiServerTelemetry::Get(World))
+		{
+			Telemetry->StopRecording();
+		}
+	}
+
+	void HandleTelemetryPrintCommand(UWorld* World)
+	{
+		const UAeyerjiServerTelemetry* Telemetry = UAeyerjiServerTelemetry::Get(World);
+		const FAeyerjiTelemetrySample* Sample = Telemetry ? Telemetry->GetLastSample() : nullptr;
+		if (!Sample)
+		{
+			UE_LOG(LogAeyerjiTelemetry, Display, TEXT("No telemetry sample yet (recording=%d)."), Telemetry && Telemetry->IsRecording() ? 1 : 0);
+			return;
+		}
+
+		UE_LOG(LogAeyerjiTelemetry, Display,
+			TEXT("t=%.0f enemies=%d pending=%d fixedQueue=%d killVel=%.2f loot/s=%.1f itemSubobjects=%d snapshots=%d ge/s=%.1f | frame ms p50=%.2f p95=%.2f p99=%.2f max=%.2f | gt ms p50=%.2f p95=%.2f | budget scale=%.2f cap=%d"),
+			Sample->WorldTimeSeconds, Sample->LiveEnemies, Sample->PendingSpawnRequests, Sample->FixedSpawnQueue,
+			Sample->KillVelocity, Sample->LootRollsPerSecond, Sample->ReplicatedItemSubobjects, Sample->InventoryItemSnapshots,
+			Sample->EffectApplicationsPerSecond, Sample->FrameMsP50, Sample->FrameMsP95, Sample->FrameMsP99, Sample->FrameMsMax,
+			Sample->GameThreadMsP50, Sample->GameThreadMsP95, Sample->BudgetScale, Sample->BudgetCap);
+	}
+
+	FAutoConsoleCommand GTelemetryStartCommand(
+		TEXT("aeyerji.Telemetry.Start"),
+		TEXT("Starts recording per-second server telemetry to Saved/Profiling/Telemetry."),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&HandleTelemetryStartCommand));
+
+	FAutoConsoleCommand GTelemetryStopCommand(
+		TEXT("aeyerji.Telemetry.Stop"),
+		TEXT("Stops telemetry recording and flushes the current CSV."),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&HandleTelemetryStopCommand));
+
+	FAutoConsoleCommand GTelemetryPrintCommand(
+		TEXT("aeyerji.Telemetry.Print"),
+		TEXT("Logs the latest telemetry sample."),
+		FConsoleCommandWithWorldDelegate::CreateStatic(&HandleTelemetryPrintCommand));
+}
+
+UAeyerjiServerTelemetry* UAeyerjiServerTelemetry::Get(const UObject* WorldContext)
+{
+	if (!WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<UAeyerjiServerTelemetry>() : nullptr;
+}
+
+bool UAeyerjiServerTelemetry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UAeyerjiServerTelemetry::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAeyerjiServerTelemetry, STATGROUP_Tickables);
+}
+
+bool UAeyerjiServerTelemetry::IsServerWorld() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+void UAeyerjiServerTelemetry::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	const bool bRequested = GetTelemetryEnableCVar().GetValueOnGameThread() != 0
+		|| FParse::Param(FCommandLine::Get(), TEXT("AeyerjiTelemetry"));
+	if (bRequested && IsServerWorld())
+	{
+		StartRecording();
+	}
+}
+
+void UAeyerjiServerTelemetry::Deinitialize()
+{
+	StopRecording();
+	Super::Deinitialize();
+}
+
+bool UAeyerjiServerTelemetry::StartRecording()
+{
+	if (!IsServerWorld())
+	{
+		UE_LOG(LogAeyerjiTelemetry, Warning, TEXT("StartRecording: telemetry only records on the server."));
+		return false;
+	}
+
+	if (bRecording)
+	{
+		return true;
+	}
+
+	bRecording = true;
+	bHasSample = false;
+
+	const UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	const ULootService* LootService = GameInstance ? GameInstance->GetSubsystem<ULootService>() : nullptr;
+	LastLootRollCount = LootService ? LootService->GetTotalRollCount() : 0;
+
+	BindAbilitySystems();
+	OpenNewFile();
+	ResetWindow(FPlatformTime::Seconds());
+	return true;
+}
+
+void UAeyerjiServerTelemetry::StopRecording()
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	bRecording = false;
+	FlushRows();
+	UnbindAbilitySystems();
+
+	UE_LOG(LogAeyerjiTelemetry, Display, TEXT("Telemetry stopped (%s)."), *CurrentFilePath);
+}
+
+void UAeyerjiServerTelemetry::ResetWindow(double Now)
+{
+	WindowStartSeconds = Now;
+	LastFrameSeconds = Now;
+	FrameTimesMs.Reset();
+	GameThreadTimesMs.Reset();
+	EffectApplicationsInWindow = 0;
+}
+
+void UAeyerjiServerTelemetry::Tick(float DeltaTime)
+{
+	if (!bRecording)
+	{
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const float FrameMs = static_cast<float>((Now - LastFrameSeconds) * 1000.0);
+	LastFrameSeconds = Now;
+
+	// Dedicated servers sleep to hold their tick rate; the idle part is not game-thread cost.
+	FrameTimesMs.Add(FrameMs);
+	GameThreadTimesMs.Add(FMath::Max(0.f, FrameMs - static_cast<float>(FApp::GetIdleTime() * 1000.0)));
+
+	if (Now - WindowStartSeconds >= TelemetrySampleIntervalSeconds)
+	{
+		TakeSample(Now);
+		ResetWindow(Now);
+	}
+}
+
+void UAeyerjiServerTelemetry::TakeSample(double Now)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const float WindowSeconds = static_cast<float>(FMath::Max(Now - WindowStartSeconds, KINDA_SMALL_NUMBER));
+
+	FAeyerjiTelemetrySample Sample;
+	Sample.WorldTimeSeconds = World->GetTimeSeconds();
+
+	for (TActorIterator<AAeyerjiEncounterDirector> It(World); It; ++It)
+	{
+		const AAeyerjiEncounterDirector* Director = *It;
+		Sample.LiveEnemies += Director->GetLiveEnemyCount();
+		Sample.PendingSpawnRequests += Director->GetPendingSpawnRequestCount();
+		Sample.FixedSpawnQueue += Director->GetFixedSpawnQueueCount();
+		Sample.KillVelocity += Director->GetCurrentKillVelocity();
+	}
+
+	const UGameInstance* GameInstance = World->GetGameInstance();
+	if (const ULootService* LootService = GameInstance ? GameInstance->GetSubsystem<ULootService>() : nullptr)
+	{
+		const uint64 RollCount = LootService->GetTotalRollCount();
+		Sample.LootRollsPerSecond = static_cast<float>(RollCount - LastLootRollCount) / WindowSeconds;
+		LastLootRollCount = RollCount;
+	}
+
+	if (const UAeyerjiLootRegistry* LootRegistry = UAeyerjiLootRegistry::Get(World))
+	{
+		for (const TWeakObjectPtr<AAeyerjiLootPickup>& PickupPtr : LootRegistry->GetPickups())
+		{
+			const AAeyerjiLootPickup* Pickup = PickupPtr.Get();
+			const UAeyerjiItemInstance* Item = Pickup ? Pickup->GetItemInstance() : nullptr;
+			if (Item && Item->GetOuter() == Pickup)
+			{
+				++Sample.ReplicatedItemSubobjects;
+			}
+		}
+	}
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+		if (const UAeyerjiInventoryComponent* Inventory = Pawn ? Pawn->FindComponentByClass<UAeyerjiInventoryComponent>() : nullptr)
+		{
+			Sample.InventoryItemSnapshots += Inventory->ItemSnapshots.Num();
+		}
+	}
+
+	Sample.EffectApplicationsPerSecond = static_cast<float>(EffectApplicationsInWindow) / WindowSeconds;
+
+	FrameTimesMs.Sort();
+	GameThreadTimesMs.Sort();
+	Sample.Frames = FrameTimesMs.Num();
+	Sample.FrameMsP50 = SortedPercentile(FrameTimesMs, 0.50f);
+	Sample.FrameMsP95 = SortedPercentile(FrameTimesMs, 0.95f);
+	Sample.FrameMsP99 = SortedPercentile(FrameTimesMs, 0.99f);
+	Sample.FrameMsMax = FrameTimesMs.IsEmpty() ? 0.f : FrameTimesMs.Last();
+	Sample.GameThreadMsP50 = SortedPercentile(GameThreadTimesMs, 0.50f);
+	Sample.GameThreadMsP95 = SortedPercentile(GameThreadTimesMs, 0.95f);
+
+	Sample.BudgetScale = ReadFloatCVar(TEXT("aeyerji.FixedPopulation.BudgetScale"));
+	Sample.BudgetCap = ReadIntCVar(TEXT("aeyerji.FixedPopulation.BudgetCap"));
+
+	LastSample = Sample;
+	bHasSample = true;
+
+	AppendRow(Sample);
+
+	// Enemies die continuously; their components are gone by now.
+	PruneAbilitySystems();
+}
+
+void UAeyerjiServerTelemetry::RegisterAbilitySystem(UAbilitySystemComponent* ASC)
+{
+	// Not recording: StartRecording picks the component up from its pawn instead.
+	if (!ASC || !bRecording)
+	{
+		return;
+	}
+
+	bool bAlreadyRegistered = false;
+	AbilitySystems.Add(ASC, &bAlreadyRegistered);
+	if (!bAlreadyRegistered)
+	{
+		ASC->OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &UAeyerjiServerTelemetry::HandleEffectApplied);
+	}
+}
+
+void UAeyerjiServerTelemetry::BindAbilitySystems()
+{
+	for (TActorIterator<APawn> It(GetWorld()); It; ++It)
+	{
+		RegisterAbilitySystem(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(*It));
+	}
+}
+
+void UAeyerjiServerTelemetry::UnbindAbilitySystems()
+{
+	for (const TWeakObjectPtr<UAbilitySystemComponent>& ASCPtr : AbilitySystems)
+	{
+		if (UAbilitySystemComponent* ASC = ASCPtr.Get())
+		{
+			ASC->OnGameplayEffectAppliedDelegateToSelf.RemoveAll(this);
+		}
+	}
+	AbilitySystems.Reset();
+}
+
+void UAeyerjiServerTelemetry::PruneAbilitySystems()
+{
+	for (auto It = AbilitySystems.CreateIterator(); It; ++It)
+	{
+		if (!It->IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UAeyerjiServerTelemetry::HandleEffectApplied(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	++EffectApplicationsInWindow;
+}
+
+void UAeyerjiServerTelemetry::OpenNewFile()
+{
+	FlushRows();
+
+	const FString MapName = GetWorld() ? UWorld::RemovePIEPrefix(GetWorld()->GetMapName()) : TEXT("NoWorld");
+	CurrentFilePath = GetTelemetryDirectory() / FString::Printf(TEXT("ServerTelemetry_%s_%s.csv"), *MapName, *FDateTime::Now().ToString());
+	RowsInCurrentFile = 0;
+
+	PendingRows.Add(TEXT("WorldTime,LiveEnemies,PendingSpawnRequests,FixedSpawnQueue,KillVelocity,LootRollsPerSec,ReplicatedItemSubobjects,InventoryItemSnapshots,EffectAppsPerSec,Frames,FrameMsP50,FrameMsP95,FrameMsP99,FrameMsMax,GameThreadMsP50,GameThreadMsP95,BudgetScale,BudgetCap"));
+	FlushRows();
+	PruneOldFiles();
+}
+
+void UAeyerjiServerTelemetry::AppendRow(const FAeyerjiTelemetrySample& Sample)
+{
+	if (RowsInCurrentFile >= FMath::Max(1, GetTelemetryRowsPerFileCVar().GetValueOnGameThread()))
+	{
+		OpenNewFile();
+	}
+
+	PendingRows.Add(FString::Printf(TEXT("%.1f,%d,%d,%d,%.3f,%.2f,%d,%d,%.2f,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d"),
+		Sample.WorldTimeSeconds, Sample.LiveEnemies, Sample.PendingSpawnRequests, Sample.FixedSpawnQueue,
+		Sample.KillVelocity, Sample.LootRollsPerSecond, Sample.ReplicatedItemSubobjects, Sample.InventoryItemSnapshots,
+		Sample.EffectApplicationsPerSecond, Sample.Frames, Sample.FrameMsP50, Sample.FrameMsP95, Sample.FrameMsP99,
+		Sample.FrameMsMax, Sample.GameThreadMsP50, Sample.GameThreadMsP95, Sample.BudgetScale, Sample.BudgetCap));
+	++RowsInCurrentFile;
+
+	if (PendingRows.Num() >= TelemetryFlushEveryRows)
+	{
+		FlushRows();
+	}
+}
+
+void UAeyerjiServerTelemetry::FlushRows()
+{
+	if (PendingRows.IsEmpty() || CurrentFilePath.IsEmpty())
+	{
+		return;
+	}
+
+	const FString Text = FString::Join(PendingRows, LINE_TERMINATOR) + LINE_TERMINATOR;
+	PendingRows.Reset();
+
+	if (!FFileHelper::SaveStringToFile(Text, *CurrentFilePath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogAeyerjiTelemetry, Warning, TEXT("Failed to append telemetry rows to %s"), *CurrentFilePath);
+	}
+}
+
+void UAeyerjiServerTelemetry::PruneOldFiles() const
+{
+	const int32 MaxFiles = FMath::Max(1, GetTelemetryMaxFilesCVar().GetValueOnGameThread());
+	const FString Directory = GetTelemetryDirectory();
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(Directory / TEXT("ServerTelemetry_*.csv")), /*Files=*/true, /*Directories=*/false);
+	if (Files.Num() <= MaxFiles)
+	{
+		return;
+	}
+
+	for (FString& File : Files)
+	{
+		File = Directory / File;
+	}
+
+	Files.Sort([](const FString& A, const FString& B)
+	{
+		return IFileManager::Get().GetTimeStamp(*A) < IFileManager::Get().GetTimeStamp(*B);
+	});
+
+	for (int32 Index = 0; Index < Files.Num() - MaxFiles; ++Index)
+	{
+		if (Files[Index] != CurrentFilePath)
+		{
+			IFileManager::Get().Delete(*Files[Index]);
+		}
+	}
+}
@@ -4,6 +4,7 @@
 
 #include "Player/PlayerStatsTrackingComponent.h"
 #include "Director/AeyerjiLevelDirector.h"
+#include "AeyerjiGameState.h"
 #include "Engine/World.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerState.h"
@@ -12,6 +13,7 @@
 #include "Systems/LootTable.h"
 #include "EngineUtils.h"
 #include "Engine/Engine.h"
+#include "Logging/AeyerjiStats.h"
 
 static UItemDefinition* ChooseFallbackItemDefinition();
 static bool SupportsRarity(const UItemDefinition& Definition, EItemRarity Rarity);
@@ -36,7 +38,16 @@ namespace
 			return 0.f;
 		}
 
-		// Prefer the LevelDirector, since it owns the run's difficulty slider in-level.
+		// The game state caches the LevelDirector's curved difficulty alongside the party levels.
+		if (const AAeyerjiGameState* GameState = World->GetGameState<AAeyerjiGameState>())
+		{
+			if (GameState->HasPartyStats())
+			{
+				return GameState->GetPartyStats().DifficultyScale;
+			}
+		}
+
+		// Otherwise ask the LevelDirector directly, since it owns the run's difficulty slider in-level.
 		for (TActorIterator<AAeyerjiLevelDirector> It(World); It; ++It)
 		{
 			if (AAeyerjiLevelDirector* Director = *It)
@@ -114,6 +125,10 @@ namespace
 
 FLootDropResult ULootService::RollLoot(const FLootContext& Context)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_LootRoll);
+
+	++TotalRollCount;
+
 	FLootDropResult Result;
 
 	UPlayerStatsTrackingComponent* StatsComp = ResolvePlayerStats(Context);
@@ -300,6 +315,8 @@ FLootDropResult ULootService::RollLoot(const FLootContext& Context)
 
 bool ULootService::RollMultiDrop(const FLootContext& BaseContext, const FLootMultiDropConfig& Config, TArray<FLootDropResult>& OutResults)
 {
+	AJ_SCOPE_CYCLE(STAT_AJ_LootRollMultiDrop);
+
 	OutResults.Reset();
 
 	auto ShowDebug = [&](const FString& Msg)
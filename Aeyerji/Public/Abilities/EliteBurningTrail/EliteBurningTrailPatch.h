@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Abilities/EliteBurningTrail/DA_EliteBurningTrail.h"
+#include "GameplayEffectTypes.h"
 #include "GameplayTagContainer.h"
 #include "GameFramework/Actor.h"
 #include "EliteBurningTrailPatch.generated.h"
@@ -90,6 +91,20 @@ protected:
 
 	void RefreshCollisionRadius();
 
+	/** Returns the per-patch damage spec, building it on first use (one spec construction per patch). */
+	const FGameplayEffectSpecHandle& GetOrBuildDamageSpec();
+
+	/** Applies queued overlaps from this frame as one damage batch. */
+	void FlushPendingDamage();
+
+	/** Shared spec reused for every target touching this patch. */
+	FGameplayEffectSpecHandle CachedDamageSpec;
+
+	/** Overlaps collected this frame; flushed on the next tick. */
+	TArray<TWeakObjectPtr<AActor>> PendingDamageTargets;
+
+	bool bDamageFlushScheduled = false;
+
 	/** Single trace downwards to snap the patch onto a static mesh ground surface. */
 	void SnapPatchToGround();
 
@@ -7,12 +7,15 @@
 #include "AbilitySystemInterface.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayTagContainer.h"
+#include "Engine/NetSerialization.h"
 #include "Attributes/AeyerjiAttributeSet.h"
 
 #include "AeyerjiCharacterMovementComponent.h"
 #include "AeyerjiCharacter.generated.h"
 
 struct FTimerHandle;
+class AAeyerjiCharacter;
+class UAeyerjiAbilityIndexComponent;
 class UAeyerjiPickupFXComponent;
 class UGameplayAbility;
 
@@ -59,6 +62,71 @@ struct AEYERJI_API FAeyerjiDeathStateOptions
 	FName ImpulseBoneName = NAME_None;
 };
 
+/**
+ * One death as sent to clients in AAeyerjiGameState::MulticastDeathBatch: the client-relevant subset of
+ * FAeyerjiDeathStateOptions, quantized, plus the killer for BP_OnDeath.
+ */
+USTRUCT()
+struct AEYERJI_API FAeyerjiDeathEvent
+{
+	GENERATED_BODY();
+
+	enum EFlags : uint8
+	{
+		Flag_DetachAttachments       = 1 << 0,
+		Flag_RemoveFloatingWidgets   = 1 << 1,
+		Flag_DisableRagdollCollision = 1 << 2,
+		Flag_NotifyDeath             = 1 << 3, // out-of-health death: clients fire BP_OnDeath
+	};
+
+	UPROPERTY()
+	TObjectPtr<AAeyerjiCharacter> Victim = nullptr;
+
+	UPROPERTY()
+	TObjectPtr<AActor> Killer = nullptr;
+
+	UPROPERTY()
+	float DamageTaken = 0.f;
+
+	UPROPERTY()
+	float RagdollCollisionDisableDelay = 0.f;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Impulse = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantize ImpulseWorldLocation = FVector::ZeroVector;
+
+	UPROPERTY()
+	FName ImpulseBoneName = NAME_None;
+
+	UPROPERTY()
+	uint8 Flags = 0;
+
+	static FAeyerjiDeathEvent Make(AAeyerjiCharacter* InVictim, AActor* InKiller, float InDamageTaken, const FAeyerjiDeathStateOptions& Options, bool bNotifyDeath);
+
+	/** Options for the client-side ApplyDeathStateInternal; server-only steps are left off. */
+	FAeyerjiDeathStateOptions ToOptions() const;
+
+	bool ShouldNotifyDeath() const { return (Flags & Flag_NotifyDeath) != 0; }
+};
+
+/** Replicated with bIsDead so BP_OnDeath can still fire on clients that never receive the batched death event. */
+USTRUCT()
+struct AEYERJI_API FAeyerjiReplicatedDeathInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AActor> Killer = nullptr;
+
+	UPROPERTY()
+	float DamageTaken = 0.f;
+
+	/** Out-of-health death: BP_OnDeath fires. Scripted ApplyDeathState deaths leave it off. */
+	UPROPERTY()
+	bool bNotifyDeath = false;
+};
 
 /**
  *  Native GAS-ready character every pawn in Aeyerji should derive from.
@@ -115,6 +183,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Aeyerji|Death")
 	static void GetPendingCorpseCleanup(TArray<AAeyerjiCharacter*>& OutCorpses);
 
+	/** Client: applies one entry of the server's batched death event. */
+	void ApplyDeathEvent(const FAeyerjiDeathEvent& Event);
+
+	UFUNCTION(BlueprintPure, Category = "Aeyerji|Death")
+	bool IsDead() const { return bIsDead; }
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAbilitySystemReady);
 
 	/** Broadcast after InitialiseAbilitySystem() succeeds (server & client) */
@@ -125,6 +201,9 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "Aeyerji|FX")
 	UAeyerjiPickupFXComponent* GetPickupFXComponent() const { return PickupFXComponent; }
+
+	/** Branch-tag lookup table over AbilitySystemAeyerji's granted abilities. */
+	UAeyerjiAbilityIndexComponent* GetAbilityIndex() const { return AbilityIndex; }
 protected:
     /* ------------------ Components ------------------ */
 
@@ -139,6 +218,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Aeyerji|FX")
 	TObjectPtr<UAeyerjiPickupFXComponent> PickupFXComponent;
 
+	/** Cached branch-tag -> leaf-tag/ability lookups for action bar and UI queries. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Aeyerji|GAS")
+	TObjectPtr<UAeyerjiAbilityIndexComponent> AbilityIndex;
+
 	/** Created as a sub-object so the ASC owns & replicates it cleanly */
 
 	/* ------------------ Gameplay setup ------------------ */
@@ -170,11 +253,19 @@ protected:
 	void AddStartupAbilities();
 	void BindDeathEvent();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastApplyDeathState(FAeyerjiDeathStateOptions Options);
+	/**
+	 * Set once on the server when the pawn dies. Deaths reach clients through the unreliable batched event; this is the
+	 * backstop for a dropped batch or a corpse that becomes relevant later.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_IsDead)
+	bool bIsDead = false;
+
+	UFUNCTION()
+	void OnRep_IsDead();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastOnDeath(AActor* Killer, float DamageTaken);
+	/** Killer/damage for BP_OnDeath; set on the server together with bIsDead. */
+	UPROPERTY(Replicated)
+	FAeyerjiReplicatedDeathInfo DeathInfo;
 
 private:
 	/* ----- One-time initialisation entry point (server & owning client) ----- */
@@ -187,6 +278,12 @@ private:
 	void HandleOutOfHealth(AActor* Victim, AActor* Killer, float DamageTaken);
 
 	void ApplyDeathStateInternal(const FAeyerjiDeathStateOptions& Options);
+	/** Server: marks bIsDead and queues the death for the next batched multicast. */
+	void PublishDeath(const FAeyerjiDeathStateOptions& Options, AActor* Killer, float DamageTaken, bool bNotifyDeath);
+	/** Client: bIsDead arrived but no batch entry did; apply the default death state and notify from DeathInfo. */
+	void ApplyDeathStateFallback();
+	/** Fires BP_OnDeath at most once per life, whichever path (server, batch, fallback) gets there first. */
+	void NotifyDeathOnce(AActor* Killer, float DamageTaken);
 	void RemoveFloatingWidgets();
 	void StopRegeneration();
 	void ScheduleRagdollCollisionDisable(float DelaySeconds);
@@ -196,9 +293,11 @@ private:
 
 	// Prevent repeated ragdoll/apply logic when multiple systems notify death
 	bool bHasAppliedDeathState = false;
+	bool bHasNotifiedDeath = false;
 	bool bCorpseRegisteredForCleanup = false;
 
 	FTimerHandle RagdollCollisionDisableHandle;
+	FTimerHandle DeathStateFallbackHandle;
 
 	static TArray<TWeakObjectPtr<AAeyerjiCharacter>> CorpsesPendingCleanup;
 
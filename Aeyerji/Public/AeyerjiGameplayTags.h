@@ -12,6 +12,9 @@ namespace AeyerjiTags
 
 	// Damage types
 	AEYERJI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(DamageType_Physical); // Damage.Type.Physical
+
+	// Aggregated damage event broadcast once per batch by UAeyerjiDamagePipeline
+	AEYERJI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Event_Damage_BatchApplied); // Event.Damage.BatchApplied
 		
 	// Add more as needed: Secondary attack, Status effects, etc.
 
@@ -14,7 +14,8 @@ class UGameplayEffect;
  * Derives secondary stats from primary attributes via a passive infinite GE.
  * - Computes magnitudes from a DataAsset (UAeyerjiAttributeTuning)
  * - Applies a SetByCaller-powered GE (UGE_SecondaryStatsFromPrimaries)
- * - Re-applies whenever primary attributes change
+ * - Refreshes whenever primary attributes change: changes within a frame are coalesced into one update, unchanged
+ *   magnitudes are skipped, and an already active effect has its SetByCaller magnitudes updated in place.
  */
 UCLASS(ClassGroup=(Aeyerji), meta=(BlueprintSpawnableComponent))
 class AEYERJI_API UAeyerjiStatEngineComponent : public UActorComponent
@@ -37,6 +38,10 @@ private:
     void                            SubscribeToPrimaries();
     void                            ReapplyDerivedEffect();
     void                            OnPrimaryChanged(const FOnAttributeChangeData& Data);
+    // Runs the coalesced derived-effect refresh queued by OnPrimaryChanged.
+    void                            FlushDerivedRefresh();
+    // Fills the SetByCaller magnitudes of the derived GE from the current primaries.
+    void                            ComputeDerivedMagnitudes(const UAeyerjiAttributeSet& Attr, TMap<FGameplayTag, float>& OutMagnitudes) const;
     // Applies the regen effect once the ASC and attributes are ready.
     void                            TryApplyRegen();
     // Queues a short retry if the regen effect cannot be applied yet.
@@ -54,5 +59,7 @@ private:
     mutable TWeakObjectPtr<const UAeyerjiAttributeSet> CachedAttr;
     FActiveGameplayEffectHandle                        ActiveDerivedHandle;
     FActiveGameplayEffectHandle                        ActiveRegenHandle;
+    TMap<FGameplayTag, float>                          AppliedDerivedMagnitudes;
     bool                                               bRegenRetryQueued = false;
+    bool                                               bDerivedRefreshQueued = false;
 };
@@ -50,6 +50,10 @@ public:
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Aeyerji|Tuning")
     FAeyerjiArmorMitigationTuning ArmorMitigation;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
 
 /** Developer settings to pick the default tuning DataAsset */
@@ -68,6 +72,24 @@ public:
     UPROPERTY(EditAnywhere, Config, Category="Aeyerji|Stats")
     TSoftObjectPtr<UAeyerjiAttributeTuning> DefaultTuning;
 
+    /** Sample armor DR from a precomputed table (linear interpolation) instead of evaluating the curve per hit. */
+    UPROPERTY(EditAnywhere, Config, Category="Aeyerji|Stats|Armor")
+    bool bUseArmorDRLookupTable = false;
+
+    /** Samples across [0, ArmorSoftCap]; the linear tail above the soft cap is always evaluated analytically. */
+    UPROPERTY(EditAnywhere, Config, Category="Aeyerji|Stats|Armor", meta=(EditCondition="bUseArmorDRLookupTable", ClampMin="16", ClampMax="65536"))
+    int32 ArmorDRTableResolution = 512;
+
     /** Try to load the tuning asset (can return nullptr). */
     static const UAeyerjiAttributeTuning* Get();
+
+    /** Bumped whenever the settings or the tuning asset change; consumers rebuild cached snapshots on mismatch. */
+    static uint32 GetTuningRevision();
+
+    /** Invalidate cached tuning snapshots (editor edits, hot-swapped tuning assets). */
+    static void NotifyTuningChanged();
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
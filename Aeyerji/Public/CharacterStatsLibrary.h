@@ -79,6 +79,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="SaveGame")
 	static UAeyerjiSaveGame* LoadOrCreateAeyerjiSave(const FString& Slot, UPARAM(ref) bool& bOutLoadedFromDisk);
 
+	/** New save object with cleared action bar, attributes and inventory; nothing is written to disk. */
+	UFUNCTION(BlueprintCallable, Category="SaveGame")
+	static UAeyerjiSaveGame* CreateAeyerjiSave(const FString& Slot);
+
 	UFUNCTION(BlueprintCallable, Category="SaveGame")
 	static void SaveAeyerjiChar(UAeyerjiSaveGame* Data,
 	                            const class AAeyerjiPlayerState* PS,
@@ -0,0 +1,73 @@
+// AeyerjiAbilityIndexComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "GameplayTagContainer.h"
+#include "Templates/SubclassOf.h"
+#include "AeyerjiAbilityIndexComponent.generated.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+struct FGameplayAbilitySpec;
+
+/**
+ * Branch-tag lookup table for one ability system component.
+ *
+ * Maps every tag granted through an activatable spec (dynamic spec source tags and ability asset tags), and every
+ * parent of those tags, to the deepest granted tag under it and the ability that grants it. Same pick as the old
+ * linear scan in UCharacterStatsLibrary: deepest tag wins, a dynamic tag beats an asset tag of equal depth, otherwise
+ * first spec in grant order.
+ *
+ * Rebuilt lazily on the next query after the spec list changed. Spec tag changes on the server arrive through the
+ * ASC's dirtied-spec callback; gives, removals and every client-side replication of the list are reported by
+ * UAeyerjiAbilitySystemComponent through Invalidate. Queries between changes are a single map lookup.
+ */
+UCLASS(ClassGroup=(Aeyerji), meta=(BlueprintSpawnableComponent))
+class AEYERJI_API UAeyerjiAbilityIndexComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAeyerjiAbilityIndexComponent();
+
+	/** Index for ASC, bound on first use. Null when the ASC's owner does not carry one. */
+	static UAeyerjiAbilityIndexComponent* Get(const UAbilitySystemComponent* ASC);
+
+	/** Deepest granted tag at/under Branch. False when nothing granted matches. */
+	bool FindLeafTag(const FGameplayTag& Branch, FGameplayTag& OutLeaf);
+
+	/** Ability (CDO) that grants the deepest tag under Branch, or null. */
+	UGameplayAbility* FindAbilityCDO(const FGameplayTag& Branch);
+
+	/** Class of the ability that grants the deepest tag under Branch, or null. */
+	TSubclassOf<UGameplayAbility> FindAbilityClass(const FGameplayTag& Branch);
+
+	/** Forces a rebuild on the next query. */
+	void Invalidate() { bDirty = true; }
+
+protected:
+	virtual void OnUnregister() override;
+
+private:
+	struct FBranchEntry
+	{
+		FGameplayTag Leaf;
+		TWeakObjectPtr<UGameplayAbility> Ability;
+		int32 Depth = -1;
+		bool bFromDynamic = false;
+	};
+
+	void Bind(UAbilitySystemComponent* ASC);
+	void Unbind();
+	void HandleSpecDirtied(const FGameplayAbilitySpec& Spec);
+
+	const FBranchEntry* FindEntry(const FGameplayTag& Branch);
+	void Rebuild();
+
+	TWeakObjectPtr<UAbilitySystemComponent> BoundASC;
+	FDelegateHandle SpecDirtiedHandle;
+
+	TMap<FGameplayTag, FBranchEntry> BranchIndex;
+	bool bDirty = true;
+};
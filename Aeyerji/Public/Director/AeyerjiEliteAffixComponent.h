@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "AeyerjiEliteAffixComponent.generated.h"
+
+class AAeyerjiSpawnerGroup;
+class APawn;
+struct FEliteAffixDefinition;
+
+UENUM()
+enum class EAeyerjiEliteRank : uint8
+{
+	Elite,
+	MiniBoss,
+	Boss
+};
+
+/** Everything a client needs to present an elite; a few bytes instead of a reliable multicast per spawn. */
+USTRUCT()
+struct AEYERJI_API FAeyerjiElitePresentationState
+{
+	GENERATED_BODY()
+
+	/** Spawner whose EliteAffixPool the mask indexes into. */
+	UPROPERTY()
+	TObjectPtr<AAeyerjiSpawnerGroup> Source = nullptr;
+
+	/** Bit N set = Source->EliteAffixPool[N] rolled. */
+	UPROPERTY()
+	uint32 AffixMask = 0;
+
+	UPROPERTY()
+	float ScaleMultiplier = 1.f;
+
+	UPROPERTY()
+	EAeyerjiEliteRank Rank = EAeyerjiEliteRank::Elite;
+
+	/** Mirrors Source->bReplicateEliteVFX at spawn time. */
+	UPROPERTY()
+	bool bShowFX = true;
+};
+
+/**
+ * Replicated elite affix presentation for one pawn, added by AAeyerjiSpawnerGroup when an elite spawns.
+ *
+ * Scale and shared material variants are applied once on every machine that renders the elite. Niagara is not spawned
+ * here: the component registers with UAeyerjiElitePresentationSubsystem, which decides under a level-wide budget how
+ * much FX the elite gets.
+ */
+UCLASS(ClassGroup=(Aeyerji))
+class AEYERJI_API UAeyerjiEliteAffixComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAeyerjiEliteAffixComponent();
+
+	/** Server: the pawn's elite component, created and registered on first use. */
+	static UAeyerjiEliteAffixComponent* FindOrAdd(APawn* Pawn);
+
+	/** Affix pool indices that fit in the replicated mask. */
+	static constexpr int32 MaxAffixes = 32;
+
+	/** Server: sets the replicated state and applies it locally. */
+	void SetPresentation(const FAeyerjiElitePresentationState& NewState);
+
+	const FAeyerjiElitePresentationState& GetPresentation() const { return State; }
+
+	/** Definitions for the set mask bits, in pool order. Empty when Source is not (yet) resolved on this client. */
+	void GetAffixes(TArray<const FEliteAffixDefinition*>& OutAffixes) const;
+
+	int32 GetNumAffixes() const { return FMath::CountBits(State.AffixMask); }
+
+	/** Relative importance for the presentation budget; grows with rank and affix count. */
+	float GetThreat() const;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UFUNCTION()
+	void OnRep_State();
+
+private:
+	void ApplyLocalPresentation();
+
+	UPROPERTY(ReplicatedUsing=OnRep_State)
+	FAeyerjiElitePresentationState State;
+
+	/** Scale multiplier already baked into the actor scale on this machine. */
+	float AppliedScale = 1.f;
+
+	/** Affix mask whose material variants are applied on this machine. */
+	uint32 AppliedMaterialMask = 0;
+};
@@ -102,6 +102,15 @@ public:
 	UFUNCTION(BlueprintPure, Category="EncounterDirector|FixedPopulation")
 	int32 GetFixedPopulationTarget() const { return FixedPopulationTarget; }
 
+	// Read-only population/pacing state for server telemetry.
+	int32 GetLiveEnemyCount() const { return LiveEnemies.Num(); }
+	int32 GetPendingSpawnRequestCount() const { return PendingSpawnRequests.Num(); }
+	int32 GetFixedSpawnQueueCount() const { return FixedSpawnQueue.Num(); }
+	float GetCurrentKillVelocity() const { return CurrentKillVelocity; }
+
+	/** Author-time spawn groups this director can cycle through. */
+	const TArray<TObjectPtr<UEnemySpawnGroupDefinition>>& GetSpawnGroups() const { return SpawnGroups; }
+
 public:
 	/** Fired when a fixed population cluster is cleared. */
 	UPROPERTY(BlueprintAssignable, Category="EncounterDirector|FixedPopulation")
@@ -143,6 +152,8 @@ protected:
 	UFUNCTION()
 	void HandleTrackedEnemyDestroyed(AActor* DestroyedActor);
 
+	void HandleTrackedEnemyDisturbed(AEnemyParentNative* Enemy);
+
 protected:
 	/** Author-time spawn groups this director can cycle through. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="EncounterDirector|Setup")
@@ -321,8 +332,8 @@ private:
 	void ProcessFixedSpawnQueue();
 	// Recomputes distance-based tick throttling for active enemies.
 	void UpdateEnemyLOD(float DeltaSeconds);
-	// Sleeps or wakes fixed clusters based on player distance.
-	void UpdateFixedClusterLOD(const FVector& PlayerLocation);
+	// Sleeps or wakes fixed clusters based on the distance to the nearest player.
+	void UpdateFixedClusterLOD(TFunctionRef<float(const FVector&)> NearestPlayerDistSq);
 	// Applies the requested sleep state to all members of a fixed cluster.
 	void ApplyFixedClusterSleepState(int32 ClusterId, bool bSleep);
 	// Enables or disables ticking and AI for a single enemy when sleeping.
@@ -373,6 +384,8 @@ private:
 		bool bDenseCluster = false;
 		bool bAllowElites = true;
 		bool bSleeping = false;
+		// World time of the last hit on a member; the cluster stays awake for a while after it.
+		double LastDisturbedTime = -1.0;
 		int32 TotalEnemies = 0;
 		int32 RemainingEnemies = 0;
 	};
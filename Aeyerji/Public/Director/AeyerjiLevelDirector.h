@@ -115,6 +115,13 @@ public:
 	UFUNCTION(BlueprintPure, Category="Director|Difficulty")
 	float GetCurvedDifficulty() const;
 
+	/** Blueprint writes to DifficultySlider/DifficultyExponent land here so the party's cached DifficultyScale follows. */
+	UFUNCTION(BlueprintSetter)
+	void SetDifficultySlider(float NewSlider);
+
+	UFUNCTION(BlueprintSetter)
+	void SetDifficultyExponent(float NewExponent);
+
 	/** Snapshot the current player level (reads Level attribute from player 0 if available). */
 	UFUNCTION(BlueprintPure, Category="Director|Difficulty")
 	int32 GetCurrentPlayerLevel() const;
@@ -208,11 +215,11 @@ public:
 	bool bOpenBossGateOnFixedPopulationCleared = true;
 
 	/** Designer-driven slider (0..1000) used to derive DifficultyScale. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Director|Difficulty", meta=(ClampMin="0.0", ClampMax="1000.0", UIMin="0.0", UIMax="1000.0"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter=SetDifficultySlider, Category="Director|Difficulty", meta=(ClampMin="0.0", ClampMax="1000.0", UIMin="0.0", UIMax="1000.0"))
 	float DifficultySlider = 0.f;
 
 	/** Exponent for pow(DifficultyScale, DifficultyExponent); >1 backloads difficulty. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Director|Difficulty", meta=(ClampMin="0.1", AdvancedDisplay))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter=SetDifficultyExponent, Category="Director|Difficulty", meta=(ClampMin="0.1", AdvancedDisplay))
 	float DifficultyExponent = 1.25f;
 
 	/** When true, all spawned enemies are forced to the current player level. */
@@ -241,6 +248,8 @@ protected:
 	/** Binds the player's leveling component so enemy level sync can react to level-ups. */
 	void BindPlayerLevelingComponent();
 	void TickRunTimer();
+	/** Server: pushes the current difficulty into the game state's cached PartyStats. */
+	void RefreshPartyDifficulty();
 
 protected:
 	UPROPERTY(VisibleAnywhere, Category="Director|State")
@@ -65,6 +65,20 @@ struct AEYERJI_API FEliteAffixDefinition
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Elites")
 	FVector VFXOffset = FVector::ZeroVector;
+
+	/** Material parameters baked into a shared per-material variant; every elite with the same affix set reuses it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Elites|Material")
+	TMap<FName, float> MaterialScalarParameters;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Elites|Material")
+	TMap<FName, FLinearColor> MaterialVectorParameters;
+
+	/** Optional tint written to custom primitive data (AeyerjiEnemyCustomData::EliteTint); first tinted affix wins. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Elites|Material")
+	bool bApplyInstanceTint = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Elites|Material", meta=(EditCondition="bApplyInstanceTint"))
+	FLinearColor InstanceTint = FLinearColor::White;
 };
 
 USTRUCT(BlueprintType)
@@ -374,6 +388,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Spawner|Elites")
 	TObjectPtr<UNiagaraSystem> EliteVFXSystem = nullptr;
 
+	/** Cheap single aura shown instead of the full elite + affix FX when the elite presentation budget degrades it (falls back to EliteVFXSystem). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Spawner|Elites")
+	TObjectPtr<UNiagaraSystem> EliteReducedVFXSystem = nullptr;
+
 	/** Socket to attach the elite FX to (leave None to use the root). */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Spawner|Elites", meta=(AdvancedDisplay))
 	FName EliteVFXSocket = NAME_None;
@@ -382,7 +400,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Spawner|Elites", meta=(AdvancedDisplay))
 	FVector EliteVFXOffset = FVector::ZeroVector;
 
-	/** Replicate the elite FX component so a dedicated server still shows the aura to clients. */
+	/** Show elite and affix FX on clients; they are spawned locally from the elite's replicated affix mask. */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Spawner|Elites")
 	bool bReplicateEliteVFX = true;
 
@@ -509,16 +527,9 @@ protected:
 	UFUNCTION()
 	void OnEnemyDestroyed(AActor* DestroyedEnemy);
 
-	/** Applies elite presentation (scale/VFX) when the enemy set is flagged as elite. */
-	void ApplyElitePresentation(APawn* SpawnedPawn, float ScaleMultiplier, const TArray<const FEliteAffixDefinition*>& Affixes, bool bApplyScale = true);
-
 	/** Returns a copy of the enemy set with random elite promotion applied, if enabled. */
 	FEnemySet ResolveEliteSpawnSet(const FEnemySet& EnemySet) const;
 
-	/** Multicast cosmetic-only RPC so dedicated servers can still show elite FX on clients. */
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastApplyElitePresentation(APawn* SpawnedPawn, float ScaleMultiplier, const TArray<FGameplayTag>& AffixTags);
-
 	/** Applies elite stat bumps to the pawn's attribute set (server only). */
 	void ApplyEliteStats(APawn* SpawnedPawn, float HealthMultiplier, float DamageMultiplier, float RangeMultiplier);
 	/** Pushes gameplay tags, abilities, and affix-driven effects. */
@@ -527,7 +538,6 @@ protected:
 	TArray<const FEliteAffixDefinition*> BuildEliteAffixLoadout(const FEnemySet& EnemySet) const;
 	const FEliteAffixDefinition* FindAffixDefinition(const FGameplayTag& Tag) const;
 	float ComputeEliteScale(const FEnemySet& EnemySet, const TArray<const FEliteAffixDefinition*>& Affixes) const;
-	void ApplyAffixVFX(APawn* SpawnedPawn, const FEliteAffixDefinition& Affix);
 	void ApplyElitePackage(APawn* SpawnedPawn, const FEnemySet& EnemySet);
 	void ApplyEnemyScaling(APawn* SpawnedPawn, const FEnemySet& EnemySet);
 	const FEnemyScalingRow* FindScalingRow(const FGameplayTag& ArchetypeTag) const;
@@ -13,6 +13,7 @@ class UAbilitySystemComponent;
 class UAnimMontage;
 class UGameplayAbility;
 class UGameplayEffect;
+struct FAeyerjiArchetypeBundle;
 struct FAeyerjiEnemyArchetypeEntry;
 struct FAeyerjiEnemyStatMultipliers;
 
@@ -72,6 +73,11 @@ public:
 	// Controls whether ApplyArchetype runs automatically on BeginPlay.
 	void SetAutoApplyOnBeginPlay(bool bInAutoApply) { bAutoApplyOnBeginPlay = bInAutoApply; }
 
+	// Configured archetype sources, for preloading; never loads.
+	const TSoftObjectPtr<UAeyerjiEnemyArchetypeData>& GetArchetypeDataSource() const { return ArchetypeData; }
+	const TSoftObjectPtr<UAeyerjiEnemyArchetypeLibrary>& GetArchetypeLibrarySource() const { return ArchetypeLibrary; }
+	FGameplayTag GetArchetypeLibraryTag() const { return ArchetypeTag; }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
@@ -84,23 +90,11 @@ private:
 	const UAeyerjiEnemyArchetypeData* ResolveArchetypeData(bool bLoadIfNeeded) const;
 	// Returns the resolved archetype entry from the library.
 	const FAeyerjiEnemyArchetypeEntry* ResolveArchetypeEntry(bool bLoadIfNeeded) const;
-	void ValidateArchetype(const UAeyerjiEnemyArchetypeData& Data);
-	void ValidateArchetype(const FAeyerjiEnemyArchetypeEntry& Data);
-	// Initializes base attribute values from the archetype's defaults table.
-	void ApplyAttributeDefaults(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC);
-	void ApplyAttributeDefaults(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC);
-	void ApplyGrantedTags(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC);
-	void ApplyGrantedTags(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC);
-	void ApplyTeamOverrides(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC);
-	void ApplyTeamOverrides(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC);
-	void GrantAbilities(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC);
-	void GrantAbilities(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC);
-	void ApplyInitEffects(const UAeyerjiEnemyArchetypeData& Data, UAbilitySystemComponent& ASC);
-	void ApplyInitEffects(const FAeyerjiEnemyArchetypeEntry& Data, UAbilitySystemComponent& ASC);
-	void AddTraitComponents(const UAeyerjiEnemyArchetypeData& Data);
-	void AddTraitComponents(const FAeyerjiEnemyArchetypeEntry& Data);
-	void ApplyMeshOverrides(const UAeyerjiEnemyArchetypeData& Data);
-	void ApplyMeshOverrides(const FAeyerjiEnemyArchetypeEntry& Data);
+	// Returns the compiled archetype, from the world's archetype registry when there is one.
+	const FAeyerjiArchetypeBundle* ResolveBundle(bool bLoadIfNeeded) const;
+	// Drops everything derived from the archetype source after it changes.
+	void ResetResolvedArchetype();
+	void ApplyMeshOverrides(const FAeyerjiArchetypeBundle& Bundle);
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_ArchetypeSource, Category="Archetype", meta=(AllowPrivateAccess="true"))
 	TSoftObjectPtr<UAeyerjiEnemyArchetypeData> ArchetypeData;
@@ -120,6 +114,8 @@ private:
 	bool bAutoApplyOnBeginPlay = true;
 
 	bool bApplied = false;
-	bool bValidated = false;
 	bool bVisualsApplied = false;
+
+	// Compiled archetype; shared with UAeyerjiEnemyArchetypeRegistry in game worlds.
+	mutable TSharedPtr<const FAeyerjiArchetypeBundle> ResolvedBundle;
 };
@@ -88,6 +88,14 @@ struct AEYERJI_API FAeyerjiEnemyMeshOverrides
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Mesh", meta=(EditCondition="bOverrideRelativeTransform"))
 	FTransform RelativeTransform = FTransform::Identity;
+
+	// Optional tint written to custom primitive data (AeyerjiEnemyCustomData::ArchetypeTint) instead of a
+	// per-enemy material instance, so recolored archetypes keep sharing their materials.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Mesh")
+	bool bApplyInstanceTint = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Mesh", meta=(EditCondition="bApplyInstanceTint"))
+	FLinearColor InstanceTint = FLinearColor::White;
 };
 
 /**
@@ -0,0 +1,141 @@
+// AeyerjiEnemyArchetypeRegistry.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+#include "UObject/SoftObjectPath.h"
+#include "Enemy/AeyerjiEnemyArchetypeData.h"
+#include "AeyerjiEnemyArchetypeRegistry.generated.h"
+
+class UAeyerjiEnemyArchetypeLibrary;
+class UAeyerjiEnemyTraitComponent;
+class UAnimInstance;
+class UAnimMontage;
+class UAttributeSet;
+class UDataTable;
+class UGameplayAbility;
+class UGameplayEffect;
+class UMaterialInterface;
+class USkeletalMesh;
+struct FAeyerjiEnemyArchetypeEntry;
+struct FStreamableHandle;
+
+/**
+ * One archetype with every soft reference resolved and every list filtered, so
+ * UAeyerjiEnemyArchetypeComponent can apply it in a single pass without loads or lookups.
+ */
+struct AEYERJI_API FAeyerjiArchetypeBundle
+{
+	FGameplayTag ArchetypeTag;
+	FString DebugName;
+
+	/** GrantedTags plus ArchetypeTag, added to the ASC in one call. */
+	FGameplayTagContainer LooseTags;
+
+	bool bOverrideTeamId = false;
+	uint8 TeamIdOverride = 1;
+	bool bOverrideTeamTag = false;
+	FGameplayTag TeamTagOverride;
+
+	/** Non-null, deduplicated; granted at AbilityLevel. */
+	TArray<TSubclassOf<UGameplayAbility>> Abilities;
+	int32 AbilityLevel = 1;
+
+	/** Non-null; applied to self at EffectLevel with one shared context. */
+	TArray<TSubclassOf<UGameplayEffect>> InitEffects;
+	float EffectLevel = 1.f;
+
+	TSubclassOf<UGameplayEffect> BasicAttackEffect;
+
+	/** Non-null, deduplicated. */
+	TArray<TSubclassOf<UAeyerjiEnemyTraitComponent>> Traits;
+
+	TObjectPtr<UDataTable> AttributeDefaultsTable = nullptr;
+	TSubclassOf<UAttributeSet> AttributeSetClass;
+
+	TObjectPtr<UAnimMontage> AttackMontage = nullptr;
+
+	/** Mesh overrides; left empty on dedicated servers, which never apply them. */
+	bool bHasMeshOverrides = false;
+	TObjectPtr<USkeletalMesh> SkeletalMesh = nullptr;
+	TSubclassOf<UAnimInstance> AnimClass;
+	/** Indexed by material slot; null entries are left untouched. */
+	TArray<TObjectPtr<UMaterialInterface>> MaterialOverrides;
+	bool bOverrideRelativeTransform = false;
+	FTransform RelativeTransform = FTransform::Identity;
+	bool bApplyInstanceTint = false;
+	FLinearColor InstanceTint = FLinearColor::White;
+
+	FAeyerjiEnemyStatMultipliers StatMultipliers;
+};
+
+/**
+ * Per-world cache of compiled enemy archetypes.
+ *
+ * On world begin play, collects every enemy class the level can spawn (spawner group waves and encounter
+ * definitions, encounter director spawn groups, the level director's world spawn profile, enemies placed in the
+ * level), async-loads their archetype data assets/library entries and everything those reference, then compiles
+ * one FAeyerjiArchetypeBundle per archetype. Archetypes that were not preloaded (or are spawned before the preload
+ * finishes) are compiled synchronously on first use and cached from then on.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiEnemyArchetypeRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UAeyerjiEnemyArchetypeRegistry* Get(const UObject* WorldContext);
+
+	/** Builds an uncached bundle, synchronously loading whatever is not in memory yet. */
+	static TSharedRef<const FAeyerjiArchetypeBundle> Compile(const UAeyerjiEnemyArchetypeData& Data);
+	static TSharedRef<const FAeyerjiArchetypeBundle> Compile(const FAeyerjiEnemyArchetypeEntry& Entry);
+
+	/** Cached bundle for a data asset (invalid Tag) or a library entry (library path + Tag), or null. */
+	TSharedPtr<const FAeyerjiArchetypeBundle> Find(const FSoftObjectPath& Source, const FGameplayTag& Tag) const;
+
+	TSharedRef<const FAeyerjiArchetypeBundle> FindOrCompile(const UAeyerjiEnemyArchetypeData& Data);
+	TSharedRef<const FAeyerjiArchetypeBundle> FindOrCompile(const UAeyerjiEnemyArchetypeLibrary& Library, const FAeyerjiEnemyArchetypeEntry& Entry);
+
+	bool IsPreloadComplete() const { return !bPreloading; }
+	int32 GetNumBundles() const { return Bundles.Num(); }
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FBundleKey
+	{
+		FSoftObjectPath Source;
+		FGameplayTag Tag;
+
+		bool operator==(const FBundleKey& Other) const { return Source == Other.Source && Tag == Other.Tag; }
+		friend uint32 GetTypeHash(const FBundleKey& Key) { return HashCombine(GetTypeHash(Key.Source), GetTypeHash(Key.Tag)); }
+	};
+
+	TSharedRef<const FAeyerjiArchetypeBundle> AddBundle(const FBundleKey& Key, const UObject& SourceAsset, TSharedRef<const FAeyerjiArchetypeBundle> Bundle);
+
+	/** Preload stages: enemy classes -> archetype sources -> referenced assets -> compile. */
+	void StartPreload();
+	void LoadThen(TArray<FSoftObjectPath>&& Paths, void (UAeyerjiEnemyArchetypeRegistry::*Next)());
+	void HandleEnemyClassesLoaded();
+	void HandleSourcesLoaded();
+	void HandleDependenciesLoaded();
+
+	TMap<FBundleKey, TSharedPtr<const FAeyerjiArchetypeBundle>> Bundles;
+
+	/** Keeps preloaded enemy classes, source assets and everything the bundles point at resident for the world's lifetime. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UObject>> PinnedAssets;
+
+	/** Preload bookkeeping. */
+	TArray<FSoftObjectPath> PreloadEnemyClasses;
+	TArray<FBundleKey> PreloadKeys;
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+	bool bPreloading = false;
+	double PreloadStartTime = 0.0;
+};
@@ -0,0 +1,91 @@
+// AeyerjiEnemyVisualVariantCache.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "AeyerjiEnemyVisualVariantCache.generated.h"
+
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class UMeshComponent;
+class UPrimitiveComponent;
+struct FEliteAffixDefinition;
+
+/** Custom primitive data layout read by enemy materials (each tint is RGBA, four consecutive floats). */
+namespace AeyerjiEnemyCustomData
+{
+	constexpr int32 ArchetypeTint = 0;
+	constexpr int32 EliteTint = 4;
+}
+
+/**
+ * Shared material variants for enemy visuals.
+ *
+ * Elite affix material parameters are baked once per (base material, affix set) into a material instance owned by
+ * this subsystem, and every elite rolling the same affixes on the same material reuses it, so packs keep drawing
+ * with a handful of shared materials instead of one instance per pawn. Per-pawn colour goes through custom primitive
+ * data (see AeyerjiEnemyCustomData), which does not create material instances at all.
+ *
+ * Not created on dedicated servers, which never render enemies.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiEnemyVisualVariantCache : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UAeyerjiEnemyVisualVariantCache* Get(const UObject* WorldContext);
+
+	/** Writes Tint into four consecutive custom primitive data floats starting at FirstIndex. */
+	static void SetInstanceTint(UPrimitiveComponent* Primitive, int32 FirstIndex, const FLinearColor& Tint);
+
+	/** Swaps every material slot on Mesh to its shared affix variant and applies the first affix instance tint. */
+	void ApplyAffixVariants(UMeshComponent* Mesh, TConstArrayView<const FEliteAffixDefinition*> Affixes);
+
+	/**
+	 * Material to assign when a slot currently showing Current is overridden with NewBase: the matching affix variant
+	 * of NewBase if Current is one of ours, otherwise NewBase. Keeps elite looks when archetype visuals re-apply.
+	 */
+	UMaterialInterface* RebaseMaterial(const UMaterialInterface* Current, UMaterialInterface* NewBase);
+
+	int32 GetNumVariants() const { return VariantMaterials.Num(); }
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Merged material parameters of one affix set; only affixes that set parameters take part. */
+	struct FAffixLayer
+	{
+		TArray<FGameplayTag> AffixTags;
+		TMap<FName, float> ScalarParameters;
+		TMap<FName, FLinearColor> VectorParameters;
+	};
+
+	struct FVariantKey
+	{
+		TObjectKey<UMaterialInterface> BaseMaterial;
+		const FAffixLayer* Layer = nullptr;
+
+		bool operator==(const FVariantKey& Other) const { return BaseMaterial == Other.BaseMaterial && Layer == Other.Layer; }
+		friend uint32 GetTypeHash(const FVariantKey& Key) { return HashCombine(GetTypeHash(Key.BaseMaterial), PointerHash(Key.Layer)); }
+	};
+
+	const FAffixLayer* FindOrAddLayer(TConstArrayView<const FEliteAffixDefinition*> Affixes);
+	UMaterialInterface* FindOrAddVariant(UMaterialInterface* BaseMaterial, const FAffixLayer& Layer);
+
+	/** Layers are few (one per distinct affix combination) and never removed, so entries are stable. */
+	TArray<TUniquePtr<FAffixLayer>> Layers;
+
+	TMap<FVariantKey, TWeakObjectPtr<UMaterialInstanceDynamic>> Variants;
+	TMap<TObjectKey<UMaterialInterface>, const FAffixLayer*> VariantLayers;
+
+	/** Owns the variants for the world's lifetime. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMaterialInstanceDynamic>> VariantMaterials;
+};
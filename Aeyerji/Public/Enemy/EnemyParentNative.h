@@ -26,9 +26,12 @@ class UAeyerjiEnemyArchetypeData;
 class UAeyerjiEnemyTraitComponent;
 class UAeyerjiLevelingComponent;
 class UAeyerjiRewardConfigComponent;
+class AEnemyParentNative;
+struct FOnAttributeChangeData;
 struct FPropertyChangedEvent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FEnemyDiedSignature, AActor*, Enemy);
+DECLARE_MULTICAST_DELEGATE_OneParam(FEnemyDisturbedSignature, AEnemyParentNative* /*Enemy*/);
 /**
  * Native base class for AI-controlled "creep" / enemy pawns.
  * Blueprint children should inherit from this (NOT from ACharacter directly).
@@ -118,6 +121,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="Enemy|Events")
 	FEnemyDiedSignature OnEnemyDied;
 
+	/** Server: health dropped. Lets the encounter director wake a sleeping (net-dormant) enemy that is being attacked. */
+	FEnemyDisturbedSignature OnEnemyDisturbed;
+
 	/** Apply archetype tags, traits, abilities, and effects (server only). */
 	UFUNCTION(BlueprintCallable, Category="Enemy|Archetype")
 	void ApplyArchetypeData();
@@ -184,6 +190,8 @@ protected:
 	UFUNCTION()
 	void OnRep_ActiveTeamTag();
 
+	void HandleHealthChanged(const FOnAttributeChangeData& Data);
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Enemy|Highlight")
 	TObjectPtr<UOutlineHighlightComponent> OutlineHighlight;
 
@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: MIT
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NeonFlickerSubsystem.generated.h"
+
+class UNeonRailFlickerComponent;
+
+/**
+ * Drives every neon flicker segment in the world from one priority queue.
+ *
+ * Flicker components push (due time, segment) events instead of owning a timer per segment; each frame the subsystem
+ * pops everything that is due, toggles it, and flushes each touched component's render updates once. Components
+ * farther than aeyerji.Neon.FlickerCullDistance from every local view are suspended: their events are pushed back
+ * without toggling. Not created on dedicated servers (flicker is cosmetic).
+ */
+UCLASS()
+class AEYERJI_API UNeonFlickerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UNeonFlickerSubsystem* Get(const UObject* WorldContext);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Queues a toggle for one segment. Events whose generation no longer matches the component are dropped. */
+	void ScheduleToggle(UNeonRailFlickerComponent* Component, int32 SegmentIndex, uint32 Generation, float Delay);
+
+	int32 GetPendingEventCount() const { return Events.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FFlickerEvent
+	{
+		double DueTime = 0.0;
+		TWeakObjectPtr<UNeonRailFlickerComponent> Component;
+		int32 SegmentIndex = INDEX_NONE;
+		uint32 Generation = 0;
+
+		bool operator<(const FFlickerEvent& Other) const { return DueTime < Other.DueTime; }
+	};
+
+	/** Recomputes SuspendedComponents against the local players' view locations. */
+	void UpdateSuspension();
+
+	/** Min-heap on DueTime. */
+	TArray<FFlickerEvent> Events;
+
+	/** Every component that has scheduled at least one toggle; pruned as components die. */
+	TSet<TWeakObjectPtr<UNeonRailFlickerComponent>> RegisteredComponents;
+
+	/** Components outside the cull range as of the last suspension pass. */
+	TSet<TWeakObjectPtr<UNeonRailFlickerComponent>> SuspendedComponents;
+
+	double NextSuspensionCheckTime = 0.0;
+};
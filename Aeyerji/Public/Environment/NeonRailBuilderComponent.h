@@ -4,11 +4,23 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Components/SplineMeshComponent.h"
+#include "LevelDesign/SplineProceduralBuild.h"
 #include "NeonRailBuilderComponent.generated.h"
 
 class USplineComponent;
 class UStaticMesh;
 class UMaterialInterface;
+class UInstancedStaticMeshComponent;
+
+/** How BuildRail turns the spline into geometry. */
+UENUM(BlueprintType)
+enum class ENeonRailRenderMode : uint8
+{
+	/** One bent USplineMeshComponent per segment (original behaviour). */
+	SplineMeshes,
+	/** One instanced static mesh component; each segment is a straight instance along its chord. */
+	Instanced,
+};
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FNeonRailBuiltSignature, UNeonRailBuilderComponent*, Builder);
 
@@ -53,6 +65,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NeonRail")
 	bool bClearPrevious = true;
 
+	/**
+	 * Instanced draws a whole rail with one component and one draw per material, instead of a component per segment.
+	 * Segments become straight chords, so keep SegmentLength short on tight curves. The material should read
+	 * PerInstanceCustomData[0] as glow intensity; the flicker component drives it per instance.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NeonRail")
+	ENeonRailRenderMode RenderMode = ENeonRailRenderMode::SplineMeshes;
+
+	/** Initial per-instance custom data 0 (glow intensity) in Instanced mode. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NeonRail", meta = (EditCondition = "RenderMode == ENeonRailRenderMode::Instanced"))
+	float InstanceGlowValue = 5.f;
+
 	/** Broadcast after BuildRail finishes. */
 	UPROPERTY(BlueprintAssignable, Category = "NeonRail")
 	FNeonRailBuiltSignature OnRailRebuilt;
@@ -61,12 +85,32 @@ public:
 	UFUNCTION(CallInEditor, BlueprintCallable, Category = "NeonRail")
 	void BuildRail();
 
+	/**
+	 * Rebuild after an edit. In editor worlds this is debounced, the spline is cut on a worker thread and only the
+	 * segments that moved are touched; elsewhere it is BuildRail.
+	 */
+	void RequestRebuild();
+
 	/** Returns the currently spawned spline mesh segments that belong to this builder. */
 	UFUNCTION(BlueprintCallable, Category = "NeonRail")
 	void GetSpawnedSegments(TArray<USplineMeshComponent*>& OutSegments) const;
 
+	/** Instanced mode: the component holding every segment (instance index == segment index), else nullptr. */
+	UFUNCTION(BlueprintCallable, Category = "NeonRail")
+	UInstancedStaticMeshComponent* GetInstancedRail() const;
+
+	/**
+	 * Instance transform that stretches Mesh along ForwardAxis from Start to End, the straight-chord equivalent of a
+	 * spline mesh segment. CrossScale scales the two other axes in spline-mesh order; roll turns around the chord.
+	 * Returns false for degenerate chords or meshes.
+	 */
+	static bool MakeChordInstanceTransform(const UStaticMesh& Mesh, ESplineMeshAxis::Type ForwardAxis, const FVector& Start, const FVector& End,
+	                                       const FVector2D& CrossScale, float RollRadians, FTransform& OutTransform);
+
 protected:
 	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 #if WITH_EDITOR
@@ -78,7 +122,16 @@ private:
 
 	USplineComponent* ResolveSpline() const;
 	void ClearPreviousMeshes();
-	void SpawnOneSegment(float T0, float T1);
+	FSplineSegmentBuildInput MakeBuildInput(const USplineComponent& UseSpline) const;
+	/** Replaces every generated segment. */
+	void CommitFullRebuild(TConstArrayView<FSplineSegmentParams> Segments);
+	/** Updates only the Changed segments in place, falling back to a full rebuild when the generated set is not intact. */
+	void CommitChangedSegments(TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32> Changed);
+	void SpawnOneSegment(USplineComponent& UseSpline, const FSplineSegmentParams& Segment);
+	void ApplySegment(USplineMeshComponent& SplineMesh, const FSplineSegmentParams& Segment) const;
+	/** Chord transform for Segment in spline-local space; degenerate chords get a zero-scale transform so instance index == segment index. */
+	FTransform MakeInstancedSegmentTransform(const FSplineSegmentParams& Segment) const;
+	UInstancedStaticMeshComponent* ResolveOrCreateInstancedRail(USplineComponent& UseSpline);
 
 	void CacheTaggedSegmentsIfNeeded() const;
 	void CacheSplineVersion();
@@ -86,8 +139,13 @@ private:
 	UPROPERTY(Transient)
 	mutable TArray<TWeakObjectPtr<USplineMeshComponent>> SpawnedSegments;
 
+	UPROPERTY(Transient)
+	mutable TWeakObjectPtr<UInstancedStaticMeshComponent> InstancedRail;
+
 	UPROPERTY(Transient)
 	uint32 CachedSplineVersion = 0;
 
 	bool bHasCachedVersion = false;
+
+	FSplineProceduralBuild SegmentBuild;
 };
\ No newline at end of file
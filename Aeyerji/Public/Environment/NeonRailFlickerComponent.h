@@ -5,6 +5,7 @@
 #include "Components/ActorComponent.h"
 #include "NeonRailFlickerComponent.generated.h"
 
+class UInstancedStaticMeshComponent;
 class UMaterialInstanceDynamic;
 class UNeonRailBuilderComponent;
 class USplineMeshComponent;
@@ -21,16 +22,29 @@ struct FFlickerSegment
 	{
 	}
 
+	explicit FFlickerSegment(int32 InInstanceIndex)
+		: InstanceIndex(InInstanceIndex)
+	{
+	}
+
 	UPROPERTY()
 	TWeakObjectPtr<USplineMeshComponent> Segment;
 
+	/** Instance on the builder's instanced rail; INDEX_NONE for spline mesh segments. */
 	UPROPERTY()
-	bool bIsLit = true;
+	int32 InstanceIndex = INDEX_NONE;
 
-	FTimerHandle TimerHandle;
+	UPROPERTY()
+	bool bIsLit = true;
 };
 
-/** Drives random per-segment flicker to mimic dying neon tubes. */
+/**
+ * Drives random per-segment flicker to mimic dying neon tubes.
+ * Spline mesh rails flicker through visibility and a dynamic material per segment; instanced rails write the emissive
+ * value into per-instance custom data 0 instead (no MIDs, no visibility toggles).
+ * Toggles are scheduled on UNeonFlickerSubsystem rather than one timer per segment; with no subsystem (dedicated
+ * server) segments simply stay lit.
+ */
 UCLASS(ClassGroup = (Aeyerji), meta = (BlueprintSpawnableComponent))
 class AEYERJI_API UNeonRailFlickerComponent : public UActorComponent
 {
@@ -92,15 +106,22 @@ protected:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	friend class UNeonFlickerSubsystem;
+
 	UFUNCTION()
 	void HandleRailRebuilt(UNeonRailBuilderComponent* InBuilder);
 
 	void ResolveBuilder();
 	void SetupForSegments(const TArray<USplineMeshComponent*>& Segments);
+	void SetupForInstances(UInstancedStaticMeshComponent* Instanced);
+	void StartInitialToggles();
 	void ClearFlickerState();
 	void ApplySegmentState(int32 Index, bool bIsLit);
 	void ScheduleNextToggle(int32 Index, float OverrideDelay = -1.f);
 	void ToggleSegment(int32 Index);
+	/** Pushes instance custom data changed since the last flush in one render-state update. */
+	void FlushBatchedUpdates();
+	void CacheFlickerBounds();
 
 	float GetRandomOnTime() const;
 	float GetRandomOffTime() const;
@@ -111,5 +132,16 @@ private:
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UMaterialInstanceDynamic>> SegmentMaterials;
 
+	UPROPERTY(Transient)
+	TWeakObjectPtr<UInstancedStaticMeshComponent> FlickerInstances;
+
+	/** Bumped whenever tracked segments are rebuilt so the subsystem drops events for the old set. */
+	uint32 FlickerGeneration = 0;
+
+	/** World-space bounds of the flickering geometry, for the subsystem's view-distance suspension. */
+	FBox FlickerBounds = FBox(ForceInit);
+
+	bool bInstanceDataDirty = false;
+
 	bool bHasBoundDelegate = false;
 };
\ No newline at end of file
@@ -71,6 +71,18 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="NeonStrip|Geometry")
     TEnumAsByte<ESplineMeshAxis::Type> ForwardAxis;
 
+    // Draw the strip as straight instances of one instanced mesh component instead of one spline mesh per spline point.
+    // Material may read PerInstanceCustomData[0] (glow intensity, initialised to InstanceGlowValue).
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="NeonStrip|Geometry", meta=(EditCondition="bGenerateMesh"))
+    bool bInstancedSegments;
+
+    // Chord length per instance; shorter follows curves more closely
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="NeonStrip|Geometry", meta=(EditCondition="bGenerateMesh && bInstancedSegments", ClampMin="10"))
+    float InstanceSegmentLength;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="NeonStrip|Geometry", meta=(EditCondition="bGenerateMesh && bInstancedSegments"))
+    float InstanceGlowValue;
+
     // Lights
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="NeonStrip|Lights")
     bool bGenerateLights;
@@ -128,5 +140,6 @@ public:
 private:
     void ClearGeneratedComponents();
     void BuildMeshes();
+    void BuildInstancedMeshes();
     void BuildLights();
 };
@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTagContainer.h"
+#include "GameplayEffectTypes.h"
 #include "SweepingLightBarrier.generated.h"
 
 class USplineComponent;
@@ -13,6 +14,17 @@ class UMaterialInterface;
 class UDamageType;
 class UGameplayEffect;
 
+/**
+ * Light wall that sweeps along a spline and damages pawns it passes through.
+ *
+ * Motion is a pure function of the replicated server world time, so every machine poses the barrier identically
+ * without replicating it or accumulating per-frame state. Clients never run its collision, and while no local view is
+ * within ClientUpdateDistance of the whole sweep volume they drop to a slow idle tick instead of posing every frame.
+ *
+ * Continuous damage is applied by the server on a fixed interval: each overlapping actor accumulates exposure time
+ * and receives one GE application per interval (plus one for the remainder on exit), built from a spec cached once
+ * per barrier.
+ */
 UCLASS(BlueprintType)
 class AEYERJI_API ASweepingLightBarrier : public AActor
 {
@@ -22,6 +34,8 @@ public:
     ASweepingLightBarrier();
 
     virtual void OnConstruction(const FTransform& Transform) override;
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void Tick(float DeltaSeconds) override;
 
 protected:
@@ -61,6 +75,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Barrier|Motion")
     bool bPingPong;
 
+    /** Clients pose the barrier every frame only while a local view is this close to the sweep volume (cm). */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Barrier|Motion", meta=(ClampMin="0"))
+    float ClientUpdateDistance;
+
     // Lighting
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Barrier|Light")
     bool bUseRectLight;
@@ -84,6 +102,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Barrier|Damage", meta=(ClampMin="0"))
     float DamagePerSecond;
 
+    /** Seconds between continuous damage applications; each carries DamagePerSecond * exposure time. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Barrier|Damage", meta=(ClampMin="0.05", EditCondition="bDamageContinuous"))
+    float DamageTickInterval;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Barrier|Damage")
     TSubclassOf<UDamageType> DamageTypeClass;
 
@@ -99,13 +121,32 @@ public:
 private:
     float SplineLen;
     float Alpha; // 0..1 along the path
-    int32 Direction; // +1 or -1
-    float PauseTimer;
 
-    TSet<TWeakObjectPtr<AActor>> Overlapping;
+    /** World-space volume the barrier can occupy over a full sweep (spline bounds grown by the barrier size). */
+    FBox SweepBounds;
+
+    /** Overlapping actors -> world time their unpaid exposure started (server only). */
+    TMap<TWeakObjectPtr<AActor>, double> Overlapping;
 
+    FTimerHandle DamageTimerHandle;
+
+    /** Built once per barrier; only the SetByCaller magnitude changes between applications. */
+    FGameplayEffectSpecHandle CachedDamageSpec;
+    FGameplayTag ResolvedDamageTag;
+
+    double GetSharedWorldTime() const;
+    /** Path position (0..1) at the given shared time: travel, pause at the end, then back (or wrap) and repeat. */
+    float EvaluateAlphaAtTime(double TimeSeconds) const;
     void UpdateBarrierTransform();
+    void UpdateSweepBounds();
+    bool IsSweepNearLocalView() const;
+
     void ApplyBarrierDamage(AActor* Other, float Damage);
+    /** Applies each overlapping actor's accumulated exposure since its last application. */
+    void ApplyContinuousDamage();
+    /** Pays out exposure for one actor up to now. */
+    void SettleExposure(AActor* Other, double& ExposureStart, double Now);
+    const FGameplayEffectSpecHandle& GetOrBuildDamageSpec();
 
     UFUNCTION()
     void OnDamageOverlapBegin(UPrimitiveComponent* Overlapped, AActor* Other, UPrimitiveComponent* OtherComp, int32 BodyIndex, bool bFromSweep, const FHitResult& Hit);
@@ -0,0 +1,27 @@
+// AeyerjiAbilitySystemComponent.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemComponent.h"
+
+#include "AeyerjiAbilitySystemComponent.generated.h"
+
+/**
+ * Ability system component used by every AAeyerjiCharacter.
+ *
+ * Invalidates the owner's UAeyerjiAbilityIndexComponent whenever the activatable spec list changes: gives and
+ * removals (ClearAbility included) on the server, every replicated update of the list on clients.
+ */
+UCLASS(ClassGroup=(Aeyerji))
+class AEYERJI_API UAeyerjiAbilitySystemComponent : public UAbilitySystemComponent
+{
+	GENERATED_BODY()
+
+protected:
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRep_ActivateAbilities() override;
+
+private:
+	void InvalidateAbilityIndex();
+};
@@ -21,7 +21,6 @@ public:
 	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
 	                                    FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
 
-private:
 	struct FArmorTuning
 	{
 		float ArmorK = 1000.f;
@@ -30,6 +29,72 @@ private:
 		float ArmorTailCap = 0.52f;
 	};
 
+	/**
+	 * Tuning snapshot plus the optional DR lookup table.
+	 * Rebuilt only when UAeyerjiStatSettings reports a new tuning revision.
+	 */
+	struct FArmorCurve
+	{
+		FArmorTuning Tuning;
+
+		/** DR samples across [0, ArmorSoftCap]; empty when the lookup table is disabled. */
+		TArray<float> DRTable;
+		float SamplesPerArmor = 0.f;
+
+		uint32 Revision = 0;
+
+		// Table lookup below the soft cap when available, analytic otherwise.
+		float Evaluate(float Armor) const;
+	};
+
+	/**
+	 * Pins the current armor curve for every execution inside the scope.
+	 * Used by batched damage application; game thread only, scopes nest.
+	 */
+	class AEYERJI_API FScopedArmorTuningBatch
+	{
+	public:
+		FScopedArmorTuningBatch();
+		~FScopedArmorTuningBatch();
+
+		FScopedArmorTuningBatch(const FScopedArmorTuningBatch&) = delete;
+		FScopedArmorTuningBatch& operator=(const FScopedArmorTuningBatch&) = delete;
+
+	private:
+		const FArmorCurve* Previous = nullptr;
+	};
+
+	/** Console micro-benchmark (aeyerji.Damage.BenchArmorDR; Aeyerji.Damage.ArmorDRBench in CI): analytic vs table timings and max error over [0, SoftCap]. */
+	static void RunArmorDRBenchmark(const TArray<FString>& Args);
+
+private:
+	friend class FAeyerjiArmorDRCurveTest;
+	friend class FAeyerjiArmorDRBenchTest;
+
+	struct FArmorDRBenchResult
+	{
+		int32 NumEvals = 0;
+		int32 TableResolution = 0;
+		double AnalyticSeconds = 0.0;
+		double TableSeconds = 0.0;
+		float MaxError = 0.f;
+
+		/** Sums of every evaluated DR; reported so the timed loops cannot be optimised away. */
+		double AnalyticSum = 0.0;
+		double TableSum = 0.0;
+	};
+
+	/** Times NumEvals analytic and table evaluations of the same armor sequence inside [0, SoftCap]. */
+	static FArmorDRBenchResult BenchmarkArmorDR(const FArmorTuning& Tuning, int32 NumEvals, int32 TableResolution);
+
+	/** Curve pinned by the innermost FScopedArmorTuningBatch (null outside a batch). */
+	static const FArmorCurve* ActiveBatchCurve;
+
+	/** Cached curve for the current tuning revision. */
+	static const FArmorCurve& GetArmorCurve();
+
+	static void BuildArmorCurve(FArmorCurve& OutCurve, const FArmorTuning& Tuning, bool bWithTable, int32 TableResolution);
+
 	static FArmorTuning ResolveArmorTuning();
 
 	// Returns damage reduction [0..1] for the provided armor value.
@@ -107,6 +107,11 @@ public:
     UUserWidget* GetStatusBarWidget() const;
 
     // Accessors used by overlay manager
+    EStatusBarMode GetMode() const { return Mode; }
+    UWidgetComponent* GetWorldWidgetComponent() const { return WidgetComp; }
+    bool IsYawOnly() const { return bYawOnly; }
+    /** Called by the overlay when it adopts a deferred registration or shuts down. */
+    void SetOverlayManager(UAeyerjiStatusBarOverlayComponent* InOverlayMgr) { OverlayMgr = InOverlayMgr; }
     TSubclassOf<UW_AeyerjiStatusBar> GetStatusBarWidgetClass() const { return StatusBarWidgetClass; }
     const FVector& GetWorldOffset() const { return WorldOffset; }
     const FVector2D& GetOverlayPixelOffset() const { return OverlayPixelOffset; }
@@ -124,7 +129,6 @@ public:
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-    virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
     // World
@@ -134,11 +138,9 @@ private:
     // Overlay
     UPROPERTY(Transient) UAeyerjiStatusBarOverlayComponent* OverlayMgr = nullptr;
 
-    FTimerHandle RetryTimer;
-
     void CreateWorldWidget();
     void CreateHUDWidget();
-    void RegisterWithOverlay();   // robust (retries until PC is ready)
+    void RegisterWithOverlay();   // queued on the overlay, or parked until the local PC/overlay exists
     void CleanupOverlay();
     void BindWidget(UW_AeyerjiStatusBar* WB);
     UAbilitySystemComponent* FindASC() const;
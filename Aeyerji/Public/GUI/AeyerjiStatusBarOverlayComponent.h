@@ -10,10 +10,15 @@
 class UAeyerjiFloatingStatusBarComponent;
 class UW_AeyerjiStatusBar;
 class UAbilitySystemComponent;
+class UWidgetComponent;
 
 /**
  * Local client manager that renders enemy status bars as screen-space widgets.
  * Attach ONE of these to the local PlayerController (AeyerjiPlayerController).
+ *
+ * Owns a pool of pre-constructed status bar widgets, drains a throttled registration queue
+ * (so spawn waves don't build every widget on one frame) and billboards World-mode bars in
+ * a single tick instead of one tick per component.
  */
 UCLASS(ClassGroup=(Aeyerji), meta=(BlueprintSpawnableComponent))
 class AEYERJI_API UAeyerjiStatusBarOverlayComponent : public UActorComponent
@@ -43,10 +48,37 @@ public:
 	UPROPERTY(EditAnywhere, Category="Aeyerji|StatusBars")
 	float EdgePadding = 8.f;
 
-	/** Register a source component (enemy). Returns the widget created (local only). */
+	/** Widgets of DefaultWidgetClass built up-front on BeginPlay (and topped up while idle for other classes). */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|StatusBars|Pool", meta=(ClampMin="0"))
+	int32 PrewarmWidgetCount = 16;
+
+	/** Released widgets beyond this count are destroyed instead of pooled. */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|StatusBars|Pool", meta=(ClampMin="0"))
+	int32 MaxPooledWidgets = 64;
+
+	/** Queued registrations processed per tick. 0 = drain the whole queue at once. */
+	UPROPERTY(EditAnywhere, Category="Aeyerji|StatusBars|Pool", meta=(ClampMin="0"))
+	int32 MaxRegistrationsPerTick = 6;
+
+	/** Returns the overlay on the given local PlayerController, creating it when missing. */
+	static UAeyerjiStatusBarOverlayComponent* FindOrCreateFor(APlayerController* PC);
+
+	/**
+	 * Parks a source until an overlay exists in its world (PC not ready yet, e.g. PIE client timing).
+	 * The overlay adopts every parked source on BeginPlay.
+	 */
+	static void DeferUntilOverlayReady(UAeyerjiFloatingStatusBarComponent* Source);
+
+	/** Removes a parked source that never reached an overlay. */
+	static void CancelDeferred(UAeyerjiFloatingStatusBarComponent* Source);
+
+	/** Queue a source (Overlay or World mode); it is registered on a later tick within MaxRegistrationsPerTick. */
+	void EnqueueSource(UAeyerjiFloatingStatusBarComponent* Source);
+
+	/** Register a source component (enemy) immediately. Returns the widget used (Overlay mode, local only). */
 	UW_AeyerjiStatusBar* RegisterSource(UAeyerjiFloatingStatusBarComponent* Source);
 
-	/** Unregister a previously registered source. */
+	/** Unregister a previously registered or queued source. Its widget goes back to the pool. */
 	void UnregisterSource(UAeyerjiFloatingStatusBarComponent* Source);
 
 protected:
@@ -66,6 +98,43 @@ private:
 	};
 	TArray<FTracked> Tracked;
 
+	/** World-mode widget components faced towards the camera by this manager. */
+	struct FBillboard
+	{
+		TWeakObjectPtr<UAeyerjiFloatingStatusBarComponent> Source;
+		TWeakObjectPtr<UWidgetComponent> WidgetComp;
+		bool bYawOnly = true;
+	};
+	TArray<FBillboard> Billboards;
+
+	/** Idle widgets, collapsed but still in the viewport at ZOrder. */
+	struct FPooledWidget
+	{
+		TWeakObjectPtr<UW_AeyerjiStatusBar> Widget;
+		int32 ZOrder = 0;
+	};
+	TArray<FPooledWidget> WidgetPool;
+
+	/** Strong refs so pooled widgets survive GC even if something pulls them from the viewport. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UW_AeyerjiStatusBar>> PooledWidgetRefs;
+
+	/** Sources waiting for their widget, drained in TickComponent. */
+	TArray<TWeakObjectPtr<UAeyerjiFloatingStatusBarComponent>> PendingSources;
+
+	/** Widget classes seen so far; the pool is topped up to PrewarmWidgetCount for each while idle. */
+	TArray<TSubclassOf<UW_AeyerjiStatusBar>> PrewarmClasses;
+
+	UW_AeyerjiStatusBar* AcquireWidget(TSubclassOf<UW_AeyerjiStatusBar> WidgetClass, int32 ZOrder);
+	void ReleaseWidget(UW_AeyerjiStatusBar* Widget, int32 ZOrder);
+	UW_AeyerjiStatusBar* CreatePooledWidget(TSubclassOf<UW_AeyerjiStatusBar> WidgetClass, int32 ZOrder);
+	int32 CountPooled(TSubclassOf<UW_AeyerjiStatusBar> WidgetClass) const;
+	void DrainPendingSources();
+	void TopUpPool();
+	void TickBillboards();
+	void TickOverlayWidgets(APlayerController* PC);
+	void AdoptDeferredSources();
+
 	bool ProjectToScreen(const FVector& WorldLoc, FVector2D& OutPos) const;
 	bool IsOccluded(const FVector& WorldLoc, const AActor* Ignore) const;
 	APlayerController* GetPC() const
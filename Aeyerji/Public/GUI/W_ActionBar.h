@@ -9,18 +9,26 @@
 #include "Blueprint/UserWidget.h"
 #include "../AeyerjiPlayerState.h"
 #include "Components/HorizontalBox.h"
+#include "GameplayTagContainer.h"
 #include "W_ActionBar.generated.h"
 
 class UHorizontalBox;
 class UW_ActionSlotNative;
 class UAbilitySystemComponent;
 class APawn;
+class APlayerState;
 class UGameplayAbility;
 class UWidget;
 struct FAeyerjiAbilitySlot;
 
-/** Widget class representing an action bar for abilities. */
-UCLASS()
+/**
+ * Widget class representing an action bar for abilities.
+ *
+ * Cooldowns are push-based: the bar listens for each slotted ability's cooldown tags on the owner's ASC, records the
+ * cooldown window once when a tag appears, and animates slots from that window on a timer that only runs while some
+ * slot is cooling down. Idle frames cost nothing.
+ */
+UCLASS(meta=(DisableNativeTick))
 class AEYERJI_API UW_ActionBar : public UUserWidget
 {
 	GENERATED_BODY()	/** One slot per child widget in the designer. */
@@ -63,7 +71,7 @@ protected:
 	FAeyerjiAbilitySlot DefaultPotionSlot;
 
 	virtual void NativeConstruct() override;
-	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual void NativeDestruct() override;
 
 	/* --------- refresh called from delegate --------- */
 	UFUNCTION()
@@ -79,6 +87,10 @@ protected:
 	UFUNCTION()
 	void HandleSwapBlocked(FText Reason, TSubclassOf<UGameplayAbility> AbilityClass);
 
+	/** Respawn/possession: cooldown listeners move to the new pawn's ASC. */
+	UFUNCTION()
+	void HandlePawnSet(APlayerState* Player, APawn* NewPawn, APawn* OldPawn);
+
 	bool ExecuteAbilitySlot(const FAeyerjiAbilitySlot& SlotData);
 
 	UPROPERTY(EditDefaultsOnly, Category="UI")
@@ -103,8 +115,25 @@ protected:
 private:
 	void SetActiveAbilityTooltipSource(UWidget* SourceWidget);
 
-	void UpdateCooldowns();
-	bool TryUpdateSlotCooldown(UAbilitySystemComponent& AbilitySystem, UW_ActionSlotNative& SlotWidget) const;
+	/** Cooldown window for one slot, recorded when its cooldown tag is added. */
+	struct FSlotCooldownState
+	{
+		FGameplayTagContainer CooldownTags;
+		double StartTime = 0.0;
+		float Duration = 0.f;
+		bool bActive = false;
+	};
+
+	/** Drops the old tag listeners and subscribes to the cooldown tags of every slotted ability; seeds running cooldowns. */
+	void RebindCooldownEvents();
+	void UnbindCooldownEvents();
+	void HandleCooldownTagChanged(const FGameplayTag Tag, int32 NewCount);
+	/** Queries the ASC once for the slot's cooldown window. Returns false when nothing matching is running. */
+	bool BeginSlotCooldown(int32 SlotIndex);
+	void EndSlotCooldown(int32 SlotIndex);
+	/** Animates active slots from their recorded windows; stops the timer once none remain. */
+	void TickCooldowns();
+	void ScheduleCooldownTick();
 	UAbilitySystemComponent* ResolveAbilitySystem();
 	void ResetCachedAbilitySystem();
 	/** Applies the configured default potion slot if the target slot is empty. */
@@ -118,10 +147,15 @@ private:
 	/** Resolves the action bar index for the potion slot widget. */
 	int32 ResolvePotionSlotIndex();
 
+	/** Redraw interval for slots that are cooling down; <= 0 redraws every frame. */
 	UPROPERTY(EditDefaultsOnly, Category="Action Bar|Cooldown")
 	float CooldownTickInterval = 0.05f;
 
-	float CooldownTickAccumulator = 0.f;
+	/** Indexed like SlotsBox children. */
+	TArray<FSlotCooldownState> SlotCooldowns;
+	TWeakObjectPtr<UAbilitySystemComponent> CooldownEventASC;
+	TArray<TPair<FGameplayTag, FDelegateHandle>> CooldownTagHandles;
+	FTimerHandle CooldownTimerHandle;
 
 	TWeakObjectPtr<UAbilitySystemComponent> CachedAbilitySystem;
 	TWeakObjectPtr<APawn> CachedPawn;
@@ -138,6 +138,10 @@ public:
                              FGameplayAttribute InHPRegen,
                              FGameplayAttribute InManaRegen);
 
+    /** Drops every attribute binding and resets the visual state so the widget can be reused (pooling). */
+    UFUNCTION(BlueprintCallable, Category="Aeyerji|StatusBar")
+    void UnbindFromAttributes();
+
     /** Optional: let BP decide if this pawn uses a resource (OR-ed with auto and tag detection). */
     UFUNCTION(BlueprintNativeEvent, Category="Aeyerji|StatusBar|Resource")
     bool BP_ShouldShowResource(UAbilitySystemComponent* InASC);
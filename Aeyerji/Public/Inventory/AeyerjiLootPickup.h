@@ -7,6 +7,7 @@
 #include "Components/OutlineHighlightComponent.h"
 #include "GameplayTagContainer.h"
 #include "GameplayEffectTypes.h"
+#include "Systems/AeyerjiLootRegistry.h"
 
 #include "AeyerjiLootPickup.generated.h"
 
@@ -101,6 +102,9 @@ public:
 
 	bool IsHoverTargetComponent(const UPrimitiveComponent* Component) const;
 
+	/** Server-assigned network handle used by pickup RPCs; invalid until replicated to clients. */
+	const FAeyerjiLootHandle& GetLootHandle() const { return LootHandle; }
+
 	// --- Drop motion -------------------------------------------------------
 
 	/** Start the fling+arc drop from the current actor location (SERVER only). */
@@ -112,6 +116,7 @@ public:
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual bool ReplicateSubobjects(UActorChannel* Channel, FOutBunch* Bunch, FReplicationFlags* RepFlags) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaSeconds) override;
 	virtual void OnConstruction(const FTransform& Transform) override;
 	virtual void NotifyActorBeginCursorOver() override;
@@ -302,6 +307,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Replicated, Category = "Loot")
 	int32 SeedOverride = 0;
 
+	/** Handle from UAeyerjiLootRegistry; sent back by clients instead of the actor name. */
+	UPROPERTY(Replicated, Transient)
+	FAeyerjiLootHandle LootHandle;
+
 	UPROPERTY()
 	TSet<TWeakObjectPtr<AAeyerjiPlayerController>> PickupIntents;
 
@@ -366,6 +375,9 @@ private:
 	void ComputeDropEndpoints();
 	void FinalSnapToGround();
 	bool StartPhysicsHandoff(bool bForceImmediate = false);
+
+	/** Puts the pickup net-dormant once its drop has come to rest (SERVER only). */
+	void EnterSettledDormancy();
 	void UpdateLootBeamAnchor();
 	void UpdateLabelVisibility();
 
@@ -314,6 +314,9 @@ public:
 	FAeyerjiInventorySaveData BuildSaveData();
 	void ApplySaveData(const FAeyerjiInventorySaveData& SaveData);
 
+	/** Changes whenever saveable inventory state changes; lets saves skip BuildSaveData when nothing moved. */
+	uint64 GetSaveRevision() const { return SaveRevision; }
+
 	/** Convenience helper for client/UI to request a drop. */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void DropItem(const FGuid& ItemId, FVector WorldLocation, FRotator WorldRotation);
@@ -345,6 +348,14 @@ protected:
 	UFUNCTION()
 	void OnRep_GridSize();
 
+	UFUNCTION()
+	void HandleInventoryChangedForSave();
+
+	UFUNCTION()
+	void HandleEquippedItemChangedForSave(EEquipmentSlot Slot, int32 SlotIndex, UAeyerjiItemInstance* Item);
+
+	void MarkSaveDirty();
+
 	void OnRep_Items();
 
 	void BroadcastItemStateChange(EInventoryItemStateChange Change, UAeyerjiItemInstance* Item, EEquipmentSlot Slot = EEquipmentSlot::Offense, int32 SlotIndex = INDEX_NONE);
@@ -366,6 +377,8 @@ protected:
 
 	TMap<UAeyerjiItemInstance*, FDelegateHandle> ItemChangedDelegateHandles;
 
+	uint64 SaveRevision = 0;
+
 	int32 SanitizeSlotIndex(int32 SlotIndex) const;
 	int32 FindFirstFreeSlotIndex(EEquipmentSlot Slot, const UAeyerjiItemInstance* IgnoredItem = nullptr) const;
 	FEquippedItemEntry* FindEquippedEntry(EEquipmentSlot Slot, int32 SlotIndex);
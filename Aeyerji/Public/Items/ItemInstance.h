@@ -30,6 +30,7 @@ public:
 	virtual bool IsSupportedForNetworking() const override { return true; }
 	virtual bool IsNameStableForNetworking() const override { return true; }
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void BeginDestroy() override;
 
 	UPROPERTY(ReplicatedUsing = OnRep_Definition, EditAnywhere, BlueprintReadOnly, Category = "Item")
 	TObjectPtr<UItemDefinition> Definition;
@@ -128,4 +129,8 @@ protected:
 
 	UFUNCTION()
 	void OnRep_InventorySize();
+
+private:
+	/** Whether this instance was added to STAT_AJ_LiveItemInstances (CDOs/archetypes are not). */
+	bool bCountedAsLive = false;
 };
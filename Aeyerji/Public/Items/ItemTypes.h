@@ -6,6 +6,7 @@
 #include "AttributeSet.h"
 #include "GameplayEffect.h"
 #include "Abilities/GameplayAbility.h"
+#include "Systems/AeyerjiSaveSectionVersion.h"
 
 #include "ItemTypes.generated.h"
 
@@ -57,14 +58,54 @@ struct AEYERJI_API FItemStatModifier
 {
 	GENERATED_BODY()
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	FGameplayAttribute Attribute;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	EItemModOp Op = EItemModOp::Additive;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	float Magnitude = 0.f;
+
+	/**
+	 * Save-game archives skip every field without the SaveGame flag, which includes all of FGameplayAttribute's, so
+	 * save section payloads write the attribute as its property path. Every other archive, legacy SaveGameToSlot files
+	 * and older section payloads included, keeps tagged serialization.
+	 */
+	bool Serialize(FArchive& Ar)
+	{
+		if (!Ar.IsSaveGame() || FAeyerjiSaveSectionVersion::Get(Ar) < FAeyerjiSaveSectionVersion::SaveGameArchive)
+		{
+			return false;
+		}
+
+		FString AttributePath;
+		if (Ar.IsSaving() && Attribute.IsValid())
+		{
+			AttributePath = TFieldPath<FProperty>(Attribute.GetUProperty()).ToString();
+		}
+
+		Ar << AttributePath;
+		Ar << Op;
+		Ar << Magnitude;
+
+		if (Ar.IsLoading())
+		{
+			TFieldPath<FProperty> Path;
+			Path.Generate(*AttributePath);
+			Attribute = FGameplayAttribute(Path.Get());
+		}
+		return true;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FItemStatModifier> : public TStructOpsTypeTraitsBase2<FItemStatModifier>
+{
+	enum
+	{
+		WithSerializer = true,
+	};
 };
 
 USTRUCT(BlueprintType)
@@ -73,15 +114,15 @@ struct AEYERJI_API FItemGrantedEffect
 	GENERATED_BODY()
 
 	/** Gameplay effect class to apply/grant while the item (or affix) is active. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	TSubclassOf<UGameplayEffect> EffectClass;
 
 	/** Base gameplay effect level used when creating the effect spec (can be scaled later by rarity rules). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	float EffectLevel = 1.f;
 
 	/** Optional set of tags to add to the gameplay effect spec when applied. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	FGameplayTagContainer ApplicationTags;
 
 	bool IsValid() const { return EffectClass != nullptr; }
@@ -93,19 +134,19 @@ struct AEYERJI_API FItemGrantedAbility
 	GENERATED_BODY()
 
 	/** Gameplay ability class to grant while the item (or affix) is active. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	TSubclassOf<UGameplayAbility> AbilityClass;
 
 	/** Ability level to grant (passed to the ability spec). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	int32 AbilityLevel = 1;
 
 	/** Optional input binding id to assign when granting the ability (-1 leaves input untouched). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	int32 InputID = INDEX_NONE;
 
 	/** Optional gameplay tags to grant to the ability owner while this ability is equipped. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Item")
 	FGameplayTagContainer OwnedTags;
 
 	bool IsValid() const { return AbilityClass != nullptr; }
@@ -156,19 +197,19 @@ struct AEYERJI_API FRolledAffix
 {
 	GENERATED_BODY()
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Affix")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Affix")
 	FName AffixId;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Affix")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Affix")
 	FText DisplayName;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Affix")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Affix")
 	TArray<FItemStatModifier> FinalModifiers;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Affix")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Affix")
 	TArray<FItemGrantedEffect> GrantedEffects;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Affix")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Affix")
 	TArray<FItemGrantedAbility> GrantedAbilities;
 };
 
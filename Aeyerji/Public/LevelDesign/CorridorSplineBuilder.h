@@ -5,6 +5,7 @@
 #include "GameFramework/Actor.h"
 #include "Components/SplineComponent.h"              // USplineComponent
 #include "Components/SplineMeshComponent.h"          // ESplineMeshAxis, USplineMeshComponent
+#include "LevelDesign/SplineProceduralBuild.h"
 #include "CorridorSplineBuilder.generated.h"
 
 class UStaticMesh;
@@ -52,10 +53,21 @@ public:
 protected:
 	virtual void OnConstruction(const FTransform& Transform) override;
 
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
 private:
 	UPROPERTY(Transient)
 	TArray<USplineMeshComponent*> GeneratedSegments;
 
 	void GatherOrCreateSegments(int32 NumNeeded);
 	void HideExtraSegments(int32 StartIndex);
+
+	FSplineSegmentBuildInput MakeBuildInput() const;
+	/** Sets up the Changed pooled segments from Segments and hides the rest of the pool. */
+	void CommitSegments(TConstArrayView<FSplineSegmentParams> Segments, TConstArrayView<int32> Changed);
+
+	/** Debounced, off-thread cutting while editing; only segments whose endpoints moved are touched. */
+	FSplineProceduralBuild SegmentBuild;
 };
@@ -0,0 +1,106 @@
+// SplineProceduralBuild.h
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SplineComponent.h"              // FSplineCurves
+#include "Containers/Ticker.h"
+
+/** Endpoints and tangents of one spline-mesh segment, in spline-local space. */
+struct AEYERJI_API FSplineSegmentParams
+{
+	FVector StartPos = FVector::ZeroVector;
+	FVector StartTangent = FVector::ZeroVector;
+	FVector EndPos = FVector::ZeroVector;
+	FVector EndTangent = FVector::ZeroVector;
+
+	bool Equals(const FSplineSegmentParams& Other, float Tolerance = 0.01f) const;
+};
+
+/**
+ * Self-contained copy of everything needed to cut a spline into segments. Holds no UObject pointers, so it can be
+ * evaluated on a worker thread while the editor keeps changing the source spline.
+ */
+struct AEYERJI_API FSplineSegmentBuildInput
+{
+	FSplineCurves Curves;
+
+	/** Requested length of each piece along the spline. */
+	float SegmentLength = 100.f;
+
+	/**
+	 * true: round the piece count up and share the length evenly (corridor pieces).
+	 * false: fixed-length pieces with a shorter last one (neon rails).
+	 */
+	bool bDistributeEvenly = false;
+
+	float TangentScale = 1.f;
+
+	/** Added to every endpoint (rail height). */
+	FVector Offset = FVector::ZeroVector;
+
+	/** Snapshots the spline's local-space curves. Game thread only. */
+	static FSplineSegmentBuildInput FromSpline(const USplineComponent& Spline);
+};
+
+namespace AeyerjiSplineBuild
+{
+	/** Cuts Input into segments. Degenerate pieces are skipped, so output index == generated component/instance index. */
+	AEYERJI_API void ComputeSegments(const FSplineSegmentBuildInput& Input, TArray<FSplineSegmentParams>& OutSegments);
+
+	/** Indices of Next that differ from Previous, including every index Previous does not have. */
+	AEYERJI_API void DiffSegments(TConstArrayView<FSplineSegmentParams> Previous, TConstArrayView<FSplineSegmentParams> Next, TArray<int32>& OutChanged);
+}
+
+/**
+ * Shared rebuild driver for spline level-design tools (neon rails, corridors).
+ *
+ * RequestBuild debounces editor changes, cuts the spline on a worker thread and hands the result back to the game thread,
+ * together with the segment indices that actually moved since the last commit; the owner only touches those components.
+ * BuildNow does the same synchronously for game worlds, cooked builds and explicit rebuild buttons.
+ *
+ * Must be a member of the UObject passed as Owner: deferred work is dropped once that object is gone or a newer
+ * request supersedes it.
+ */
+class AEYERJI_API FSplineProceduralBuild
+{
+public:
+	/** Receives every segment and the indices that changed since the previous commit. Game thread. */
+	using FCommitFn = TFunction<void(TConstArrayView<FSplineSegmentParams> /*Segments*/, TConstArrayView<int32> /*Changed*/)>;
+
+	FSplineProceduralBuild() = default;
+	~FSplineProceduralBuild();
+
+	FSplineProceduralBuild(const FSplineProceduralBuild&) = delete;
+	FSplineProceduralBuild& operator=(const FSplineProceduralBuild&) = delete;
+
+	/** Restarts the debounce window; the latest input wins. */
+	void RequestBuild(const UObject* Owner, FSplineSegmentBuildInput&& Input, FCommitFn&& Commit, float DebounceSeconds = 0.15f);
+
+	/** Cancels pending work and commits immediately on the calling (game) thread. */
+	void BuildNow(FSplineSegmentBuildInput&& Input, const FCommitFn& Commit);
+
+	/** Drops any debounced or in-flight build. */
+	void Cancel();
+
+	/** Forget the last commit, e.g. after the generated components were destroyed; the next commit reports every index. */
+	void ResetCommitted() { Committed.Reset(); }
+
+	bool IsBuildPending() const { return DebounceHandle.IsValid() || bInFlight; }
+
+	TConstArrayView<FSplineSegmentParams> GetCommitted() const { return Committed; }
+
+private:
+	void LaunchPending();
+	void CommitResult(uint32 Generation, TArray<FSplineSegmentParams>&& Segments, const FCommitFn& Commit);
+
+	TArray<FSplineSegmentParams> Committed;
+
+	TWeakObjectPtr<const UObject> WeakOwner;
+	TOptional<FSplineSegmentBuildInput> PendingInput;
+	FCommitFn PendingCommit;
+	FTSTicker::FDelegateHandle DebounceHandle;
+
+	/** Bumped by every launch and cancel; results from older generations are discarded. */
+	uint32 BuildGeneration = 0;
+	bool bInFlight = false;
+};
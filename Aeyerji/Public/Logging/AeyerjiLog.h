@@ -3,8 +3,26 @@
 
 #include "CoreMinimal.h"
 
+/**
+ * Most verbose level that is compiled into Aeyerji categories.
+ * Shipping/Test keep warnings and errors only, so AJ_LOG / Verbose traces vanish entirely (format strings included).
+ * Override from Build.cs (e.g. AJ_LOG_COMPILETIME_VERBOSITY=Log) to keep more in a test build.
+ */
+#ifndef AJ_LOG_COMPILETIME_VERBOSITY
+	#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+		#define AJ_LOG_COMPILETIME_VERBOSITY Warning
+	#else
+		#define AJ_LOG_COMPILETIME_VERBOSITY All
+	#endif
+#endif
+
 /** Unified log channel for every Aeyerji trace. */
-DECLARE_LOG_CATEGORY_EXTERN(LogAeyerji, Log, All);
+DECLARE_LOG_CATEGORY_EXTERN(LogAeyerji, Log, AJ_LOG_COMPILETIME_VERBOSITY);
+
+/** Per-subsystem channels, so a noisy area can be raised (`log LogAeyerjiLoot Verbose`) without the rest. */
+DECLARE_LOG_CATEGORY_EXTERN(LogAeyerjiLoot, Log, AJ_LOG_COMPILETIME_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogAeyerjiInventory, Log, AJ_LOG_COMPILETIME_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogAeyerjiUI, Log, AJ_LOG_COMPILETIME_VERBOSITY);
 
 /*--------------------------  INTERNAL HELPERS  ---------------------------*/
 namespace Aeyerji::Detail
@@ -32,10 +50,43 @@ namespace Aeyerji::Detail
 	{
 		return Obj ? Obj->GetClass()->GetName() : TEXT("Static");
 	}
+
+	/** Per-call-site state for AJ_LOG_THROTTLED. */
+	struct FLogThrottle
+	{
+		uint64 Frame = MAX_uint64;
+		int32 EmittedThisFrame = 0;
+		int32 Collapsed = 0;
+	};
+
+	/**
+	 * Spends one message of the call site's per-frame budget (aeyerji.Log.FrameBudgetPerSite).
+	 * Returns false when the message should be dropped; OutCollapsed receives how many earlier messages from this
+	 * site were dropped and not yet reported.
+	 */
+	AEYERJI_API bool ConsumeLogBudget(FLogThrottle& Throttle, int32& OutCollapsed);
 } // namespace Aeyerji::Detail
 
 /*-----------------------------  PUBLIC MACROS  ----------------------------*/
 
+/**
+ * AJ_LOG_CAT(LogAeyerjiLoot, Verbose, ObjPtr, TEXT("Fmt %d"), Args...)
+ *
+ * Nothing after the verbosity check is evaluated (object cast, class name, format arguments) unless the category
+ * would actually print, and the whole statement compiles out below AJ_LOG_COMPILETIME_VERBOSITY.
+ */
+#define AJ_LOG_CAT(Category, Verbosity, ObjPtr, Fmt, ...)                              \
+do {                                                                                   \
+	if (UE_LOG_ACTIVE(Category, Verbosity))                                          \
+	{                                                                                  \
+		const UObject* AjLogObj = Cast<const UObject>(ObjPtr);                      \
+		UE_LOG(Category, Verbosity, TEXT("[%s] %s: " Fmt),                          \
+			Aeyerji::Detail::GetSide(AjLogObj),                                     \
+			*Aeyerji::Detail::GetClass(AjLogObj),                                   \
+			##__VA_ARGS__);                                                         \
+	}                                                                                  \
+} while (0)
+
 /**
  * AJ_LOG(ObjPtr, TEXT("Fmt %d"), Args...)
  *
@@ -43,13 +94,38 @@ namespace Aeyerji::Detail
  * - Prints:   [SERVER] MyCharacter: Your message
  *             [CLIENT] BP_ActionBar_C_0: Refreshed slot %d
  */
-#define AJ_LOG(ObjPtr, Fmt, ...)                                                        \
+#define AJ_LOG(ObjPtr, Fmt, ...) AJ_LOG_CAT(LogAeyerji, Log, ObjPtr, Fmt, ##__VA_ARGS__)
+
+/** AJ_LOG at an explicit verbosity on LogAeyerji. */
+#define AJ_LOG_V(Verbosity, ObjPtr, Fmt, ...) AJ_LOG_CAT(LogAeyerji, Verbosity, ObjPtr, Fmt, ##__VA_ARGS__)
+
+/**
+ * AJ_LOG_CAT for call sites that can fire many times per frame (ticks, per-slot/per-item loops).
+ * Each site prints at most aeyerji.Log.FrameBudgetPerSite messages per frame; the rest are counted and reported as
+ * one "collapsed" line the next time the site is allowed to print.
+ */
+#define AJ_LOG_THROTTLED(Category, Verbosity, ObjPtr, Fmt, ...)                        \
 do {                                                                                   \
-	const UObject* AjLogObj = Cast<const UObject>(ObjPtr);                          \
-	UE_LOG(LogAeyerji, Log, TEXT("[%s] %s: " Fmt),                                  \
-		Aeyerji::Detail::GetSide(AjLogObj),                                         \
-		*Aeyerji::Detail::GetClass(AjLogObj),                                       \
-		##__VA_ARGS__);                                                             \
+	if (UE_LOG_ACTIVE(Category, Verbosity))                                          \
+	{                                                                                  \
+		static Aeyerji::Detail::FLogThrottle AjLogThrottle;                         \
+		int32 AjLogCollapsed = 0;                                                   \
+		if (Aeyerji::Detail::ConsumeLogBudget(AjLogThrottle, AjLogCollapsed))       \
+		{                                                                              \
+			const UObject* AjLogObj = Cast<const UObject>(ObjPtr);                  \
+			if (AjLogCollapsed > 0)                                                 \
+			{                                                                          \
+				UE_LOG(Category, Verbosity, TEXT("[%s] %s: (%d similar messages collapsed)"), \
+					Aeyerji::Detail::GetSide(AjLogObj),                             \
+					*Aeyerji::Detail::GetClass(AjLogObj),                           \
+					AjLogCollapsed);                                                \
+			}                                                                          \
+			UE_LOG(Category, Verbosity, TEXT("[%s] %s: " Fmt),                      \
+				Aeyerji::Detail::GetSide(AjLogObj),                                 \
+				*Aeyerji::Detail::GetClass(AjLogObj),                               \
+				##__VA_ARGS__);                                                     \
+		}                                                                              \
+	}                                                                                  \
 } while (0)
 
 /** Convenience when you have no object context (compiles to STANDALONE). */
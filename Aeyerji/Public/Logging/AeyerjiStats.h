@@ -0,0 +1,68 @@
+// ------------------------------ AeyerjiStats.h ------------------------------
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Profiling surface for gameplay code: `stat Aeyerji` in game, named scopes in Unreal Insights.
+ * Counters are grouped by prefix (Director / Loot / Inventory / Cursor / Combat / Camera / AI) so regressions in a
+ * capture can be attributed to a system instead of an anonymous Blueprint frame.
+ */
+DECLARE_STATS_GROUP(TEXT("Aeyerji"), STATGROUP_Aeyerji, STATCAT_Advanced);
+
+// Encounter director
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Director Tick"), STAT_AJ_DirectorTick, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Director ProcessSpawnQueue"), STAT_AJ_ProcessSpawnQueue, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Director UpdateEnemyLOD"), STAT_AJ_UpdateEnemyLOD, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Director CleanupInactiveEnemies"), STAT_AJ_CleanupInactiveEnemies, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Director ApplyArchetype"), STAT_AJ_ApplyArchetype, STATGROUP_Aeyerji, AEYERJI_API);
+
+// Loot rolls
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Loot RollLoot"), STAT_AJ_LootRoll, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Loot RollMultiDrop"), STAT_AJ_LootRollMultiDrop, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Loot RollItemInstance"), STAT_AJ_LootRollItemInstance, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Loot ChooseAffixes"), STAT_AJ_LootChooseAffixes, STATGROUP_Aeyerji, AEYERJI_API);
+
+// Inventory mutations
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory AddItem"), STAT_AJ_InventoryAdd, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory RemoveItem"), STAT_AJ_InventoryRemove, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory Equip"), STAT_AJ_InventoryEquip, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory Unequip"), STAT_AJ_InventoryUnequip, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Inventory RebuildSnapshots"), STAT_AJ_InventoryRebuildSnapshots, STATGROUP_Aeyerji, AEYERJI_API);
+
+// Cursor / click-to-move
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cursor Trace"), STAT_AJ_CursorTrace, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cursor MouseNavContext"), STAT_AJ_MouseNavContext, STATGROUP_Aeyerji, AEYERJI_API);
+
+// Combat / camera
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat MeleeSweep"), STAT_AJ_MeleeSweep, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat DeathPresentation"), STAT_AJ_DeathPresentation, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat ElitePresentation"), STAT_AJ_ElitePresentation, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera OcclusionSweep"), STAT_AJ_OcclusionSweep, STATGROUP_Aeyerji, AEYERJI_API);
+
+// StateTree
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI StateTree Tasks"), STAT_AJ_StateTreeTask, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI StateTree Conditions"), STAT_AJ_StateTreeCondition, STATGROUP_Aeyerji, AEYERJI_API);
+
+// Environment
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Environment NeonFlicker"), STAT_AJ_NeonFlicker, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Environment SplineBuildCommit"), STAT_AJ_SplineBuildCommit, STATGROUP_Aeyerji, AEYERJI_API);
+
+// Live object counts
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Loot Pickups"), STAT_AJ_LivePickups, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Projectiles"), STAT_AJ_LiveProjectiles, STATGROUP_Aeyerji, AEYERJI_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Item Instances"), STAT_AJ_LiveItemInstances, STATGROUP_Aeyerji, AEYERJI_API);
+
+/**
+ * AJ_SCOPE_CYCLE(STAT_AJ_Xxx)
+ *
+ * Cycle counter when stats are compiled in (cycle stats also show up as Insights CPU scopes);
+ * in builds without STATS (Test) it degrades to a plain named Insights scope so captures still attribute time.
+ */
+#if STATS
+	#define AJ_SCOPE_CYCLE(Stat) SCOPE_CYCLE_COUNTER(Stat)
+#else
+	#define AJ_SCOPE_CYCLE(Stat) TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#endif
@@ -29,43 +29,43 @@ struct AEYERJI_API FPlayerLootStats
 	static constexpr int32 RollingWindowSize = 100;
 
 	/** Total number of items ever dropped, indexed by rarity. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
 	TArray<int32> TotalItemsDroppedByRarity;
 
 	/** Total number of items ever picked up, indexed by rarity. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
 	TArray<int32> TotalItemsPickedUpByRarity;
 
 	/** Total number of legendary (or better) drops witnessed. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
 	int32 TotalLegendariesDropped = 0;
 
 	/** Total number of legendary (or better) pickups made. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
 	int32 TotalLegendariesPickedUp = 0;
 
 	/** How many drops have occurred since the last legendary drop event. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
 	int32 DropsSinceLastLegendary = 0;
 
 	/** Circular buffer of the last 100 drop outcomes (0 = non-legendary, 1 = legendary). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
 	TArray<uint8> Last100Drops;
 
 	/** Write index into Last100Drops (wraps at 100). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
 	int32 WindowIndex = 0;
 
 	/** Number of valid entries currently stored in the rolling buffer (<= RollingWindowSize). */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
 	int32 WindowCount = 0;
 
 	/** Current count of legendary drops within the rolling buffer. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Rolling")
 	int32 LegendariesInWindow = 0;
 
 	/** Optional per-item pickup counts keyed by item identifier. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
+	UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Aeyerji|Loot|Stats")
 	TMap<FName, int32> ItemsPickedUpById;
 
 	/** Clears all counters back to zero. */
@@ -15,6 +15,7 @@
 class UAeyerjiInventoryComponent;
 class UAeyerjiItemInstance;
 class UAeyerjiLevelingComponent;
+class UAeyerjiSaveGame;
 class UGameplayEffect;
 class USkeletalMeshComponent;
 class UWeaponEquipmentComponent;
@@ -154,4 +155,9 @@ private:
 	// Guards against repeated load RPCs and duplicate server loads.
 	bool bSaveLoadRequested = false;
 	bool bSaveLoaded = false;
+	// Server: an async slot read for this character has not come back yet.
+	bool bServerSaveLoadInFlight = false;
+
+	/** Server: applies a loaded (or freshly created) slot to this character and reports the result to the owner. */
+	void ApplyLoadedCharacter(const FString& Slot, UAeyerjiSaveGame* Data, bool bLoadedExisting);
 };
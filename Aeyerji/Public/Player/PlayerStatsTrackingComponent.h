@@ -39,6 +39,9 @@ public:
 	/** Copies current loot stats into an external struct (e.g., for saving). */
 	void ExtractLootStats(FPlayerLootStats& OutStats) const;
 
+	/** Changes whenever LootStats is mutated; lets saves skip re-capturing unchanged stats. */
+	uint64 GetSaveRevision() const { return SaveRevision; }
+
 	/** True if the player has ever picked up the given item identifier. */
 	UFUNCTION(BlueprintPure, Category = "Aeyerji|Loot|Stats")
 	bool HasPickedUpItemId(FName ItemId) const;
@@ -53,4 +56,7 @@ private:
 	void TrackDropRarity(EItemRarity Rarity);
 	void TrackPickupRarity(EItemRarity Rarity);
 	void UpdateLegendaryRollingWindow(bool bLegendaryDrop);
+	void MarkSaveDirty();
+
+	uint64 SaveRevision = 0;
 };
@@ -43,7 +43,7 @@ public:
     UFUNCTION(BlueprintCallable, Category="Aeyerji|Leveling")
     void AddReapplyInfiniteEffect(TSubclassOf<UGameplayEffect> GEClass);
 
-    /** Re-run internal refresh for current level (re-grant abilities and re-apply infinite GEs). */
+    /** Re-run internal refresh for current level (ability spec levels and infinite GE levels), immediately. */
     UFUNCTION(BlueprintCallable, Category="Aeyerji|Leveling")
     void ForceRefreshForCurrentLevel();
 
@@ -66,11 +66,11 @@ private:
     UPROPERTY(EditAnywhere, Category="Aeyerji|Leveling")
     FCurveTableRowHandle XPToReachLevelRow;
 
-    /** Infinite effects to re-apply on level change (so their ScalableFloat re-evaluates level). */
+    /** Infinite effects kept at the owner's level (their active level is updated in place so ScalableFloats re-evaluate). */
     UPROPERTY(EditAnywhere, Category="Aeyerji|Leveling")
     TArray<TSubclassOf<UGameplayEffect>> ReapplyInfiniteEffectsOnLevelUp;
 
-    /** Abilities owned by this pawn; we re-grant them on level changes. */
+    /** Abilities owned by this pawn; existing specs are re-leveled in place on level changes, missing ones granted. */
     UPROPERTY(EditAnywhere, Category="Aeyerji|Leveling")
     TArray<FLevelScaledAbility> AbilitiesToOwn;
 
@@ -83,6 +83,10 @@ private:
     void  RefreshOwnedAbilities() const;
     void  ReapplyInfiniteEffects() const;
 
+    /** Queues one refresh for the next tick so several level-ups in a frame (XP bursts) apply as a single update. */
+    void  QueueLevelRefresh();
+    void  FlushLevelRefresh();
+
     void  ServerSetXP(float NewXP) const;
     void  ServerSetXPMax(float NewXPMax) const;
     void  ServerSetLevel(int32 NewLevel) const;
@@ -90,4 +94,5 @@ private:
 private:
     mutable TWeakObjectPtr<UAbilitySystemComponent>        CachedASC;
     mutable TWeakObjectPtr<const UAeyerjiAttributeSet>     CachedAttr; // const matches GetSet<T>() const
+    bool                                                   bLevelRefreshQueued = false;
 };
@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AeyerjiCorpseActor.generated.h"
+
+class UPoseableMeshComponent;
+class USkeletalMeshComponent;
+
+/**
+ * Local-only frozen corpse: a poseable mesh holding the last pose of a dead character's skeletal mesh.
+ * Pooled and recycled by UAeyerjiDeathPresentationSubsystem; never replicated, never simulated, no collision.
+ */
+UCLASS(NotBlueprintable, Transient)
+class AEYERJI_API AAeyerjiCorpseActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AAeyerjiCorpseActor();
+
+	/** Copies mesh, materials, transform and the current (ragdoll) pose from Source and shows the corpse. */
+	void ShowPoseOf(USkeletalMeshComponent& Source);
+
+	/** Hides the corpse and drops its asset references so it can wait in the pool. */
+	void Release();
+
+	UPoseableMeshComponent* GetPoseableMesh() const { return PoseableMesh; }
+
+private:
+	UPROPERTY(VisibleAnywhere, Category = "Corpse")
+	TObjectPtr<UPoseableMeshComponent> PoseableMesh;
+};
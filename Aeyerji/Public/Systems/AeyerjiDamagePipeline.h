@@ -0,0 +1,124 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "GameplayEffectTypes.h"
+#include "GameplayPrediction.h"
+#include "GameplayTagContainer.h"
+#include "AeyerjiDamagePipeline.generated.h"
+
+class AActor;
+class UAbilitySystemComponent;
+class UGameplayEffect;
+struct FGameplayAbilityTargetDataHandle;
+
+/** Shared spec template for a damage batch: every target receives the same outgoing spec. */
+USTRUCT(BlueprintType)
+struct AEYERJI_API FAeyerjiDamageSpecTemplate
+{
+	GENERATED_BODY()
+
+	/** Damage GE; resolved (and loaded at most once per session) by the pipeline. Falls back to UGE_DamagePhysical. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeyerji|Damage")
+	TSoftClassPtr<UGameplayEffect> EffectClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeyerji|Damage")
+	float Level = 1.f;
+
+	/** SetByCaller tag receiving Magnitude. Defaults to SetByCaller.Damage.Instant when unset. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeyerji|Damage")
+	FGameplayTag SetByCallerTag;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeyerji|Damage")
+	float Magnitude = 0.f;
+
+	/** Optional dynamic asset tag (e.g. Damage.Type.Physical). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeyerji|Damage")
+	FGameplayTag DamageTypeTag;
+
+	/** Added to the effect context (ability, patch actor, ...). */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Aeyerji|Damage")
+	TObjectPtr<UObject> SourceObject = nullptr;
+};
+
+/** Aggregated outcome of one damage batch (one per ability hit, not per target). */
+USTRUCT(BlueprintType)
+struct AEYERJI_API FAeyerjiDamageBatchResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Aeyerji|Damage")
+	TObjectPtr<AActor> Instigator = nullptr;
+
+	/** Actors whose ASC received the spec. */
+	UPROPERTY(BlueprintReadOnly, Category="Aeyerji|Damage")
+	TArray<TObjectPtr<AActor>> HitActors;
+
+	/** Targets rejected (no ASC, dead, duplicate). */
+	UPROPERTY(BlueprintReadOnly, Category="Aeyerji|Damage")
+	int32 TargetsSkipped = 0;
+
+	/** Sum of HP lost across the batch after mitigation. */
+	UPROPERTY(BlueprintReadOnly, Category="Aeyerji|Damage")
+	float TotalDamage = 0.f;
+
+	/** Targets that reached 0 HP during this batch. */
+	UPROPERTY(BlueprintReadOnly, Category="Aeyerji|Damage")
+	int32 Kills = 0;
+};
+
+/**
+ * Applies one shared damage spec to many targets.
+ * Resolves the GE class once, pins armor tuning for the whole batch and emits a single
+ * aggregated event (native delegate + Event.Damage.BatchApplied) for UI and telemetry.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiDamagePipeline : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_MULTICAST_DELEGATE_OneParam(FOnDamageBatchApplied, const FAeyerjiDamageBatchResult&);
+
+	static UAeyerjiDamagePipeline* Get(const UObject* WorldContext);
+
+	/** Fired once per batch on the server after every target has been processed. */
+	FOnDamageBatchApplied OnDamageBatchApplied;
+
+	/** Resolves a soft GE class, caching the loaded class so LoadSynchronous runs once per path. */
+	TSubclassOf<UGameplayEffect> ResolveEffectClass(const TSoftClassPtr<UGameplayEffect>& SoftClass);
+
+	/** Builds the shared outgoing spec for a batch. Invalid handle when the source ASC is missing. */
+	FGameplayEffectSpecHandle MakeSpecTemplate(UAbilitySystemComponent* SourceASC,
+	                                           const FAeyerjiDamageSpecTemplate& Template,
+	                                           FGameplayEffectContextHandle Context = FGameplayEffectContextHandle());
+
+	/** Applies an already-built spec to every target (authority only). */
+	FAeyerjiDamageBatchResult ApplySpecToTargets(UAbilitySystemComponent* SourceASC,
+	                                             const FGameplayEffectSpecHandle& SpecHandle,
+	                                             TConstArrayView<AActor*> Targets,
+	                                             FPredictionKey PredictionKey = FPredictionKey());
+
+	/**
+	 * Applies an already-built spec to every actor in TargetData (authority only). Each target data entry gets its own
+	 * spec copy with a duplicated context carrying that entry's hit result, as UGameplayAbility's own path does.
+	 */
+	FAeyerjiDamageBatchResult ApplySpecToTargetData(UAbilitySystemComponent* SourceASC,
+	                                                const FGameplayEffectSpecHandle& SpecHandle,
+	                                                const FGameplayAbilityTargetDataHandle& TargetData,
+	                                                FPredictionKey PredictionKey = FPredictionKey());
+
+	/** Builds the spec from the template and applies it to every target. */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="Aeyerji|Damage")
+	FAeyerjiDamageBatchResult ApplyDamageBatch(UAbilitySystemComponent* SourceASC,
+	                                           const FAeyerjiDamageSpecTemplate& Template,
+	                                           const TArray<AActor*>& Targets);
+
+private:
+	/** Loaded GE classes keyed by soft path. */
+	UPROPERTY(Transient)
+	TMap<FSoftObjectPath, TSubclassOf<UGameplayEffect>> ResolvedEffectClasses;
+
+	void BroadcastBatch(const FAeyerjiDamageBatchResult& Result) const;
+};
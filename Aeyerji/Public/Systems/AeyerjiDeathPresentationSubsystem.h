@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AeyerjiCharacter.h"
+#include "AeyerjiDeathPresentationSubsystem.generated.h"
+
+class AAeyerjiCorpseActor;
+class ACharacter;
+
+/**
+ * Per-world death presentation.
+ *
+ * Server: deaths queued during a frame go out next tick as one unreliable AAeyerjiGameState::MulticastDeathBatch
+ * instead of two reliable multicasts per victim. AAeyerjiCharacter::bIsDead backs it up when the packet is lost or
+ * the corpse becomes relevant later.
+ *
+ * Local (clients, listen servers, standalone): at most aeyerji.Death.MaxRagdolls ragdolls simulate at once. A ragdoll
+ * is frozen into a pooled AAeyerjiCorpseActor when the cap needs its slot, after aeyerji.Death.RagdollSeconds, or when
+ * its character is destroyed; corpses sink out after aeyerji.Death.CorpseSeconds and go back to the pool.
+ * Dedicated servers never simulate ragdolls.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiDeathPresentationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UAeyerjiDeathPresentationSubsystem* Get(const UObject* WorldContext);
+
+	/** Routes through the subsystem when there is one, otherwise starts the ragdoll directly. */
+	static bool RequestRagdollFor(ACharacter* Char, const FVector& Impulse = FVector::ZeroVector, const FVector& ImpulseWorldLocation = FVector::ZeroVector, FName BoneName = NAME_None);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Server: queues a death for the next batched multicast. */
+	void QueueDeathEvent(const FAeyerjiDeathEvent& Event);
+
+	/** Client: applies a batch received from the server. */
+	void HandleDeathBatch(const TArray<FAeyerjiDeathEvent>& Events);
+
+	/**
+	 * Starts a ragdoll for Char under the simultaneous-ragdoll cap, freezing the oldest one if needed. Repeat requests
+	 * for the same character are ignored. On dedicated servers only stops movement and mesh collision.
+	 * Returns true when Char's mesh is (or already was) simulating.
+	 */
+	bool RequestRagdoll(ACharacter* Char, const FVector& Impulse = FVector::ZeroVector, const FVector& ImpulseWorldLocation = FVector::ZeroVector, FName BoneName = NAME_None);
+
+	/** Char is being destroyed: freezes its ragdoll into a corpse so the body outlives the actor. */
+	void HandleCharacterRemoved(ACharacter* Char);
+
+	int32 GetActiveRagdollCount() const { return ActiveRagdolls.Num(); }
+	int32 GetActiveCorpseCount() const { return ActiveCorpses.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FActiveRagdoll
+	{
+		TWeakObjectPtr<ACharacter> Character;
+		double StartTime = 0.0;
+	};
+
+	struct FActiveCorpse
+	{
+		TWeakObjectPtr<AAeyerjiCorpseActor> Corpse;
+		double ShownTime = 0.0;
+		FVector RestLocation = FVector::ZeroVector;
+	};
+
+	bool IsPresentationWorld() const;
+	void FlushDeathEvents();
+
+	/** Snapshots ActiveRagdolls[Index] into a corpse and stops its physics. */
+	void FreezeRagdoll(int32 Index);
+	AAeyerjiCorpseActor* AcquireCorpse();
+	void ReleaseCorpse(int32 Index);
+
+	/** Server: deaths since the last flush. */
+	UPROPERTY(Transient)
+	TArray<FAeyerjiDeathEvent> PendingEvents;
+
+	bool bFlushQueued = false;
+
+	/** Oldest first. */
+	TArray<FActiveRagdoll> ActiveRagdolls;
+	TArray<FActiveCorpse> ActiveCorpses;
+
+	/** Characters that already went through RequestRagdoll, so montage-end and death-state paths do not restart it. */
+	TSet<TWeakObjectPtr<ACharacter>> RagdolledCharacters;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AAeyerjiCorpseActor>> FreeCorpses;
+};
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AeyerjiElitePresentationSubsystem.generated.h"
+
+class UAeyerjiEliteAffixComponent;
+class UNiagaraComponent;
+class UNiagaraSystem;
+
+/**
+ * Level-wide elite FX budget (local only, not created on dedicated servers).
+ *
+ * Every aeyerji.Elite.PresentationInterval seconds, registered elites are ranked by distance from the local view
+ * divided by threat (rank and affix count). Walking that order, an elite within aeyerji.Elite.FullDetailDistance gets
+ * its aura plus one system per affix, one further out (or once the budget runs short) gets a single cheap aura
+ * (AAeyerjiSpawnerGroup::EliteReducedVFXSystem), and anything beyond aeyerji.Elite.AuraCullDistance or past
+ * aeyerji.Elite.MaxNiagaraComponents gets nothing. Components come from the Niagara world pool (manual release) so
+ * tier changes and deaths recycle them instead of allocating.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiElitePresentationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UAeyerjiElitePresentationSubsystem* Get(const UObject* WorldContext);
+
+	/** Adds Elite (or refreshes it after its affix state changed); FX follow on the next budget pass. */
+	void RegisterElite(UAeyerjiEliteAffixComponent* Elite);
+	void UnregisterElite(UAeyerjiEliteAffixComponent* Elite);
+
+	int32 GetNumElites() const { return Elites.Num(); }
+	int32 GetNumActiveComponents() const;
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	enum class ETier : uint8
+	{
+		None,
+		Aura,
+		Full
+	};
+
+	struct FEliteFX
+	{
+		TWeakObjectPtr<UAeyerjiEliteAffixComponent> Elite;
+		ETier Tier = ETier::None;
+		TWeakObjectPtr<UNiagaraComponent> Aura;
+		TWeakObjectPtr<UNiagaraSystem> AuraSystem;
+		TArray<TWeakObjectPtr<UNiagaraComponent>> AffixFX;
+	};
+
+	void UpdateBudget();
+	void ApplyTier(FEliteFX& Entry, ETier NewTier);
+	void ReleaseAll(FEliteFX& Entry);
+	void Release(TWeakObjectPtr<UNiagaraComponent>& Component);
+	UNiagaraComponent* Acquire(const UAeyerjiEliteAffixComponent& Elite, UNiagaraSystem* System, FName Socket, const FVector& Offset);
+
+	TArray<FEliteFX> Elites;
+	float TimeUntilUpdate = 0.f;
+};
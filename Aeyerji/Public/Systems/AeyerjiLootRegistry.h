@@ -0,0 +1,91 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AeyerjiLootRegistry.generated.h"
+
+class AAeyerjiLootPickup;
+
+/**
+ * Compact network handle for a loot pickup: slot index + generation serial, 32 bits on the wire.
+ * A handle whose slot has since been reused (or freed) fails its serial check and resolves to nothing.
+ */
+USTRUCT(BlueprintType)
+struct AEYERJI_API FAeyerjiLootHandle
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint16 Index = 0;
+
+	/** 0 = invalid handle; live slots always carry a non-zero serial. */
+	UPROPERTY()
+	uint16 Serial = 0;
+
+	bool IsValid() const { return Serial != 0; }
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+	{
+		Ar << Index;
+		Ar << Serial;
+		bOutSuccess = true;
+		return true;
+	}
+
+	bool operator==(const FAeyerjiLootHandle& Other) const { return Index == Other.Index && Serial == Other.Serial; }
+	bool operator!=(const FAeyerjiLootHandle& Other) const { return !(*this == Other); }
+
+	FString ToString() const { return FString::Printf(TEXT("%u:%u"), Index, Serial); }
+};
+
+template<>
+struct TStructOpsTypeTraits<FAeyerjiLootHandle> : public TStructOpsTypeTraitsBase2<FAeyerjiLootHandle>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
+
+/**
+ * Per-world registry of live loot pickups.
+ * The server hands out FAeyerjiLootHandles so pickup RPCs resolve in O(1) instead of scanning the world;
+ * every net mode also keeps a flat list for "all pickups" passes (label toggles, debug refresh).
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiLootRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UAeyerjiLootRegistry* Get(const UObject* WorldContext);
+
+	/** Tracks the pickup; on authority also assigns and returns its handle. */
+	FAeyerjiLootHandle Register(AAeyerjiLootPickup* Pickup);
+
+	/** Stops tracking the pickup and retires its handle (the slot's serial advances). */
+	void Unregister(AAeyerjiLootPickup* Pickup, const FAeyerjiLootHandle& Handle);
+
+	/** Server-side lookup; returns nullptr for invalid, retired or reused handles. */
+	AAeyerjiLootPickup* Resolve(const FAeyerjiLootHandle& Handle) const;
+
+	/** Live pickups in this world (may include entries pending destroy; check IsValid). */
+	const TArray<TWeakObjectPtr<AAeyerjiLootPickup>>& GetPickups() const { return Pickups; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FSlot
+	{
+		TWeakObjectPtr<AAeyerjiLootPickup> Pickup;
+		uint16 Serial = 1;
+		bool bInUse = false;
+	};
+
+	TArray<FSlot> Slots;
+	TArray<uint16> FreeSlots;
+	TArray<TWeakObjectPtr<AAeyerjiLootPickup>> Pickups;
+};
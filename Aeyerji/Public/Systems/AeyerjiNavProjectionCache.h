@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AeyerjiNavProjectionCache.generated.h"
+
+class ANavigationData;
+class ULevel;
+
+/**
+ * Per-world memo of ProjectPointToNavigation results for click-to-move goal solving.
+ *
+ * Queries are keyed on a quantized cell (XY cell + coarse Z band) plus a bucketed query extent, so repeated clicks,
+ * cursor-follow repaths and smart-goal fans around a stationary target reuse earlier answers; misses are cached too.
+ * A hit returns the projection computed for the first query in that cell, i.e. within about half a cell of an exact
+ * query (aeyerji.Nav.ProjectionCacheCellSize).
+ *
+ * The whole cache is dropped whenever navmesh generation finishes (tile rebuilds from dynamic obstacles included),
+ * nav data registers, or a level streams in/out.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiNavProjectionCache : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UAeyerjiNavProjectionCache* Get(const UObject* WorldContext);
+
+	/**
+	 * Cached ProjectPointToNavigation against the world's default nav data.
+	 * Falls through to the navigation system when no cache exists for WorldContext (editor worlds) or caching is off.
+	 * @param bOutQueriedNavMesh set when the answer was not cached and the navmesh was actually queried.
+	 */
+	static bool ProjectPoint(const UObject* WorldContext, const FVector& Point, const FVector& Extent, FVector& OutLocation, bool* bOutQueriedNavMesh = nullptr);
+
+	bool Project(const FVector& Point, const FVector& Extent, FVector& OutLocation, bool* bOutQueriedNavMesh = nullptr);
+
+	/** Drops every cached projection. */
+	void Invalidate();
+
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FCacheKey
+	{
+		FIntVector Cell;
+		FIntVector ExtentBucket;
+
+		bool operator==(const FCacheKey& Other) const { return Cell == Other.Cell && ExtentBucket == Other.ExtentBucket; }
+		friend uint32 GetTypeHash(const FCacheKey& Key) { return HashCombine(GetTypeHash(Key.Cell), GetTypeHash(Key.ExtentBucket)); }
+	};
+
+	struct FCacheEntry
+	{
+		FVector Location = FVector::ZeroVector;
+		bool bOnNavMesh = false;
+	};
+
+	void BindNavigationEvents();
+
+	UFUNCTION()
+	void HandleNavDataChanged(ANavigationData* NavData);
+
+	void HandleLevelStreamingChanged(ULevel* Level, UWorld* InWorld);
+
+	TMap<FCacheKey, FCacheEntry> Entries;
+
+	bool bNavigationEventsBound = false;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+
+	uint32 NumHits = 0;
+	uint32 NumMisses = 0;
+};
@@ -0,0 +1,89 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "AeyerjiReplicationGraph.generated.h"
+
+class AActor;
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+
+/** How an actor class is routed into the graph. */
+UENUM()
+enum class EAeyerjiClassRepNodeMapping : uint8
+{
+	NotRouted,				// Handled by per-connection nodes (player controllers) or not replicated through the graph.
+	RelevantAllConnections,	// Game state, player states and other bAlwaysRelevant actors.
+	OwnerOnly,				// bOnlyRelevantToOwner actors; replicated only to the owning connection.
+	Spatialize_Static,		// Spawned in place and never moves (hazard patches).
+	Spatialize_Dynamic,		// Moves every frame (players, projectiles).
+	Spatialize_Dormancy,	// Moves only while awake; dormant actors are treated as static (loot, enemies).
+};
+
+/**
+ * Per-connection node: the connection's controller, view target, pawn (which carries the inventory component) and
+ * player state, plus every owner-only actor whose net connection is this one.
+ */
+UCLASS(Transient)
+class AEYERJI_API UAeyerjiReplicationGraphNode_AlwaysRelevant_ForConnection : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	/** Owner-only actors shared by every connection node; filtered by net connection during gather. */
+	const TArray<TWeakObjectPtr<AActor>>* OwnerOnlyActors = nullptr;
+
+private:
+	FActorRepListRefView OwnerActorList;
+};
+
+/**
+ * Replication graph for the game net driver.
+ *
+ * Enemies, loot pickups, projectiles and hazard patches go into a 2D spatial grid so relevancy is a cell lookup instead
+ * of a per-actor distance check. Pickups and sleeping fixed-cluster enemies are dormant most of their life; the grid
+ * parks dormant actors in its static lists, so they cost nothing until they wake. Game state and player states are
+ * relevant to everyone; each connection additionally gets its own pawn and owner-only actors.
+ *
+ * Created for game net drivers in game/PIE worlds unless aeyerji.Net.ReplicationGraph=0.
+ */
+UCLASS(Transient, Config=Engine)
+class AEYERJI_API UAeyerjiReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Installs the net driver hook that creates this graph. Called once from the game module's StartupModule: the graph's
+	 * own Init* overrides only run once a graph exists, and the class constructor also runs for the CDO and every
+	 * reinstanced class, so neither is the place for process-wide setup.
+	 */
+	static void RegisterCreateDriverDelegate();
+	static void UnregisterCreateDriverDelegate();
+
+	virtual void ResetGameWorldState() override;
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+private:
+	EAeyerjiClassRepNodeMapping GetMappingPolicy(const UClass* Class);
+	EAeyerjiClassRepNodeMapping ComputeDefaultMappingPolicy(const UClass* Class) const;
+	void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const;
+
+	TClassMap<EAeyerjiClassRepNodeMapping> ClassRepNodePolicies;
+
+	/** Owner-only actors; a handful per player, so connection nodes filter this list directly. */
+	TArray<TWeakObjectPtr<AActor>> OwnerOnlyActors;
+};
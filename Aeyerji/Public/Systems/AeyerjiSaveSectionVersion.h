@@ -0,0 +1,26 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Custom version UAeyerjiSaveService sets on the archive of each section payload it reads or writes. Not registered
+ * globally, so legacy SaveGameToSlot files and every other archive carry none.
+ */
+struct AEYERJI_API FAeyerjiSaveSectionVersion
+{
+	enum Type
+	{
+		Initial = 1,
+
+		/** Payloads are written with ArIsSaveGame; FItemStatModifier stores its attribute as a property path. */
+		SaveGameArchive = 2,
+
+		LatestVersion = SaveGameArchive
+	};
+
+	static const FGuid GUID;
+
+	/** Section version Ar was tagged with, or INDEX_NONE when Ar is not a section payload archive. */
+	static int32 Get(const FArchive& Ar);
+};
@@ -0,0 +1,128 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Tasks/Task.h"
+#include "AeyerjiSaveService.generated.h"
+
+class UAeyerjiSaveGame;
+enum class EAeyerjiSaveSection : uint8;
+
+/**
+ * Off-thread writer for character save slots.
+ *
+ * Callers hand over a fully gathered UAeyerjiSaveGame; the service duplicates it on the game thread and
+ * the duplicate becomes an immutable snapshot. Requests for the same slot inside the coalesce window
+ * replace the pending snapshot, so a burst (level-ups followed by a run completion) results in one write.
+ * Serialization and the disk write run on a background task; at most one write per slot is in flight.
+ *
+ * On disk a slot is a list of independently versioned, CRC-checked sections (EAeyerjiSaveSection). Sections whose
+ * revision did not change since the last write reuse their cached bytes, and a section that fails to decode falls
+ * back to defaults without taking the rest of the save down with it. Legacy SaveGameToSlot files still load.
+ *
+ * Lives on the engine so pending writes survive map travel / game instance teardown in PIE.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiSaveService : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOnSaveCompletedNative, const FString& /*Slot*/, bool /*bSuccess*/);
+	DECLARE_DELEGATE_OneParam(FOnSaveLoadedNative, UAeyerjiSaveGame* /*LoadedOrNull*/);
+
+	static UAeyerjiSaveService* Get();
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Snapshot Data and schedule a coalesced background write to Slot.
+	 * Returns false if the request was rejected (empty slot / null data); the write itself reports via OnSaveCompleted.
+	 */
+	bool RequestSave(const UAeyerjiSaveGame* Data, const FString& Slot);
+
+	/**
+	 * Returns a caller-owned copy of the most recent contents known for Slot (pending, in flight, or last written),
+	 * or nullptr if the service has never seen the slot. Never touches disk.
+	 */
+	UAeyerjiSaveGame* CopyLatestSave(const FString& Slot, UObject* Outer = nullptr) const;
+
+	/** Read-only view of the most recent contents known for Slot; do not hold on to the pointer. */
+	const UAeyerjiSaveGame* PeekLatestSave(const FString& Slot) const;
+
+	/** Blocking load; served from the snapshot cache when possible, otherwise reads and decodes the slot file. */
+	UAeyerjiSaveGame* LoadSave(const FString& Slot);
+
+	/** Loads Slot without blocking the game thread. Served from the snapshot cache when possible. */
+	void RequestLoad(const FString& Slot, FOnSaveLoadedNative OnLoaded);
+
+	/** On-disk layout version of a section. Bump when a section's property list changes incompatibly. */
+	static int32 GetSectionVersion(EAeyerjiSaveSection Section);
+
+	/** Starts every pending write now; when bBlock is set, also waits for all in-flight writes to finish. */
+	void FlushPendingSaves(bool bBlock);
+
+	bool HasPendingWrites() const { return DirtySlots.Num() > 0 || InFlight.Num() > 0; }
+
+	/** Fired on the game thread once a background write for a slot finished. */
+	FOnSaveCompletedNative OnSaveCompleted;
+
+private:
+	struct FSectionBlob
+	{
+		uint64 Revision = 0; // Section revision the payload was serialized from; 0 = never reusable.
+		int32 Version = 0;
+		uint32 Crc = 0;
+		TArray<uint8> Payload;
+	};
+
+	/** Last serialized bytes per section of one slot. Only touched by the slot's write task while it is in flight. */
+	struct FSlotSectionCache
+	{
+		TArray<FSectionBlob> Sections;
+	};
+	using FSlotSectionCacheRef = TSharedRef<FSlotSectionCache, ESPMode::ThreadSafe>;
+
+	struct FInFlightWrite
+	{
+		UE::Tasks::TTask<bool> Task;
+		UAeyerjiSaveGame* Snapshot = nullptr; // Referenced through InFlightSnapshots.
+		uint32 Serial = 0;
+	};
+
+	bool TickFlush(float DeltaTime);
+	void EnsureFlushTicker();
+	void StartWrite(const FString& Slot);
+	void WaitForWrite(const FString& Slot);
+	void HandleWriteFinished(const FString& Slot, uint32 Serial, bool bSuccess);
+	bool WriteSynchronously(const FString& Slot, UAeyerjiSaveGame* Snapshot);
+	UAeyerjiSaveGame* DecodeLoadedBytes(const FString& Slot, const TArray<uint8>& Bytes);
+	FSlotSectionCacheRef FindOrAddSectionCache(const FString& Slot);
+
+	/** Serializes changed sections into Cache, then assembles the slot file from the cached section blobs. */
+	static bool EncodeSave(const UAeyerjiSaveGame& Save, FSlotSectionCache& Cache, TArray<uint8>& OutBytes, int32& OutSectionsSerialized);
+
+	/** Decodes a sectioned or legacy slot file. Decoded section blobs are written to OutCache for reuse. */
+	static UAeyerjiSaveGame* DecodeSave(const TArray<uint8>& Bytes, const FString& Slot, FSlotSectionCache& OutCache);
+
+	/** Most recent contents per slot. Snapshots are never mutated after creation; new requests swap in a new object. */
+	UPROPERTY(Transient)
+	TMap<FString, TObjectPtr<UAeyerjiSaveGame>> LatestSnapshots;
+
+	/** Keeps snapshots alive while a background task is still serializing them. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAeyerjiSaveGame>> InFlightSnapshots;
+
+	/** Slot -> time (FPlatformTime::Seconds) the pending snapshot may be written. */
+	TMap<FString, double> DirtySlots;
+
+	TMap<FString, FInFlightWrite> InFlight;
+
+	TMap<FString, TSharedPtr<FSlotSectionCache, ESPMode::ThreadSafe>> SectionCaches;
+
+	FTSTicker::FDelegateHandle FlushTickerHandle;
+	uint32 NextWriteSerial = 1;
+};
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Aeyerji.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "AeyerjiServerTelemetry.generated.h"
+
+class UAbilitySystemComponent;
+struct FGameplayEffectSpec;
+
+/** One per-second aggregate row of server telemetry. */
+struct FAeyerjiTelemetrySample
+{
+	double WorldTimeSeconds = 0.0;
+	int32 LiveEnemies = 0;
+	int32 PendingSpawnRequests = 0;
+	int32 FixedSpawnQueue = 0;
+	float KillVelocity = 0.f;
+	float LootRollsPerSecond = 0.f;
+	int32 ReplicatedItemSubobjects = 0;
+	int32 InventoryItemSnapshots = 0;
+	float EffectApplicationsPerSecond = 0.f;
+	int32 Frames = 0;
+	float FrameMsP50 = 0.f;
+	float FrameMsP95 = 0.f;
+	float FrameMsP99 = 0.f;
+	float FrameMsMax = 0.f;
+	float GameThreadMsP50 = 0.f;
+	float GameThreadMsP95 = 0.f;
+	float BudgetScale = 0.f;
+	int32 BudgetCap = 0;
+};
+
+/**
+ * Server-side performance telemetry.
+ *
+ * While recording, collects frame times every tick and once per second folds them (plus director population, spawn
+ * queue depths, kill velocity, loot roll / GAS effect rates and replicated item counts) into one CSV row under
+ * Saved/Profiling/Telemetry. Files rotate after aeyerji.Telemetry.RowsPerFile rows; only the newest
+ * aeyerji.Telemetry.MaxFiles are kept.
+ *
+ * Starts automatically on servers when aeyerji.Telemetry.Enable=1 or with -AeyerjiTelemetry (headless runs), or on
+ * demand via aeyerji.Telemetry.Start / Stop / Print. Never records on clients.
+ */
+UCLASS()
+class AEYERJI_API UAeyerjiServerTelemetry : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UAeyerjiServerTelemetry* Get(const UObject* WorldContext);
+
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Begins sampling into a fresh CSV file. Returns false on clients. */
+	bool StartRecording();
+	void StopRecording();
+	bool IsRecording() const { return bRecording; }
+
+	/** Most recent completed sample, or nullptr before the first second has elapsed. */
+	const FAeyerjiTelemetrySample* GetLastSample() const { return bHasSample ? &LastSample : nullptr; }
+
+	const FString& GetCurrentFilePath() const { return CurrentFilePath; }
+
+	/** Counts ASC's effect applications while recording; no-op otherwise. Called wherever an actor's ASC is initialised. */
+	void RegisterAbilitySystem(UAbilitySystemComponent* ASC);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	bool IsServerWorld() const;
+	void ResetWindow(double Now);
+	void TakeSample(double Now);
+	void BindAbilitySystems();
+	void UnbindAbilitySystems();
+	void PruneAbilitySystems();
+	void HandleEffectApplied(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+
+	void OpenNewFile();
+	void AppendRow(const FAeyerjiTelemetrySample& Sample);
+	void FlushRows();
+	void PruneOldFiles() const;
+
+	bool bRecording = false;
+	bool bHasSample = false;
+	FAeyerjiTelemetrySample LastSample;
+
+	// Current one-second window.
+	double WindowStartSeconds = 0.0;
+	double LastFrameSeconds = 0.0;
+	TArray<float> FrameTimesMs;
+	TArray<float> GameThreadTimesMs;
+	int32 EffectApplicationsInWindow = 0;
+	uint64 LastLootRollCount = 0;
+
+	/** ASCs bound to HandleEffectApplied; only filled while recording. */
+	TSet<TWeakObjectPtr<UAbilitySystemComponent>> AbilitySystems;
+
+	FString CurrentFilePath;
+	int32 RowsInCurrentFile = 0;
+	TArray<FString> PendingRows;
+};
@@ -184,6 +184,9 @@ public:
 	/** Exposes the loaded loot table for systems that need shared formatting/scaling. */
 	UAeyerjiLootTable* GetLootTable() const;
 
+	/** Total RollLoot calls since this service started (telemetry diffs it into rolls/second). */
+	uint64 GetTotalRollCount() const { return TotalRollCount; }
+
 protected:
 	// UGameInstanceSubsystem
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override { return true; }
@@ -219,6 +222,8 @@ private:
 
 	mutable TWeakObjectPtr<UAeyerjiLootTable> CachedLootTable;
 
+	uint64 TotalRollCount = 0;
+
 	const FLootTablePool* FindMatchingPool(const FLootContext& Context, const UAeyerjiLootTable& Table) const;
 	UPlayerStatsTrackingComponent* ResolvePlayerStats(const FLootContext& Context) const;
 	EItemRarity ChooseRarity(const FLootContext& Context, float LegendaryChance, EItemRarity MinimumRarity) const;